@@ -7,6 +7,7 @@
              "src/njsAqEnqOptions.c",
              "src/njsAqMessage.c",
              "src/njsAqQueue.c",
+             "src/njsArena.c",
              "src/njsBaton.c",
              "src/njsTokenCallback.c",
              "src/njsConnection.c",
@@ -16,6 +17,7 @@
              "src/njsLob.c",
              "src/njsModule.c",
              "src/njsPool.c",
+             "src/njsPreparedStatement.c",
              "src/njsResultSet.c",
              "src/njsSodaCollection.c",
              "src/njsSodaDatabase.c",
@@ -23,8 +25,10 @@
              "src/njsSodaDocument.c",
              "src/njsSodaOperation.c",
              "src/njsSubscription.c",
+             "src/njsThinDecode.c",
              "src/njsUtils.c",
              "src/njsVariable.c",
+             "src/njsWorkerPool.c",
              "odpi/src/dpiConn.c",
              "odpi/src/dpiContext.c",
              "odpi/src/dpiData.c",
@@ -0,0 +1,163 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   benchmarkbinds.js
+ *
+ * DESCRIPTION
+ *   Measures the client CPU time taken per value to bind numbers when
+ *   inserting rows with executeMany().
+ *
+ *   JavaScript numbers and BigInts bound as NUMBER are now encoded directly
+ *   without first being converted to strings. This is compared to binding
+ *   the same values after converting each one to a string in JavaScript,
+ *   which is similar to what previously occurred for every number.
+ *
+ *****************************************************************************/
+
+'use strict';
+
+Error.stackTraceLimit = 50;
+
+const oracledb = require('oracledb');
+const dbConfig = require('./dbconfig.js');
+
+// This example runs in both node-oracledb Thin and Thick modes.
+//
+// Optionally run in node-oracledb Thick mode
+if (process.env.NODE_ORACLEDB_DRIVER_MODE === 'thick') {
+
+  // Thick mode requires Oracle Client or Oracle Instant Client libraries.
+  // On Windows and macOS you can specify the directory containing the
+  // libraries at runtime or before Node.js starts.  On other platforms (where
+  // Oracle libraries are available) the system library search path must always
+  // include the Oracle library path before Node.js starts.  If the search path
+  // is not correct, you will get a DPI-1047 error.  See the node-oracledb
+  // installation documentation.
+  let clientOpts = {};
+  // On Windows and macOS platforms, set the environment variable
+  // NODE_ORACLEDB_CLIENT_LIB_DIR to the Oracle Client library path
+  if (process.platform === 'win32' || process.platform === 'darwin') {
+    clientOpts = { libDir: process.env.NODE_ORACLEDB_CLIENT_LIB_DIR };
+  }
+  oracledb.initOracleClient(clientOpts);  // enable node-oracledb Thick mode
+}
+
+console.log(oracledb.thin ? 'Running in thin mode' : 'Running in thick mode');
+
+const NUM_ROWS = 100000;
+const NUM_ITERS = 5;
+
+const sql = `INSERT INTO no_benchmarkbinds (IntCol, BigIntCol, DecimalCol)
+             VALUES (:1, :2, :3)`;
+
+// Returns the average client CPU time in nanoseconds taken to bind each
+// value; if requested, the time taken to convert the values to strings is
+// included
+async function timeBinds(connection, rows, bindDefs, convertToStrings) {
+  let totalTime = 0;
+  for (let i = 0; i < NUM_ITERS; i++) {
+    await connection.execute(`TRUNCATE TABLE no_benchmarkbinds`);
+    const start = process.cpuUsage();
+    const binds = (convertToStrings) ?
+      rows.map(row => row.map(v => v.toString())) : rows;
+    await connection.executeMany(sql, binds, { bindDefs });
+    const usage = process.cpuUsage(start);
+    totalTime += usage.user + usage.system;
+  }
+  return totalTime * 1000 / (NUM_ITERS * rows.length * bindDefs.length);
+}
+
+async function run() {
+
+  let connection;
+
+  try {
+    connection = await oracledb.getConnection(dbConfig);
+
+    console.log('Creating table...');
+
+    const stmts = [
+      `DROP TABLE no_benchmarkbinds PURGE`,
+
+      `CREATE TABLE no_benchmarkbinds (
+         IntCol     NUMBER(9),
+         BigIntCol  NUMBER(18),
+         DecimalCol NUMBER(12, 2)
+       )`
+    ];
+
+    for (const s of stmts) {
+      try {
+        await connection.execute(s);
+      } catch (e) {
+        if (e.errorNum != 942)
+          throw (e);
+      }
+    }
+
+    const rows = [];
+    for (let i = 1; i <= NUM_ROWS; i++) {
+      rows.push([i, BigInt(i) * 1000000007n, i / 4]);
+    }
+
+    const numberDefs = [
+      { type: oracledb.NUMBER },
+      { type: oracledb.NUMBER },
+      { type: oracledb.NUMBER }
+    ];
+    const stringDefs = [
+      { type: oracledb.STRING, maxSize: 20 },
+      { type: oracledb.STRING, maxSize: 20 },
+      { type: oracledb.STRING, maxSize: 20 }
+    ];
+
+    // warm up
+    await timeBinds(connection, rows, numberDefs);
+
+    console.log(`Inserting ${NUM_ROWS} rows ${NUM_ITERS} times...`);
+
+    const numberTime = await timeBinds(connection, rows, numberDefs, false);
+    const stringTime = await timeBinds(connection, rows, stringDefs, true);
+
+    console.log(`Direct NUMBER encoding: ${numberTime.toFixed(1)} ns/value`);
+    console.log(`Conversion to strings:  ${stringTime.toFixed(1)} ns/value`);
+    console.log(`Savings:                ${(stringTime - numberTime).toFixed(1)} ns/value`);
+
+    await connection.execute(`DROP TABLE no_benchmarkbinds PURGE`);
+
+  } catch (err) {
+    console.error(err);
+  } finally {
+    if (connection) {
+      try {
+        await connection.close();
+      } catch (err) {
+        console.error(err);
+      }
+    }
+  }
+}
+
+run();
@@ -0,0 +1,161 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   benchmarknumbers.js
+ *
+ * DESCRIPTION
+ *   Measures the time taken per cell to fetch NUMBER columns.
+ *
+ *   Integer columns with a precision of 18 or less are fetched natively as
+ *   64-bit integers and other NUMBER columns are converted to JavaScript
+ *   numbers without creating an intermediate JavaScript string. This is
+ *   compared to fetching the same values as strings and converting each one
+ *   to a number in JavaScript, which is what previously occurred for every
+ *   NUMBER value.
+ *
+ *   The difference is most noticeable in node-oracledb Thick mode.
+ *
+ *****************************************************************************/
+
+'use strict';
+
+Error.stackTraceLimit = 50;
+
+const oracledb = require('oracledb');
+const dbConfig = require('./dbconfig.js');
+
+// This example runs in both node-oracledb Thin and Thick modes.
+//
+// Optionally run in node-oracledb Thick mode
+if (process.env.NODE_ORACLEDB_DRIVER_MODE === 'thick') {
+
+  // Thick mode requires Oracle Client or Oracle Instant Client libraries.
+  // On Windows and macOS you can specify the directory containing the
+  // libraries at runtime or before Node.js starts.  On other platforms (where
+  // Oracle libraries are available) the system library search path must always
+  // include the Oracle library path before Node.js starts.  If the search path
+  // is not correct, you will get a DPI-1047 error.  See the node-oracledb
+  // installation documentation.
+  let clientOpts = {};
+  // On Windows and macOS platforms, set the environment variable
+  // NODE_ORACLEDB_CLIENT_LIB_DIR to the Oracle Client library path
+  if (process.platform === 'win32' || process.platform === 'darwin') {
+    clientOpts = { libDir: process.env.NODE_ORACLEDB_CLIENT_LIB_DIR };
+  }
+  oracledb.initOracleClient(clientOpts);  // enable node-oracledb Thick mode
+}
+
+console.log(oracledb.thin ? 'Running in thin mode' : 'Running in thick mode');
+
+const NUM_ROWS = 100000;
+const NUM_ITERS = 5;
+
+const sql = `SELECT IntCol, BigIntCol, DecimalCol, UnconstrainedCol
+             FROM no_benchmarknumbers`;
+
+// Returns the average time in nanoseconds taken to fetch each cell
+async function timeFetch(connection, options) {
+  let totalTime = 0n;
+  let numCells = 0;
+  for (let i = 0; i < NUM_ITERS; i++) {
+    const start = process.hrtime.bigint();
+    const result = await connection.execute(sql, [], options);
+    totalTime += process.hrtime.bigint() - start;
+    numCells += result.rows.length * result.metaData.length;
+  }
+  return Number(totalTime) / numCells;
+}
+
+async function run() {
+
+  let connection;
+
+  try {
+    connection = await oracledb.getConnection(dbConfig);
+
+    console.log('Creating table...');
+
+    const stmts = [
+      `DROP TABLE no_benchmarknumbers PURGE`,
+
+      `CREATE TABLE no_benchmarknumbers (
+         IntCol           NUMBER(9),
+         BigIntCol        NUMBER(18),
+         DecimalCol       NUMBER(12, 2),
+         UnconstrainedCol NUMBER
+       )`,
+
+      `INSERT INTO no_benchmarknumbers
+       SELECT level, level * 1000000007, level / 4, level / 7
+       FROM dual
+       CONNECT BY level <= ${NUM_ROWS}`
+    ];
+
+    for (const s of stmts) {
+      try {
+        await connection.execute(s);
+      } catch (e) {
+        if (e.errorNum != 942)
+          throw (e);
+      }
+    }
+    await connection.commit();
+
+    const fetchArraySize = 1000;
+
+    // warm up
+    await timeFetch(connection, { fetchArraySize });
+
+    console.log(`Fetching ${NUM_ROWS} rows ${NUM_ITERS} times...`);
+
+    const nativeTime = await timeFetch(connection, { fetchArraySize });
+
+    const stringTime = await timeFetch(connection, {
+      fetchArraySize,
+      fetchTypeHandler: function() {
+        return { type: oracledb.STRING, converter: Number };
+      }
+    });
+
+    console.log(`Native NUMBER conversion:  ${nativeTime.toFixed(1)} ns/cell`);
+    console.log(`String round trip:         ${stringTime.toFixed(1)} ns/cell`);
+    console.log(`Savings:                   ${(stringTime - nativeTime).toFixed(1)} ns/cell`);
+
+    await connection.execute(`DROP TABLE no_benchmarknumbers PURGE`);
+
+  } catch (err) {
+    console.error(err);
+  } finally {
+    if (connection) {
+      try {
+        await connection.close();
+      } catch (err) {
+        console.error(err);
+      }
+    }
+  }
+}
+
+run();
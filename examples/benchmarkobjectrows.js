@@ -0,0 +1,129 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   benchmarkobjectrows.js
+ *
+ * DESCRIPTION
+ *   Compares the throughput and the heap used when fetching a million rows
+ *   with OUT_FORMAT_ARRAY and with OUT_FORMAT_OBJECT.
+ *
+ *   Object rows are created directly by node-oracledb using a single set of
+ *   property keys for each query, so that every row shares the same shape.
+ *
+ *   Run with 'node --expose-gc benchmarkobjectrows.js' for more accurate heap
+ *   figures.
+ *
+ *****************************************************************************/
+
+'use strict';
+
+Error.stackTraceLimit = 50;
+
+const oracledb = require('oracledb');
+const dbConfig = require('./dbconfig.js');
+
+// This example runs in both node-oracledb Thin and Thick modes.
+//
+// Optionally run in node-oracledb Thick mode
+if (process.env.NODE_ORACLEDB_DRIVER_MODE === 'thick') {
+
+  // Thick mode requires Oracle Client or Oracle Instant Client libraries.
+  // On Windows and macOS you can specify the directory containing the
+  // libraries at runtime or before Node.js starts.  On other platforms (where
+  // Oracle libraries are available) the system library search path must always
+  // include the Oracle library path before Node.js starts.  If the search path
+  // is not correct, you will get a DPI-1047 error.  See the node-oracledb
+  // installation documentation.
+  let clientOpts = {};
+  // On Windows and macOS platforms, set the environment variable
+  // NODE_ORACLEDB_CLIENT_LIB_DIR to the Oracle Client library path
+  if (process.platform === 'win32' || process.platform === 'darwin') {
+    clientOpts = { libDir: process.env.NODE_ORACLEDB_CLIENT_LIB_DIR };
+  }
+  oracledb.initOracleClient(clientOpts);  // enable node-oracledb Thick mode
+}
+
+console.log(oracledb.thin ? 'Running in thin mode' : 'Running in thick mode');
+
+const NUM_ROWS = 1000000;
+
+const sql = `SELECT level AS id,
+                    'Name ' || level AS name,
+                    level / 4 AS amount,
+                    DATE '2024-01-01' + MOD(level, 365) AS created
+             FROM dual
+             CONNECT BY level <= :numRows`;
+
+// Fetches all of the rows in the given output format and reports the
+// throughput and the heap used to hold the rows
+async function timeFetch(connection, label, outFormat) {
+  if (global.gc)
+    global.gc();
+  const startHeap = process.memoryUsage().heapUsed;
+  const start = process.hrtime.bigint();
+  const result = await connection.execute(sql, [NUM_ROWS],
+    { outFormat, fetchArraySize: 1000 });
+  const elapsed = Number(process.hrtime.bigint() - start) / 1e9;
+  if (global.gc)
+    global.gc();
+  const heap = process.memoryUsage().heapUsed - startHeap;
+  const rowsPerSec = Math.round(result.rows.length / elapsed);
+  console.log(`${label.padEnd(20)} ${rowsPerSec.toString().padStart(10)} rows/sec ` +
+    `${(heap / 1048576).toFixed(1).padStart(8)} MB heap`);
+  return result.rows.length;
+}
+
+async function run() {
+
+  let connection;
+
+  try {
+    connection = await oracledb.getConnection(dbConfig);
+
+    // warm up
+    await connection.execute(sql, [1000],
+      { outFormat: oracledb.OUT_FORMAT_OBJECT });
+
+    console.log(`Fetching ${NUM_ROWS} rows...`);
+    if (!global.gc)
+      console.log('Run with node --expose-gc for more accurate heap figures');
+
+    await timeFetch(connection, 'OUT_FORMAT_ARRAY', oracledb.OUT_FORMAT_ARRAY);
+    await timeFetch(connection, 'OUT_FORMAT_OBJECT', oracledb.OUT_FORMAT_OBJECT);
+
+  } catch (err) {
+    console.error(err);
+  } finally {
+    if (connection) {
+      try {
+        await connection.close();
+      } catch (err) {
+        console.error(err);
+      }
+    }
+  }
+}
+
+run();
@@ -0,0 +1,144 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   benchmarkthindecode.js
+ *
+ * DESCRIPTION
+ *   Measures the client CPU time taken per cell to decode the rows of a query
+ *   in node-oracledb Thin mode.
+ *
+ *   The rows are decoded by JavaScript and then by the optional native row
+ *   decoder, which is enabled with oracledb.thinNativeDecode and requires the
+ *   node-oracledb binary to be available. The client CPU time is measured so
+ *   that the time spent waiting for the database is excluded.
+ *
+ *****************************************************************************/
+
+'use strict';
+
+Error.stackTraceLimit = 50;
+
+const oracledb = require('oracledb');
+const dbConfig = require('./dbconfig.js');
+
+// This example only runs in node-oracledb Thin mode
+console.log('Running in thin mode');
+
+const NUM_ROWS = 100000;
+const NUM_ITERS = 5;
+
+const sql = `SELECT IntCol, DecimalCol, StringCol, DateCol, TimestampCol,
+                    DoubleCol, RawCol
+             FROM no_benchmarkthindecode`;
+
+// Returns the average client CPU time in nanoseconds taken to fetch each cell
+async function timeFetch(connection) {
+  let totalTime = 0;
+  let numCells = 0;
+  for (let i = 0; i < NUM_ITERS; i++) {
+    const start = process.cpuUsage();
+    const result = await connection.execute(sql, [], { fetchArraySize: 1000 });
+    const usage = process.cpuUsage(start);
+    totalTime += usage.user + usage.system;
+    numCells += result.rows.length * result.metaData.length;
+  }
+  return totalTime * 1000 / numCells;
+}
+
+async function run() {
+
+  let connection;
+
+  try {
+    connection = await oracledb.getConnection(dbConfig);
+
+    console.log('Creating table...');
+
+    const stmts = [
+      `DROP TABLE no_benchmarkthindecode PURGE`,
+
+      `CREATE TABLE no_benchmarkthindecode (
+         IntCol       NUMBER(9),
+         DecimalCol   NUMBER(12, 2),
+         StringCol    VARCHAR2(40),
+         DateCol      DATE,
+         TimestampCol TIMESTAMP,
+         DoubleCol    BINARY_DOUBLE,
+         RawCol       RAW(16)
+       )`,
+
+      `INSERT INTO no_benchmarkthindecode
+       SELECT level, level / 4, 'String value ' || level,
+              DATE '2020-01-01' + level / 24,
+              TIMESTAMP '2020-01-01 00:00:00' + NUMTODSINTERVAL(level, 'SECOND'),
+              level / 7, HEXTORAW(TO_CHAR(level, 'FM0000000X'))
+       FROM dual
+       CONNECT BY level <= ${NUM_ROWS}`
+    ];
+
+    for (const s of stmts) {
+      try {
+        await connection.execute(s);
+      } catch (e) {
+        if (e.errorNum != 942)
+          throw (e);
+      }
+    }
+    await connection.commit();
+
+    // warm up
+    await timeFetch(connection);
+
+    console.log(`Fetching ${NUM_ROWS} rows ${NUM_ITERS} times...`);
+
+    oracledb.thinNativeDecode = false;
+    const jsTime = await timeFetch(connection);
+    console.log(`JavaScript decoding: ${jsTime.toFixed(1)} ns/cell`);
+
+    oracledb.thinNativeDecode = true;
+    if (!oracledb.thinNativeDecode) {
+      console.log('The native row decoder is not available');
+    } else {
+      const nativeTime = await timeFetch(connection);
+      console.log(`Native decoding:     ${nativeTime.toFixed(1)} ns/cell`);
+      console.log(`Savings:             ${(jsTime - nativeTime).toFixed(1)} ns/cell`);
+    }
+
+    await connection.execute(`DROP TABLE no_benchmarkthindecode PURGE`);
+
+  } catch (err) {
+    console.error(err);
+  } finally {
+    if (connection) {
+      try {
+        await connection.close();
+      } catch (err) {
+        console.error(err);
+      }
+    }
+  }
+}
+
+run();
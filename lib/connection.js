@@ -30,6 +30,7 @@ const AqQueue = require('./aqQueue.js');
 const BaseDbObject = require('./dbObject.js');
 const { Buffer } = require('buffer');
 const Lob = require('./lob.js');
+const PreparedStatement = require('./preparedStatement.js');
 const ResultSet = require('./resultset.js');
 const SodaDatabase = require('./sodaDatabase.js');
 const EventEmitter = require('events');
@@ -121,9 +122,18 @@ class Connection extends EventEmitter {
       "dbObjectAsPojo",
       "fetchArraySize",
       "fetchTypeHandler",
+      "jsonFetchMode",
       "maxRows",
       "outFormat",
-      "prefetchRows");
+      "prefetchRows",
+      "vectorFetchMode");
+
+    // if the fetch array size is determined automatically, the default size
+    // is used until the columns being fetched are known
+    if (options.fetchArraySize === constants.FETCH_ARRAY_SIZE_AUTO) {
+      options.fetchArraySize = constants.DEFAULT_FETCH_ARRAY_SIZE;
+      options.fetchArraySizeAuto = true;
+    }
   }
 
   //---------------------------------------------------------------------------
@@ -464,6 +474,193 @@ class Connection extends EventEmitter {
     return normBinds;
   }
 
+  //---------------------------------------------------------------------------
+  // _processExecuteManyColumn()
+  //
+  // Processes a single column of values supplied by the caller to
+  // executeMany(). Float64Array, Int32Array and BigInt64Array columns bound as
+  // numbers are passed directly to the implementation without examining each
+  // value; all other columns have each of their values processed in the same
+  // way as rows are, but without any asynchronous calls. The optional null
+  // bitmap uses the same format as columns fetched with OUT_FORMAT_COLUMNS.
+  //---------------------------------------------------------------------------
+  async _processExecuteManyColumn(bindInfo, column, numIters) {
+    let values = column;
+    let nulls;
+    if (!Array.isArray(column) && !ArrayBuffer.isView(column)) {
+      errors.assertParamValue(nodbUtil.isObject(column) &&
+        (Array.isArray(column.values) || ArrayBuffer.isView(column.values)),
+      2);
+      values = column.values;
+      nulls = column.nulls;
+      if (nulls !== undefined) {
+        errors.assertParamValue(nulls instanceof Uint8Array &&
+          nulls.length >= (numIters + 7) >> 3, 2);
+      }
+      if (column.dims !== undefined) {
+        return this._processExecuteManyVectorColumn(bindInfo, values,
+          column.dims, nulls, numIters);
+      }
+    }
+    if (values.length !== numIters) {
+      errors.throwErr(errors.ERR_COLUMN_LENGTH_MISMATCH,
+        bindInfo.name, values.length, numIters);
+    }
+
+    // determine if the values can be passed through directly
+    let columnArrayType;
+    if (values instanceof Float64Array) {
+      columnArrayType = constants.COLUMN_ARRAY_TYPE_FLOAT64;
+    } else if (values instanceof Int32Array) {
+      columnArrayType = constants.COLUMN_ARRAY_TYPE_INT32;
+    } else if (values instanceof BigInt64Array) {
+      columnArrayType = constants.COLUMN_ARRAY_TYPE_BIGINT64;
+    }
+    if (columnArrayType !== undefined && bindInfo.type === undefined)
+      bindInfo.type = types.DB_TYPE_NUMBER;
+    if (columnArrayType !== undefined &&
+        (bindInfo.type === types.DB_TYPE_NUMBER ||
+        bindInfo.type === types.DB_TYPE_BINARY_INTEGER ||
+        bindInfo.type === types.DB_TYPE_BINARY_FLOAT ||
+        bindInfo.type === types.DB_TYPE_BINARY_DOUBLE)) {
+      if (columnArrayType === constants.COLUMN_ARRAY_TYPE_FLOAT64 &&
+          bindInfo.type === types.DB_TYPE_NUMBER) {
+        for (let i = 0; i < numIters; i++) {
+          if (Number.isFinite(values[i]) ||
+              (nulls && (nulls[i >> 3] & (1 << (i & 7)))))
+            continue;
+          if (Number.isNaN(values[i]))
+            errors.throwErr(errors.ERR_NAN_VALUE);
+          errors.throwErr(errors.ERR_ORACLE_NUMBER_NO_REPR);
+        }
+      } else if (columnArrayType === constants.COLUMN_ARRAY_TYPE_FLOAT64 &&
+          bindInfo.type === types.DB_TYPE_BINARY_INTEGER) {
+        // values are bound as 64-bit integers so they must not be truncated
+        for (let i = 0; i < numIters; i++) {
+          if ((Number.isInteger(values[i]) && values[i] >= -(2 ** 63) &&
+              values[i] < 2 ** 63) ||
+              (nulls && (nulls[i >> 3] & (1 << (i & 7)))))
+            continue;
+          errors.throwErr(errors.ERR_COLUMN_VALUE_NOT_INTEGER, values[i], i,
+            bindInfo.name);
+        }
+      }
+      bindInfo.values = values;
+      bindInfo.nulls = nulls;
+      bindInfo.columnArrayType = columnArrayType;
+      return;
+    }
+
+    // otherwise, process each of the values
+    bindInfo.values = new Array(numIters);
+    for (let i = 0; i < numIters; i++) {
+      let value = values[i];
+      if (nulls && (nulls[i >> 3] & (1 << (i & 7))))
+        value = null;
+      const options = {pos: i, allowArray: false};
+      bindInfo.values[i] = transformer.transformValueIn(bindInfo, value,
+        options);
+      if (bindInfo.type === types.DB_TYPE_OBJECT &&
+          bindInfo.typeClass === undefined) {
+        if (this._impl.pipelineMode)
+          errors.throwErr(errors.ERR_PIPELINE_DBOBJECTS_NOT_SUPPORTED);
+        bindInfo.typeClass = await this._getDbObjectClass(value._objType);
+        bindInfo.objType = bindInfo.typeClass._objType;
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // _processExecuteManyVectorColumn()
+  //
+  // Processes a column of vectors supplied by the caller to executeMany() as a
+  // single Float32Array, Float64Array or Int8Array containing the dimensions
+  // of each row consecutively. The matrix is passed directly to the
+  // implementation which encodes each row from it without creating an array
+  // for each vector.
+  //---------------------------------------------------------------------------
+  _processExecuteManyVectorColumn(bindInfo, values, dims, nulls, numIters) {
+    errors.assertParamValue(Number.isInteger(dims) && dims > 0 &&
+      (values instanceof Float32Array || values instanceof Float64Array ||
+      values instanceof Int8Array) && values.length % dims === 0, 2);
+    const numRows = values.length / dims;
+    if (numRows !== numIters) {
+      errors.throwErr(errors.ERR_COLUMN_LENGTH_MISMATCH, bindInfo.name,
+        numRows, numIters);
+    }
+    if (bindInfo.type === undefined) {
+      bindInfo.type = types.DB_TYPE_VECTOR;
+    } else if (bindInfo.type !== types.DB_TYPE_VECTOR) {
+      errors.throwErr(errors.ERR_BIND_VALUE_AND_TYPE_MISMATCH);
+    }
+    bindInfo.values = values;
+    bindInfo.nulls = nulls;
+    bindInfo.dims = dims;
+    bindInfo.columnArrayType = constants.COLUMN_ARRAY_TYPE_VECTOR;
+  }
+
+  //---------------------------------------------------------------------------
+  // _processExecuteManyColumns()
+  //
+  // Processes the binds supplied by the caller to executeMany() as an object
+  // containing a column of values for each bind name. This performs all checks
+  // on the binds and normalizes them for use by the implementation class.
+  //---------------------------------------------------------------------------
+  async _processExecuteManyColumns(columns, bindDefs) {
+    const normBinds = [];
+
+    // transform bindDefs into normalized binds, if available; otherwise, the
+    // names of the columns determine the binds to use
+    let bindNames;
+    if (bindDefs !== undefined) {
+      errors.assert(!Array.isArray(bindDefs), errors.ERR_MIXED_BIND);
+      bindNames = Object.getOwnPropertyNames(bindDefs);
+      for (let i = 0; i < bindNames.length; i++) {
+        const bindInfo = normBinds[i] = {name: bindNames[i], values: []};
+        await this._processBindUnit(bindInfo, bindDefs[bindNames[i]], true);
+      }
+    } else {
+      bindNames = Object.getOwnPropertyNames(columns);
+      for (let i = 0; i < bindNames.length; i++) {
+        normBinds[i] = {name: bindNames[i], dir: constants.BIND_IN,
+          isArray: false, values: []};
+      }
+    }
+
+    // the number of iterations is determined by the first column; a matrix
+    // of vectors contains one row of dimensions for each iteration
+    const column = columns[Object.getOwnPropertyNames(columns)[0]];
+    let numIters;
+    if (Array.isArray(column) || ArrayBuffer.isView(column)) {
+      numIters = column.length;
+    } else if (column?.dims !== undefined) {
+      numIters = column.values?.length / column.dims;
+    } else {
+      numIters = column?.values?.length;
+    }
+    errors.assertParamValue(Number.isInteger(numIters) && numIters > 0, 2);
+
+    // process each of the columns; OUT binds do not require a column
+    for (const bindInfo of normBinds) {
+      const column = columns[bindInfo.name];
+      if (column === undefined && bindInfo.dir === constants.BIND_OUT)
+        continue;
+      errors.assertParamValue(column !== undefined, 2);
+      await this._processExecuteManyColumn(bindInfo, column, numIters);
+    }
+
+    // set bind type and size to a string of size 1 if no bind type was
+    // specified (and all values are null)
+    for (const bindInfo of normBinds) {
+      if (bindInfo.type === undefined) {
+        bindInfo.type = types.DB_TYPE_VARCHAR;
+        bindInfo.maxSize = 1;
+      }
+    }
+
+    return {binds: normBinds, numIters};
+  }
+
   //---------------------------------------------------------------------------
   // _processExecuteManyBinds()
   //
@@ -639,8 +836,11 @@ class Connection extends EventEmitter {
     // handle options specific to execute()
     } else {
 
-      // fetchArraySize must be a positive integer
-      errors.assertParamPropUnsignedIntNonZero(options, 3, "fetchArraySize");
+      // fetchArraySize must be a positive integer or the value 'auto'
+      if (options.fetchArraySize !== constants.FETCH_ARRAY_SIZE_AUTO) {
+        errors.assertParamPropUnsignedIntNonZero(options, 3,
+          "fetchArraySize");
+      }
       outOptions.fetchArraySize = options.fetchArraySize;
 
       // fetchInfo must be an object with keys containing an object with a
@@ -673,6 +873,15 @@ class Connection extends EventEmitter {
         outOptions.fetchTypeHandler = options.fetchTypeHandler;
       }
 
+      // jsonFetchMode must be one of the possible values
+      if (options.jsonFetchMode !== undefined) {
+        errors.assertParamPropValue(
+          options.jsonFetchMode === constants.JSON_FETCH_MODE_EAGER ||
+          options.jsonFetchMode === constants.JSON_FETCH_MODE_LAZY, 3,
+          "jsonFetchMode");
+        outOptions.jsonFetchMode = options.jsonFetchMode;
+      }
+
       // maxRows must be a positive integer (or 0)
       if (options.maxRows !== undefined) {
         errors.assertParamPropValue(Number.isInteger(options.maxRows) &&
@@ -680,14 +889,22 @@ class Connection extends EventEmitter {
         outOptions.maxRows = options.maxRows;
       }
 
-      // outFormat must be one of the two possible constants
+      // outFormat must be one of the possible constants
       if (options.outFormat !== undefined) {
         errors.assertParamPropValue(
           options.outFormat === constants.OUT_FORMAT_ARRAY ||
-          options.outFormat === constants.OUT_FORMAT_OBJECT, 3, "outFormat");
+          options.outFormat === constants.OUT_FORMAT_OBJECT ||
+          options.outFormat === constants.OUT_FORMAT_COLUMNS, 3, "outFormat");
         outOptions.outFormat = options.outFormat;
       }
 
+      // prefetchAhead must be a boolean value
+      if (options.prefetchAhead !== undefined) {
+        errors.assertParamPropValue(typeof options.prefetchAhead === 'boolean',
+          3, "prefetchAhead");
+        outOptions.prefetchAhead = options.prefetchAhead;
+      }
+
       // prefetchRows must be a positive integer (or 0)
       if (options.prefetchRows !== undefined) {
         errors.assertParamPropValue(Number.isInteger(options.prefetchRows) &&
@@ -702,6 +919,15 @@ class Connection extends EventEmitter {
         outOptions.resultSet = options.resultSet;
       }
 
+      // vectorFetchMode must be one of the possible values
+      if (options.vectorFetchMode !== undefined) {
+        errors.assertParamPropValue(
+          options.vectorFetchMode === constants.VECTOR_FETCH_MODE_SEPARATE ||
+          options.vectorFetchMode === constants.VECTOR_FETCH_MODE_MATRIX, 3,
+          "vectorFetchMode");
+        outOptions.vectorFetchMode = options.vectorFetchMode;
+      }
+
     }
 
     return outOptions;
@@ -887,6 +1113,28 @@ class Connection extends EventEmitter {
     return lob;
   }
 
+  //---------------------------------------------------------------------------
+  // createLobs()
+  //
+  // Creates a number of temporary LOBs of the same type and returns them to
+  // the caller in an array.
+  //---------------------------------------------------------------------------
+  async createLobs(type, count) {
+    errors.assertArgCount(arguments, 2, 2);
+    errors.assertParamValue(type === types.DB_TYPE_CLOB ||
+      type === types.DB_TYPE_BLOB ||
+      type === types.DB_TYPE_NCLOB, 1);
+    errors.assertParamValue(Number.isInteger(count) && count >= 0 &&
+      count <= 0xFFFFFFFF, 2);
+    errors.assert(this._impl, errors.ERR_INVALID_CONNECTION);
+    const lobImpls = await this._impl.createLobs(type, count);
+    return lobImpls.map(lobImpl => {
+      const lob = new Lob();
+      lob._setup(lobImpl, false);
+      return lob;
+    });
+  }
+
   //---------------------------------------------------------------------------
   // currentSchema
   //
@@ -951,7 +1199,10 @@ class Connection extends EventEmitter {
   //---------------------------------------------------------------------------
   decodeOSON(buf) {
     errors.assertArgCount(arguments, 1, 1);
-    errors.assertParamValue(Buffer.isBuffer(buf), 1);
+    errors.assertParamValue(Buffer.isBuffer(buf) ||
+      buf instanceof types.OsonImage, 1);
+    if (buf instanceof types.OsonImage)
+      buf = buf._toBuffer();
     const decoder = new oson.OsonDecoder(buf);
     return decoder.decode();
   }
@@ -1143,6 +1394,7 @@ class Connection extends EventEmitter {
       result.metaData = resultSet._impl.metaData;
       if (!fetchOpPipeline) {
         if (options.resultSet) {
+          resultSet._prefetchAhead = options.prefetchAhead;
           result.resultSet = resultSet;
         } else {
           // for fetchAll, _getAllRows() get rows from buffered rows and
@@ -1185,6 +1437,10 @@ class Connection extends EventEmitter {
       if (options.bindDefs !== undefined) {
         binds = await this._processExecuteManyBinds([], options.bindDefs);
       }
+    } else if (!Array.isArray(bindsOrNumIters) &&
+        nodbUtil.isObject(bindsOrNumIters)) {
+      ({binds, numIters} = await this._processExecuteManyColumns(
+        bindsOrNumIters, options.bindDefs));
     } else {
       errors.assertParamValue(Array.isArray(bindsOrNumIters) &&
         bindsOrNumIters.length > 0, 2);
@@ -1211,6 +1467,75 @@ class Connection extends EventEmitter {
     return this._transformExecuteManyResult(result, options);
   }
 
+  //---------------------------------------------------------------------------
+  // _mergeExecuteManyResult()
+  //
+  // Merges the result of executing one batch of rows by executeManyStream()
+  // into the combined result. The offsets of batch errors are adjusted to
+  // refer to the position of the row in the source.
+  //---------------------------------------------------------------------------
+  _mergeExecuteManyResult(result, batchResult, rowOffset) {
+    if (batchResult.rowsAffected !== undefined)
+      result.rowsAffected += batchResult.rowsAffected;
+    if (batchResult.warning && !result.warning)
+      result.warning = batchResult.warning;
+    for (const key of ['dmlRowCounts', 'outBinds', 'batchErrors']) {
+      const values = batchResult[key];
+      if (values === undefined)
+        continue;
+      if (result[key] === undefined)
+        result[key] = [];
+      for (const value of values) {
+        if (key === 'batchErrors')
+          value.offset += rowOffset;
+        result[key].push(value);
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // _readExecuteManyBatch()
+  //
+  // Reads up to the specified number of rows from the source supplied to
+  // executeManyStream() and returns them as normalized binds. If the source
+  // has no more rows, undefined is returned. The rows are read without
+  // holding the connection lock, since the source may itself use the
+  // connection; the binds are processed while holding the lock, since
+  // processing them may require object types to be fetched from the database.
+  //---------------------------------------------------------------------------
+  async _readExecuteManyBatch(iterator, batchSize, bindDefs) {
+    const rows = [];
+    while (rows.length < batchSize) {
+      const item = await iterator.next();
+      if (item.done)
+        break;
+      rows.push(item.value);
+    }
+    if (rows.length === 0)
+      return;
+    const binds = await this._runWithLock(() =>
+      this._processExecuteManyBinds(rows, bindDefs));
+    return {numIters: rows.length, binds};
+  }
+
+  //---------------------------------------------------------------------------
+  // _runWithLock()
+  //
+  // Runs the given function while holding the connection lock. This is used
+  // by methods that are not serialized as a whole, such as
+  // executeManyStream(), which must release the connection between batches so
+  // that the source of rows can use the same connection.
+  //---------------------------------------------------------------------------
+  async _runWithLock(fn) {
+    const connImpl = this._impl._getConnImpl();
+    await connImpl._acquireLock();
+    try {
+      return await fn();
+    } finally {
+      connImpl._releaseLock();
+    }
+  }
+
   _transformExecuteManyResult(result, options) {
     // convert ORA warnings to NJS
     if (result.warning) {
@@ -1239,6 +1564,93 @@ class Connection extends EventEmitter {
     return await this._executeMany.apply(this, arguments);
   }
 
+  //---------------------------------------------------------------------------
+  // executeManyStream()
+  //
+  // Executes a SQL statement once for each row supplied by an async iterable
+  // (such as a Readable stream in object mode) or an iterable. The rows are
+  // processed in batches which are executed using a statement that remains
+  // prepared, so that bind buffers can be reused; the next batch is read from
+  // the source and processed while the previous batch is being executed by
+  // the database. The results of each batch are combined into a single
+  // result. The method is not serialized as a whole; instead the connection
+  // lock is held for each operation, so that the source can be a query stream
+  // or result set using the same connection.
+  //---------------------------------------------------------------------------
+  async executeManyStream(sql, source, a3) {
+    let options = {};
+    let batchSize = constants.DEFAULT_EXECUTE_MANY_BATCH_SIZE;
+
+    // process arguments
+    errors.assertArgCount(arguments, 2, 3);
+    errors.assertParamValue(typeof sql === 'string', 1);
+    errors.assertParamValue(nodbUtil.isObject(source) &&
+      (typeof source[Symbol.asyncIterator] === 'function' ||
+      typeof source[Symbol.iterator] === 'function'), 2);
+    if (arguments.length == 3) {
+      options = this._verifyExecOpts(a3, true);
+      if (a3.batchSize !== undefined) {
+        errors.assertParamPropValue(Number.isInteger(a3.batchSize) &&
+          a3.batchSize > 0, 3, "batchSize");
+        batchSize = a3.batchSize;
+      }
+    }
+    this._addDefaultsToExecOpts(options);
+    errors.assert(this._impl, errors.ERR_INVALID_CONNECTION);
+    if (this._impl._callLevelTraceData) {
+      this._impl._callLevelTraceData.statement = sql;
+    }
+
+    // the transaction is committed (or suspended) once all batches have been
+    // executed, instead of after each batch
+    const autoCommit = options.autoCommit;
+    const suspendOnSuccess = options.suspendOnSuccess;
+    options.autoCommit = false;
+    options.suspendOnSuccess = false;
+
+    const iterator = (typeof source[Symbol.asyncIterator] === 'function') ?
+      source[Symbol.asyncIterator]() : source[Symbol.iterator]();
+    const result = {rowsAffected: 0};
+    let completed = false;
+    let stmtImpl;
+    try {
+      let batch = await this._readExecuteManyBatch(iterator, batchSize,
+        options.bindDefs);
+      let rowOffset = 0;
+      if (batch)
+        stmtImpl = await this._runWithLock(() => this._impl.prepare(sql));
+      while (batch) {
+        const [executeOutcome, readOutcome] = await Promise.allSettled([
+          this._runWithLock(() =>
+            stmtImpl.executeMany(batch.numIters, batch.binds, options)),
+          this._readExecuteManyBatch(iterator, batchSize, options.bindDefs)
+        ]);
+        if (executeOutcome.status === 'rejected')
+          throw executeOutcome.reason;
+        this._mergeExecuteManyResult(result,
+          this._transformExecuteManyResult(executeOutcome.value, options),
+          rowOffset);
+        if (readOutcome.status === 'rejected')
+          throw readOutcome.reason;
+        rowOffset += batch.numIters;
+        batch = readOutcome.value;
+      }
+      completed = true;
+    } finally {
+      if (!completed && typeof iterator.return === 'function')
+        await iterator.return();
+      if (stmtImpl)
+        await this._runWithLock(() => stmtImpl.close());
+    }
+
+    if (autoCommit && !result.batchErrors)
+      await this._runWithLock(() => this._impl.commit());
+    if (suspendOnSuccess)
+      await this._runWithLock(() =>
+        this._impl.suspendSessionlessTransaction());
+    return result;
+  }
+
   //---------------------------------------------------------------------------
   // externalName
   //
@@ -1416,6 +1828,27 @@ class Connection extends EventEmitter {
     return info;
   }
 
+  //---------------------------------------------------------------------------
+  // prepare()
+  //
+  // Prepares a SQL statement for repeated execution and returns a
+  // PreparedStatement object. The statement (and its bind buffers, where
+  // possible) is retained until the prepared statement is closed.
+  //---------------------------------------------------------------------------
+  async prepare(sql, bindDefs) {
+    errors.assertArgCount(arguments, 1, 2);
+    errors.assertParamValue(typeof sql === 'string', 1);
+    if (bindDefs !== undefined) {
+      errors.assertParamValue(nodbUtil.isObjectOrArray(bindDefs), 2);
+      await this._processExecuteManyBinds([], bindDefs);
+    }
+    errors.assert(this._impl, errors.ERR_INVALID_CONNECTION);
+    const stmt = new PreparedStatement();
+    stmt._impl = await this._impl.prepare(sql);
+    stmt._setup(this, bindDefs);
+    return stmt;
+  }
+
   //---------------------------------------------------------------------------
   // instanceName
   //
@@ -2044,6 +2477,110 @@ class Connection extends EventEmitter {
     }
   }
 
+  //---------------------------------------------------------------------------
+  // _runPipelineInSingleCall()
+  //
+  // Runs the pipeline without protocol-level pipelining by handing all of the
+  // operations to the implementation in a single call. The arguments of each
+  // operation are processed first and the results are transformed once all of
+  // the operations have been executed.
+  //---------------------------------------------------------------------------
+  async _runPipelineInSingleCall(resultsImpl, continueOnError) {
+    const savedCallTimeout = this.callTimeout;
+    try {
+
+      // For consistency with protocol-level pipelining, do not enforce
+      // call timeout while executing the pipeline
+      if (savedCallTimeout > 0)
+        this.callTimeout = 0;
+
+      // process the arguments of each of the operations; if an error occurs
+      // and continueOnError is not set, only the operations preceding the one
+      // in error are executed
+      const implOps = [];
+      let argsErr, firstErr;
+      for (const resultImpl of resultsImpl) {
+        const op = resultImpl.op;
+        let implOp = null;
+        try {
+          if (op.opType === 'commit') {
+            implOp = {commit: true};
+          } else if (op.opType === 'execute') {
+            implOp = await this._processExecuteArgs(op.statement,
+              op.parameters, op.options);
+          } else if (op.opType === 'executeMany') {
+            implOp = await this._processExecuteManyArgs(op.statement,
+              op.parameters, op.options);
+          } else if (['fetchOne', 'fetchMany', 'fetchAll'].includes(op.opType)) {
+            op.options.resultSet = true;
+            op.options.fetchTypeHandler =
+              this._createFetchTypeHandler(op.fetchLobs);
+            implOp = await this._processExecuteArgs(op.statement,
+              op.parameters, op.options);
+          } else {
+            errors.throwErr(errors.ERR_PIPELINE_OPERATION_NOT_SUPPORTED,
+              op.opType);
+          }
+        } catch (err) {
+          if (!continueOnError) {
+            argsErr = err;
+            break;
+          }
+          resultImpl.error = err;
+        }
+        implOps.push(implOp);
+      }
+
+      // execute all of the operations and then complete each one
+      const implResults = await this._impl.runPipeline(implOps,
+        continueOnError);
+      for (let i = 0; i < implResults.length; i++) {
+        const resultImpl = resultsImpl[i];
+        const implResult = implResults[i];
+        if (!implResult)
+          continue;
+        const op = resultImpl.op;
+        if (implResult.error) {
+          let err = errors.transformErr(implResult.error);
+          if (err.errorNum === 1406 && op.opType !== 'executeMany')
+            err = errors.getErr(errors.ERR_INSUFFICIENT_BUFFER_FOR_BINDS);
+          resultImpl.error = err;
+          if (!continueOnError && !firstErr)
+            firstErr = err;
+          continue;
+        }
+        const options = implOps[i].options;
+        const res = implResult.result;
+        try {
+          if (op.opType === 'commit') {
+            resultImpl.result = undefined;
+          } else if (op.opType === 'execute') {
+            await this._handleFetchForExecuteInPipeline(res, options);
+            resultImpl.result = res;
+          } else if (op.opType === 'executeMany') {
+            resultImpl.result = this._transformExecuteManyResult(res,
+              options);
+          } else {
+            resultImpl.result = await this._transformExecuteResult(res,
+              options, op);
+          }
+        } catch (err) {
+          if (!continueOnError && !firstErr)
+            firstErr = err;
+          resultImpl.error = err;
+        }
+      }
+      if (firstErr)
+        throw firstErr;
+      if (argsErr)
+        throw argsErr;
+      return this._buildPipelineResults(resultsImpl);
+    } finally {
+      if (savedCallTimeout > 0)
+        this.callTimeout = savedCallTimeout;
+    }
+  }
+
   _buildPipelineResults(resultsImpl) {
     const results = [];
     for (let i = 0; i < resultsImpl.length; i++) {
@@ -2080,7 +2617,7 @@ class Connection extends EventEmitter {
       return await this._impl.runPipelineWithPipelining(this, results,
         continueOnError);
     else
-      return await this._runPipelineWithoutPipelining(results,
+      return await this._impl.runPipelineWithoutPipelining(this, results,
         continueOnError);
   }
 
@@ -2180,6 +2717,7 @@ nodbUtil.wrapFns(Connection.prototype,
   "close",
   "commit",
   "createLob",
+  "createLobs",
   "directPathLoad",
   "execute",
   "executeMany",
@@ -2187,6 +2725,7 @@ nodbUtil.wrapFns(Connection.prototype,
   "getQueue",
   "getStatementInfo",
   "ping",
+  "prepare",
   "runPipeline",
   "resumeSessionlessTransaction",
   "rollback",
@@ -2202,6 +2741,11 @@ nodbUtil.wrapFns(Connection.prototype,
   "tpcRollback",
   "unsubscribe");
 
+// executeManyStream() acquires the connection lock for each operation it
+// performs instead of for its entire duration, since the source of rows may
+// use the same connection
+nodbUtil.wrapFns(Connection.prototype, false, "executeManyStream");
+
 // add alias for release()
 Connection.prototype.release = Connection.prototype.close;
 
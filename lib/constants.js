@@ -55,6 +55,36 @@ module.exports = {
   // default for maxSize for OUT and IN/OUT binds
   DEFAULT_MAX_SIZE_FOR_OUT_BINDS: 200,
 
+  // default number of rows executed in each batch by executeManyStream()
+  DEFAULT_EXECUTE_MANY_BATCH_SIZE: 10000,
+
+  // default number of documents inserted in each batch by
+  // sodaCollection.insertManyStream() and insertManyAndGetStream()
+  DEFAULT_SODA_INSERT_MANY_BATCH_SIZE: 1000,
+
+  // value of fetchArraySize which enables adaptive fetch array sizing and the
+  // fetch array size used until the columns being fetched are known
+  FETCH_ARRAY_SIZE_AUTO: 'auto',
+  DEFAULT_FETCH_ARRAY_SIZE: 100,
+
+  // limits used when the fetch array size is determined automatically; the
+  // first batch is sized to fit the initial budget and batches then grow (up
+  // to the maximum budget) while round trips complete quickly and shrink when
+  // they are slow
+  FETCH_ARRAY_SIZE_AUTO_MAX: 10000,
+  FETCH_ARRAY_SIZE_AUTO_INITIAL_BYTES: 65536,
+  FETCH_ARRAY_SIZE_AUTO_MAX_BYTES: 2097152,
+  FETCH_ARRAY_SIZE_AUTO_GROW_MS: 100,
+  FETCH_ARRAY_SIZE_AUTO_SHRINK_MS: 500,
+
+  // values of jsonFetchMode
+  JSON_FETCH_MODE_EAGER: 'eager',
+  JSON_FETCH_MODE_LAZY: 'lazy',
+
+  // values of vectorFetchMode
+  VECTOR_FETCH_MODE_SEPARATE: 'separate',
+  VECTOR_FETCH_MODE_MATRIX: 'matrix',
+
   // character set forms (internal use)
   CSFRM_IMPLICIT: 1,
   CSFRM_NCHAR: 2,
@@ -146,6 +176,16 @@ module.exports = {
   // outFormat values
   OUT_FORMAT_ARRAY: 4001,
   OUT_FORMAT_OBJECT: 4002,
+  OUT_FORMAT_COLUMNS: 4003,
+
+  // column array types used with OUT_FORMAT_COLUMNS (internal use)
+  COLUMN_ARRAY_TYPE_ARRAY: 0,
+  COLUMN_ARRAY_TYPE_FLOAT64: 1,
+  COLUMN_ARRAY_TYPE_INT32: 2,
+  COLUMN_ARRAY_TYPE_BIGINT64: 3,
+  COLUMN_ARRAY_TYPE_DATE: 4,
+  COLUMN_ARRAY_TYPE_BOOLEAN: 5,
+  COLUMN_ARRAY_TYPE_VECTOR: 6,
 
   // SODA collection creation modes
   SODA_COLL_MAP_MODE: 5001,
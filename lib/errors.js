@@ -199,6 +199,11 @@ const ERR_END_USER_SECURITY_CONTEXT_REQUIRES_TCPS = 190;
 const ERR_UNSUPPORTED_DEEP_DATA_SECURITY_FEATURE = 191;
 const ERR_CHAR_CS_NOT_SUPPORTED = 192;
 const ERR_INVALID_PROPERTY_LENGTH = 193;
+const ERR_NOT_SUPPORTED_WITH_COLUMNS = 194;
+const ERR_INVALID_PREPARED_STMT = 195;
+const ERR_BUSY_PREPARED_STMT = 196;
+const ERR_COLUMN_LENGTH_MISMATCH = 197;
+const ERR_COLUMN_VALUE_NOT_INTEGER = 198;
 
 // Oracle Net layer errors start from 500
 const ERR_CONNECTION_CLOSED = 500;
@@ -606,6 +611,16 @@ messages.set(ERR_CHAR_CS_NOT_SUPPORTED,                 // NJS-192
   'Character set id %d is not supported by node-oracledb in Thin mode');
 messages.set(ERR_INVALID_PROPERTY_LENGTH,               // NJS-193
   'The length of the parameter %s exceeds the maximum allowed length of %d');
+messages.set(ERR_NOT_SUPPORTED_WITH_COLUMNS,            // NJS-194
+  '%s is not supported when outFormat is oracledb.OUT_FORMAT_COLUMNS');
+messages.set(ERR_INVALID_PREPARED_STMT,                 // NJS-195
+  'invalid PreparedStatement');
+messages.set(ERR_BUSY_PREPARED_STMT,                    // NJS-196
+  'PreparedStatement is in use by another execution or an open ResultSet');
+messages.set(ERR_COLUMN_LENGTH_MISMATCH,                // NJS-197
+  'bind column "%s" contains %d values but %d values were expected');
+messages.set(ERR_COLUMN_VALUE_NOT_INTEGER,               // NJS-198
+  'value %d at position %d of bind column "%s" cannot be represented as a 64-bit integer');
 
 // Oracle Net layer errors
 
@@ -1127,6 +1142,11 @@ module.exports = {
   ERR_PIPELINE_EXEC_OPTION_NOT_SUPPORTED,
   ERR_INVALID_SQL_NAME,
   ERR_CHAR_CS_NOT_SUPPORTED,
+  ERR_NOT_SUPPORTED_WITH_COLUMNS,
+  ERR_INVALID_PREPARED_STMT,
+  ERR_BUSY_PREPARED_STMT,
+  ERR_COLUMN_LENGTH_MISMATCH,
+  ERR_COLUMN_VALUE_NOT_INTEGER,
   WRN_COMPILATION_CREATE,
   assert,
   assertArgCount,
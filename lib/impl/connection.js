@@ -202,6 +202,15 @@ class ConnectionImpl {
     errors.throwNotImplemented("creating a temporary LOB");
   }
 
+  //---------------------------------------------------------------------------
+  // createLobs()
+  //
+  // Creates a number of temporary LOBs and returns them in an array.
+  //---------------------------------------------------------------------------
+  createLobs() {
+    errors.throwNotImplemented("creating temporary LOBs");
+  }
+
   //---------------------------------------------------------------------------
   // execute()
   //
@@ -392,6 +401,24 @@ class ConnectionImpl {
     errors.throwNotImplemented("getting information about a statement");
   }
 
+  //---------------------------------------------------------------------------
+  // prepare()
+  //
+  // Prepares a statement for repeated execution.
+  //---------------------------------------------------------------------------
+  prepare() {
+    errors.throwNotImplemented("preparing a statement");
+  }
+
+  //---------------------------------------------------------------------------
+  // executePrepared()
+  //
+  // Executes a statement prepared by prepare().
+  //---------------------------------------------------------------------------
+  executePrepared() {
+    errors.throwNotImplemented("executing a prepared statement");
+  }
+
   //---------------------------------------------------------------------------
   // getStmtCacheSize()
   //
@@ -677,6 +704,27 @@ class ConnectionImpl {
     errors.throwNotImplemented("unsubscribing from events");
   }
 
+  //---------------------------------------------------------------------------
+  // runPipeline()
+  //
+  // Executes all of the operations of a pipeline and returns an array of
+  // results or errors, one for each operation.
+  //---------------------------------------------------------------------------
+  runPipeline() {
+    errors.throwNotImplemented("running a pipeline");
+  }
+
+  //---------------------------------------------------------------------------
+  // runPipelineWithoutPipelining()
+  //
+  // Runs the pipeline when protocol-level pipelining is not available. All of
+  // the operations are executed in a single call to runPipeline().
+  //---------------------------------------------------------------------------
+  async runPipelineWithoutPipelining(conn, resultsImpl, continueOnError) {
+    return await conn._runPipelineInSingleCall(resultsImpl, continueOnError);
+  }
+
+  //---------------------------------------------------------------------------
   // supportsPipelining()
   //
   // Returns true if pipelining is supported.
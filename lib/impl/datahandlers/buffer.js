@@ -32,6 +32,15 @@ const errors = require("../../errors.js");
 const types = require("../../types.js");
 const nodbUtil = require("../../util.js");
 
+// scratch space for the decimal digits of numbers being encoded; there is
+// room for a leading and trailing zero to be added to the maximum number of
+// digits
+const numberDigits = new Uint8Array(constants.NUMBER_MAX_DIGITS + 8);
+
+// numbers whose digits are scaled to integers no larger than this can be
+// scaled without error, which ensures that the shortest digits are found
+const NUMBER_MAX_SCALED_INTEGER = 2 ** 50;
+
 /**
  * Base buffer class used for managing buffered data without unnecessary
  * copying.
@@ -927,72 +936,52 @@ class BaseBuffer {
   }
 
   //---------------------------------------------------------------------------
-  // writeOracleNumber()
+  // _writeOracleNumberDigits()
   //
-  // Writes the number (in string form) in Oracle Number format to the buffer.
+  // Writes the decimal digits in the scratch space (from start up to, but not
+  // including, end) multiplied by 10 to the power of the exponent in Oracle
+  // Number format to the buffer. At least one slot must be available before
+  // and after the digits.
   //---------------------------------------------------------------------------
-  writeOracleNumber(value, writeLength = true) {
-
-    // determine if number is negative
-    let isNegative = false;
-    if (value[0] === '-') {
-      isNegative = true;
-      value = value.substring(1);
-    }
-
-    // parse the exponent, if one is present
-    let exponent = 0;
-    const exponentPos = value.indexOf('e');
-    if (exponentPos > 0) {
-      exponent = Number(value.substring(exponentPos + 1));
-      value = value.substring(0, exponentPos);
-    }
-
-    // adjust the exponent and the value if there is a decimal point
-    const decimalPos = value.indexOf('.');
-    if (decimalPos > 0) {
-      exponent -= (value.length - decimalPos - 1);
-      value = value.substring(0, decimalPos) + value.substring(decimalPos + 1);
-    }
-
-    // strip any leading zeroes
-    if (value[0] === '0') {
-      value = value.replace(/^0+/, "");
-    }
+  _writeOracleNumberDigits(start, end, exponent, isNegative, writeLength) {
+    const digits = numberDigits;
 
     // strip any trailing zeroes
-    if (value.length > 0 && value[value.length - 1] === '0') {
-      const trimmedValue = value.replace(/0+$/, "");
-      exponent += (value.length - trimmedValue.length);
-      value = trimmedValue;
+    while (end > start && digits[end - 1] === 0) {
+      end--;
+      exponent++;
+    }
+    if (end === start) {
+      exponent = 0;
+      isNegative = false;
     }
 
     // throw exception if number cannot be represented as an Oracle Number
-    if (value.length > constants.NUMBER_MAX_DIGITS || exponent >= 126 ||
+    if (end - start > constants.NUMBER_MAX_DIGITS || exponent >= 126 ||
         exponent <= -131) {
       errors.throwErr(errors.ERR_ORACLE_NUMBER_NO_REPR);
     }
 
     // if the exponent is odd, append a zero
-    if ((exponent > 0 && exponent % 2 === 1) ||
-        (exponent < 0 && exponent % 2 === -1)) {
+    if (exponent % 2 !== 0) {
       exponent--;
-      value += "0";
+      digits[end++] = 0;
     }
 
     // add a leading zero if the number of digits is odd
-    if (value.length % 2 === 1) {
-      value = "0" + value;
+    if ((end - start) % 2 === 1) {
+      digits[--start] = 0;
     }
 
     // write the encoded data to the wire
+    const numDigits = end - start;
     const appendSentinel =
-      (isNegative && value.length < constants.NUMBER_MAX_DIGITS);
-    const numPairs = value.length / 2;
-    let exponentOnWire = ((exponent + value.length) / 2) + 192;
+      (isNegative && numDigits < constants.NUMBER_MAX_DIGITS);
+    const numPairs = numDigits / 2;
+    let exponentOnWire = ((exponent + numDigits) / 2) + 192;
     if (isNegative) {
       exponentOnWire = (exponentOnWire ^ 0xFF);
-    } else if (value.length === 0 && exponent === 0) {
+    } else if (numDigits === 0) {
       exponentOnWire = 128;
     }
     let pos = this.reserveBytes(numPairs + 1 + writeLength + appendSentinel);
@@ -1001,8 +990,8 @@ class BaseBuffer {
       this.buf[pos++] = numPairs + 1 + appendSentinel;
     }
     this.buf[pos++] = exponentOnWire;
-    for (let i = 0; i < value.length; i += 2) {
-      const base100Digit = Number(value.substring(i, i + 2));
+    for (let i = start; i < end; i += 2) {
+      const base100Digit = digits[i] * 10 + digits[i + 1];
       if (isNegative) {
         this.buf[pos++] = 101 - base100Digit;
       } else {
@@ -1015,6 +1004,127 @@ class BaseBuffer {
 
   }
 
+  //---------------------------------------------------------------------------
+  // _writeOracleNumberFromInteger()
+  //
+  // Writes a non-negative safe integer multiplied by 10 to the power of the
+  // exponent in Oracle Number format to the buffer. The digits are generated
+  // arithmetically without creating a string.
+  //---------------------------------------------------------------------------
+  _writeOracleNumberFromInteger(value, exponent, isNegative, writeLength) {
+    const end = numberDigits.length - 2;
+    let start = end;
+    while (value > 0) {
+      const digit = value % 10;
+      numberDigits[--start] = digit;
+      value = (value - digit) / 10;
+    }
+    this._writeOracleNumberDigits(start, end, exponent, isNegative,
+      writeLength);
+  }
+
+  //---------------------------------------------------------------------------
+  // writeOracleNumber()
+  //
+  // Writes the number (a JavaScript number, a BigInt, or a number in string
+  // form) in Oracle Number format to the buffer. Numbers and BigInts are
+  // encoded directly whenever possible: integers have their digits generated
+  // arithmetically and other numbers are scaled by the smallest power of ten
+  // that yields an integer which converts back to the same number, which
+  // produces the same digits as the shortest round trip string would. Only
+  // numbers which need more than 15 significant digits (and very large
+  // BigInts) are converted to strings first.
+  //---------------------------------------------------------------------------
+  writeOracleNumber(value, writeLength = true) {
+
+    // handle numbers and BigInts without creating a string, if possible
+    if (typeof value === 'number') {
+      if (!Number.isFinite(value)) {
+        errors.throwErr(errors.ERR_ORACLE_NUMBER_NO_REPR);
+      }
+      const isNegative = (value < 0);
+      const absValue = Math.abs(value);
+      if (Number.isSafeInteger(absValue)) {
+        return this._writeOracleNumberFromInteger(absValue, 0, isNegative,
+          writeLength);
+      }
+      let scale = 1;
+      for (let exponent = -1; exponent >= -22; exponent--) {
+        scale *= 10;
+        const scaledValue = Math.round(absValue * scale);
+        if (scaledValue > NUMBER_MAX_SCALED_INTEGER)
+          break;
+        if (scaledValue / scale === absValue) {
+          return this._writeOracleNumberFromInteger(scaledValue, exponent,
+            isNegative, writeLength);
+        }
+      }
+      value = value.toString();
+    } else if (typeof value === 'bigint') {
+      if (value >= -Number.MAX_SAFE_INTEGER &&
+          value <= Number.MAX_SAFE_INTEGER) {
+        const numValue = Number(value);
+        return this._writeOracleNumberFromInteger(Math.abs(numValue), 0,
+          numValue < 0, writeLength);
+      }
+      value = value.toString();
+    } else if (typeof value !== 'string') {
+      value = value.toString();
+    }
+
+    // determine if number is negative
+    let isNegative = false;
+    let pos = 0;
+    if (value.charCodeAt(0) === 45) {           // minus sign
+      isNegative = true;
+      pos++;
+    }
+
+    // parse the exponent, if one is present
+    let exponent = 0;
+    let length = value.length;
+    const exponentPos = value.indexOf('e');
+    if (exponentPos > 0) {
+      exponent = Number(value.substring(exponentPos + 1));
+      length = exponentPos;
+    }
+
+    // transfer the digits to the scratch space, skipping leading zeroes and
+    // adjusting the exponent for any digits after the decimal point; once the
+    // maximum number of digits has been reached, only trailing zeroes are
+    // acceptable
+    const start = 1;
+    let end = start;
+    let seenDecimalPoint = false;
+    for (; pos < length; pos++) {
+      const c = value.charCodeAt(pos);
+      if (c === 46 && !seenDecimalPoint) {    // decimal point
+        seenDecimalPoint = true;
+        continue;
+      }
+      const digit = c - 48;
+      if (digit < 0 || digit > 9) {
+        errors.throwErr(errors.ERR_ORACLE_NUMBER_NO_REPR);
+      }
+      if (seenDecimalPoint) {
+        exponent--;
+      }
+      if (end === start && digit === 0) {
+        continue;
+      } else if (end - start === constants.NUMBER_MAX_DIGITS) {
+        if (digit !== 0) {
+          errors.throwErr(errors.ERR_ORACLE_NUMBER_NO_REPR);
+        }
+        exponent++;
+        continue;
+      }
+      numberDigits[end++] = digit;
+    }
+
+    this._writeOracleNumberDigits(start, end, exponent, isNegative,
+      writeLength);
+  }
+
   //---------------------------------------------------------------------------
   // writeStr()
   //
@@ -96,6 +96,7 @@ module.exports = {
   TNS_HAS_REGION_ID: 0x80,
   NUMBER_MAX_DIGITS: 40,
   BUFFER_CHUNK_SIZE: 65536,
+  OSON_MAX_CACHED_FIELD_NAMES: 65536,
   CSFRM_IMPLICIT: constants.CSFRM_IMPLICIT,
 
   // vector generic constants
@@ -35,6 +35,66 @@ const util = require("util");
 const vector = require("./vector.js");
 const nodbUtil = require("../../util.js");
 
+/**
+ * Class used for caching the field names decoded from OSON. Documents fetched
+ * from the same table usually share a small set of field names so each name
+ * is only decoded into a string once instead of once per document. Names are
+ * stored in a fixed size table indexed by a hash of the bytes of the name.
+ */
+class OsonFieldNameCache {
+
+  constructor(size, maxNameLength) {
+    this.size = size;
+    this.maxNameLength = maxNameLength;
+    this.entries = new Array(size);
+  }
+
+  //---------------------------------------------------------------------------
+  // getName()
+  //
+  // Returns the field name stored in the buffer at the given position and
+  // with the given length, using the cached string if one is available.
+  //---------------------------------------------------------------------------
+  getName(buf, pos, length) {
+
+    // long names are not cached
+    if (length > this.maxNameLength) {
+      return buf.toString('utf8', pos, pos + length);
+    }
+
+    // calculate the hash of the name (FNV-1a) to determine the entry to use
+    let hash = 0x811c9dc5;
+    for (let i = pos; i < pos + length; i++) {
+      hash = Math.imul(hash ^ buf[i], 0x01000193);
+    }
+    hash >>>= 0;
+    const index = hash % this.size;
+
+    // if the entry matches the name, use the cached string
+    let entry = this.entries[index];
+    if (entry && entry.hash === hash && entry.bytes.length === length) {
+      let matches = true;
+      for (let i = 0; i < length; i++) {
+        if (entry.bytes[i] !== buf[pos + i]) {
+          matches = false;
+          break;
+        }
+      }
+      if (matches) {
+        return entry.name;
+      }
+    }
+
+    // otherwise, decode the name and replace the entry
+    const bytes = Buffer.from(buf.subarray(pos, pos + length));
+    entry = this.entries[index] = { hash, bytes, name: bytes.toString() };
+    return entry.name;
+  }
+
+}
+
+const fieldNameCache = new OsonFieldNameCache(256, 64);
+
 /**
  * Class used for decoding
  */
@@ -266,7 +326,8 @@ class OsonDecoder extends BaseBuffer {
         // Long Field Name
         temp = ptr.readUInt16BE(offset);
       }
-      this.fieldNames[i] = ptr.subarray(offset + fieldNamesSize, offset + temp + fieldNamesSize).toString();
+      this.fieldNames[i] = fieldNameCache.getName(ptr,
+        offset + fieldNamesSize, temp);
     }
     this.pos = finalPos;
   }
@@ -375,6 +436,371 @@ class OsonDecoder extends BaseBuffer {
 
 }
 
+/**
+ * Class used as the handler of the read-only Proxy returned for each object
+ * or array when OSON is decoded lazily. Children are only decoded when they
+ * are accessed and are retained so that subsequent accesses return the same
+ * value.
+ */
+class OsonLazyContainer {
+
+  constructor(decoder, nodePos, nodeType, numChildren, fieldIdsPos,
+    offsetsPos) {
+    this.decoder = decoder;
+    this.nodePos = nodePos;
+    this.nodeType = nodeType;
+    this.numChildren = numChildren;
+    this.isObject = ((nodeType & 0x40) === 0);
+    this.fieldIdsPos = fieldIdsPos;
+    this.offsetsPos = offsetsPos;
+    this.values = new Array(numChildren);
+    this.toJSON = () => this.decoder._decodeFull(this.nodePos);
+    const target = (this.isObject) ? {} : new Array(numChildren);
+    Object.defineProperty(target, util.inspect.custom, {
+      value: (depth, options, inspect) => inspect(this.toJSON(), options),
+      configurable: true
+    });
+    this.proxy = new Proxy(target, this);
+  }
+
+  //---------------------------------------------------------------------------
+  // _getIndex()
+  //
+  // Returns the index of the child identified by the given property name, or
+  // -1 if the container has no such child.
+  //---------------------------------------------------------------------------
+  _getIndex(prop) {
+    if (this.isObject) {
+      const fieldId = this.decoder._getFieldId(prop);
+      if (fieldId > 0) {
+        const buf = this.decoder.buf;
+        const fieldIdLength = this.decoder.fieldIdLength;
+        let pos = this.fieldIdsPos;
+        for (let i = 0; i < this.numChildren; i++) {
+          let childFieldId;
+          if (fieldIdLength === 1) {
+            childFieldId = buf[pos];
+          } else if (fieldIdLength === 2) {
+            childFieldId = buf.readUInt16BE(pos);
+          } else {
+            childFieldId = buf.readUInt32BE(pos);
+          }
+          if (childFieldId === fieldId)
+            return i;
+          pos += fieldIdLength;
+        }
+      }
+    } else {
+      const index = Number(prop);
+      if (Number.isInteger(index) && index >= 0 &&
+          index < this.numChildren && String(index) === prop) {
+        return index;
+      }
+    }
+    return -1;
+  }
+
+  //---------------------------------------------------------------------------
+  // _getKey()
+  //
+  // Returns the property name of the child at the given index.
+  //---------------------------------------------------------------------------
+  _getKey(index) {
+    if (!this.isObject)
+      return String(index);
+    const buf = this.decoder.buf;
+    const fieldIdLength = this.decoder.fieldIdLength;
+    const pos = this.fieldIdsPos + index * fieldIdLength;
+    let fieldId;
+    if (fieldIdLength === 1) {
+      fieldId = buf[pos];
+    } else if (fieldIdLength === 2) {
+      fieldId = buf.readUInt16BE(pos);
+    } else {
+      fieldId = buf.readUInt32BE(pos);
+    }
+    return this.decoder._getFieldName(fieldId);
+  }
+
+  //---------------------------------------------------------------------------
+  // _getValue()
+  //
+  // Returns the value of the child at the given index, decoding it if it has
+  // not been accessed before.
+  //---------------------------------------------------------------------------
+  _getValue(index) {
+    let value = this.values[index];
+    if (value === undefined) {
+      const decoder = this.decoder;
+      decoder.pos = this.offsetsPos;
+      if (this.nodeType & 0x20) {
+        decoder.pos += index * 4;
+      } else {
+        decoder.pos += index * 2;
+      }
+      let offset = decoder._getOffset(this.nodeType);
+      if (decoder.relativeOffsets) {
+        offset += this.nodePos - decoder.treeSegPos;
+      }
+      decoder.pos = decoder.treeSegPos + offset;
+      value = this.values[index] = decoder._decodeNode();
+    }
+    return value;
+  }
+
+  //---------------------------------------------------------------------------
+  // Proxy traps. Values are read from the OSON image; attempts to modify the
+  // container are rejected. Fields stored in the document take precedence
+  // over the toJSON() method which is only returned if the document has no
+  // field of that name.
+  //---------------------------------------------------------------------------
+  get(target, prop, receiver) {
+    if (typeof prop === 'string') {
+      if (!this.isObject && prop === 'length')
+        return this.numChildren;
+      const index = this._getIndex(prop);
+      if (index >= 0)
+        return this._getValue(index);
+      if (prop === 'toJSON')
+        return this.toJSON;
+    }
+    return Reflect.get(target, prop, receiver);
+  }
+
+  getOwnPropertyDescriptor(target, prop) {
+    if (typeof prop === 'string') {
+      const index = this._getIndex(prop);
+      if (index >= 0) {
+        return {
+          value: this._getValue(index),
+          writable: false,
+          enumerable: true,
+          configurable: true
+        };
+      }
+    }
+    return Reflect.getOwnPropertyDescriptor(target, prop);
+  }
+
+  has(target, prop) {
+    if (typeof prop === 'string' && this._getIndex(prop) >= 0)
+      return true;
+    return Reflect.has(target, prop);
+  }
+
+  ownKeys() {
+    const keys = new Array(this.numChildren);
+    for (let i = 0; i < this.numChildren; i++) {
+      keys[i] = this._getKey(i);
+    }
+    if (!this.isObject)
+      keys.push('length');
+    return keys;
+  }
+
+  defineProperty() {
+    return false;
+  }
+
+  deleteProperty() {
+    return false;
+  }
+
+  preventExtensions() {
+    return false;
+  }
+
+  set() {
+    return false;
+  }
+
+  setPrototypeOf() {
+    return false;
+  }
+
+}
+
+/**
+ * Class used for decoding OSON lazily. Objects and arrays are returned as
+ * read-only views over the OSON image and only the values that are accessed
+ * are decoded. Field names are located using the hash ids stored in the
+ * field names segments, so names that are not accessed are never decoded.
+ */
+class OsonLazyDecoder extends OsonDecoder {
+
+  constructor(buf) {
+    super(buf);
+    this.fieldNameSegs = [];
+    this.fieldIds = new Map();
+    this.eager = false;
+  }
+
+  //---------------------------------------------------------------------------
+  // _decodeContainerNode()
+  //
+  // Returns a view over the container node (object or array) unless the
+  // container is being fully decoded.
+  //---------------------------------------------------------------------------
+  _decodeContainerNode(nodeType) {
+    if (this.eager)
+      return super._decodeContainerNode(nodeType);
+    const nodePos = this.pos - 1;
+    let numChildren = this._getNumChildren(nodeType);
+    let offsetsPos, fieldIdsPos;
+    if (numChildren === undefined) {
+      const offset = this._getOffset(nodeType);
+      offsetsPos = this.pos;
+      this.pos = this.treeSegPos + offset;
+      numChildren = this._getNumChildren(this.readUInt8());
+      fieldIdsPos = this.pos;
+    } else if ((nodeType & 0x40) === 0) {
+      fieldIdsPos = this.pos;
+      offsetsPos = this.pos + this.fieldIdLength * numChildren;
+    } else {
+      offsetsPos = this.pos;
+    }
+    const container = new OsonLazyContainer(this, nodePos, nodeType,
+      numChildren, fieldIdsPos, offsetsPos);
+    return container.proxy;
+  }
+
+  //---------------------------------------------------------------------------
+  // _decodeFull()
+  //
+  // Fully decodes the node found at the given position in the buffer and
+  // returns the JavaScript equivalent.
+  //---------------------------------------------------------------------------
+  _decodeFull(nodePos) {
+    for (let i = 0; i < this.fieldNames.length; i++) {
+      this._getFieldName(i + 1);
+    }
+    this.eager = true;
+    this.pos = nodePos;
+    try {
+      return this._decodeNode();
+    } finally {
+      this.eager = false;
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // _getFieldId()
+  //
+  // Returns the id of the field with the given name, or 0 if no field with
+  // that name exists in the OSON image. The field names in each segment are
+  // sorted by hash id so a binary search of the hash ids is performed and
+  // only names with a matching hash id are compared.
+  //---------------------------------------------------------------------------
+  _getFieldId(name) {
+    let fieldId = this.fieldIds.get(name);
+    if (fieldId !== undefined)
+      return fieldId;
+    fieldId = 0;
+    const nameBytes = Buffer.from(name);
+    const nameLengthSize = (nameBytes.length <= 255) ? 1 : 2;
+    const seg = this.fieldNameSegs.find(s => s.nameLengthSize === nameLengthSize);
+    if (seg) {
+      let hashId = 0x811C9DC5;
+      for (let i = 0; i < nameBytes.length; i++) {
+        hashId = Math.imul(hashId ^ nameBytes[i], 16777619);
+      }
+      hashId &= 0xff;
+      let low = 0, high = seg.numFields;
+      while (low < high) {
+        const mid = (low + high) >>> 1;
+        if (this._getHashId(seg, mid) < hashId) {
+          low = mid + 1;
+        } else {
+          high = mid;
+        }
+      }
+      for (let i = low; i < seg.numFields; i++) {
+        if (this._getHashId(seg, i) !== hashId)
+          break;
+        const [pos, length] = this._getFieldNamePos(seg, i);
+        if (length === nameBytes.length &&
+            this.buf.subarray(pos, pos + length).equals(nameBytes)) {
+          fieldId = seg.firstFieldId + i + 1;
+          break;
+        }
+      }
+    }
+    this.fieldIds.set(name, fieldId);
+    return fieldId;
+  }
+
+  //---------------------------------------------------------------------------
+  // _getFieldName()
+  //
+  // Returns the name of the field with the given id, decoding it if needed.
+  //---------------------------------------------------------------------------
+  _getFieldName(fieldId) {
+    let name = this.fieldNames[fieldId - 1];
+    if (name === undefined) {
+      const seg = (fieldId > this.fieldNameSegs[0].numFields) ?
+        this.fieldNameSegs[1] : this.fieldNameSegs[0];
+      const [pos, length] = this._getFieldNamePos(seg,
+        fieldId - seg.firstFieldId - 1);
+      name = this.fieldNames[fieldId - 1] =
+        fieldNameCache.getName(this.buf, pos, length);
+    }
+    return name;
+  }
+
+  //---------------------------------------------------------------------------
+  // _getFieldNamePos()
+  //
+  // Returns the position and length of the name at the given index in the
+  // field names segment.
+  //---------------------------------------------------------------------------
+  _getFieldNamePos(seg, index) {
+    let offset;
+    if (seg.offsetsSize === 2) {
+      offset = this.buf.readUInt16BE(seg.offsetsPos + index * 2);
+    } else {
+      offset = this.buf.readUInt32BE(seg.offsetsPos + index * 4);
+    }
+    const pos = seg.namesPos + offset;
+    if (seg.nameLengthSize === 1)
+      return [pos + 1, this.buf[pos]];
+    return [pos + 2, this.buf.readUInt16BE(pos)];
+  }
+
+  //---------------------------------------------------------------------------
+  // _getFieldNames()
+  //
+  // Records the location of the field names segment so that names can be
+  // looked up when they are accessed.
+  //---------------------------------------------------------------------------
+  _getFieldNames(arrStartPos, numFields, offsetsSize, fieldNamesSegSize,
+    fieldNamesSize) {
+    const seg = {
+      firstFieldId: arrStartPos,
+      numFields: numFields,
+      nameLengthSize: fieldNamesSize,
+      hashPos: this.pos,
+      offsetsSize: offsetsSize,
+      offsetsPos: this.pos + numFields * fieldNamesSize
+    };
+    seg.namesPos = seg.offsetsPos + numFields * offsetsSize;
+    this.fieldNameSegs.push(seg);
+    this.pos = seg.namesPos + fieldNamesSegSize;
+  }
+
+  //---------------------------------------------------------------------------
+  // _getHashId()
+  //
+  // Returns the hash id of the name at the given index in the field names
+  // segment.
+  //---------------------------------------------------------------------------
+  _getHashId(seg, index) {
+    if (seg.nameLengthSize === 1)
+      return this.buf[seg.hashPos + index];
+    return this.buf.readUInt16BE(seg.hashPos + index * 2);
+  }
+
+}
+
 class OsonFieldName {
 
   constructor(name, maxFieldNameSize) {
@@ -384,17 +810,16 @@ class OsonFieldName {
       errors.throwErr(errors.ERR_OSON_FIELD_NAME_LIMITATION, maxFieldNameSize);
     }
 
-    // BigInt constants for calculating Hash ID for the OSON Field Name
-    const INITIAL_HASHID = 0x811C9DC5n;
-    const HASH_MULTIPLIER = 16777619n;
-    const HASH_MASK = 0xffffffffn;
-
-    this.hashId = INITIAL_HASHID;
+    // calculate the Hash ID (FNV-1a) for the OSON Field Name; Math.imul()
+    // performs the 32-bit multiplication without requiring BigInt
+    let hashId = 0x811C9DC5;
     for (let i = 0; i < this.nameBytes.length; i++) {
-      const c = BigInt(this.nameBytes[i]);
-      this.hashId = ((this.hashId ^ c) * HASH_MULTIPLIER) & HASH_MASK;
+      hashId = Math.imul(hashId ^ this.nameBytes[i], 16777619);
     }
-    this.hashId = Number(this.hashId) & 0xff;
+    this.hashId = hashId & 0xff;
+
+    // number of the value in which the name was last seen by the encoder
+    this.valueNum = 0;
   }
 
 }
@@ -406,6 +831,16 @@ class OsonFieldNamesSegment extends GrowableBuffer {
     this.fieldNames = [];
   }
 
+  //---------------------------------------------------------------------------
+  // reset()
+  //
+  // Resets the segment so that it can be populated with a new set of names.
+  //---------------------------------------------------------------------------
+  reset() {
+    this.pos = 0;
+    this.fieldNames.length = 0;
+  }
+
   //---------------------------------------------------------------------------
   // addName()
   //
@@ -513,7 +948,7 @@ class OsonTreeSegment extends GrowableBuffer {
     this.reserveBytes(finalOffset - this.pos);
 
     for (let i = 0; i < value.fields.length; i++) {
-      const fieldName = encoder.fieldNamesMap.get(value.fields[i]);
+      const fieldName = encoder.fieldNamesCache.get(value.fields[i]);
       if (encoder.fieldIdSize == 1) {
         this.buf[fieldIdOffset] = fieldName.fieldId;
       } else if (encoder.fieldIdSize == 2) {
@@ -554,7 +989,7 @@ class OsonTreeSegment extends GrowableBuffer {
         this.writeBinaryDouble(value);
       } else {
         this.writeUInt8(constants.TNS_JSON_TYPE_NUMBER_LENGTH_UINT8);
-        this.writeOracleNumber(value.toString());
+        this.writeOracleNumber(value);
       }
 
     // handle strings
@@ -631,26 +1066,62 @@ class OsonTreeSegment extends GrowableBuffer {
 }
 
 /**
- * Class used for encoding
+ * Class used for encoding. An encoder may be used to encode many values; the
+ * field names, field name segments and tree segment are retained between
+ * calls to encode() so that values with the same structure (such as the rows
+ * of an executeMany() batch) avoid repeating that work.
  */
 
 class OsonEncoder extends GrowableBuffer {
 
+  constructor() {
+    super();
+    this.fieldNamesCache = new Map();
+    this.shortFieldNamesSeg = new OsonFieldNamesSegment();
+    this.longFieldNamesSeg = null;
+    this.treeSeg = new OsonTreeSegment();
+    this.fieldNames = [];
+    this.valueNum = 0;
+    this.numReusedFieldNames = 0;
+    this.prevNumFieldNames = 0;
+  }
+
   //---------------------------------------------------------------------------
   // _addFieldName()
   //
-  // Add a field with the given name.
+  // Add a field with the given name. The field name object is cached so that
+  // the name is only converted to bytes and hashed once per encoder.
   //---------------------------------------------------------------------------
   _addFieldName(name) {
-    const fieldName = new OsonFieldName(name, this.maxFieldNameSize);
-    this.fieldNamesMap.set(name, fieldName);
-    if (fieldName.nameBytes.length <= 255) {
-      this.shortFieldNamesSeg.addName(fieldName);
-    } else {
-      if (!this.longFieldNamesSeg) {
-        this.longFieldNamesSeg = new OsonFieldNamesSegment();
+    let fieldName = this.fieldNamesCache.get(name);
+    if (!fieldName) {
+      fieldName = new OsonFieldName(name, this.maxFieldNameSize);
+      this.fieldNamesCache.set(name, fieldName);
+    } else if (fieldName.valueNum === this.valueNum - 1) {
+      this.numReusedFieldNames++;
+    }
+    fieldName.valueNum = this.valueNum;
+    this.fieldNames.push(fieldName);
+  }
+
+  //---------------------------------------------------------------------------
+  // _buildFieldNamesSegs()
+  //
+  // Populates the short and long field names segments with the names found in
+  // the value currently being encoded.
+  //---------------------------------------------------------------------------
+  _buildFieldNamesSegs() {
+    this.shortFieldNamesSeg.reset();
+    this.longFieldNamesSeg = null;
+    for (const fieldName of this.fieldNames) {
+      if (fieldName.nameBytes.length <= 255) {
+        this.shortFieldNamesSeg.addName(fieldName);
+      } else {
+        if (!this.longFieldNamesSeg) {
+          this.longFieldNamesSeg = new OsonFieldNamesSegment();
+        }
+        this.longFieldNamesSeg.addName(fieldName);
       }
-      this.longFieldNamesSeg.addName(fieldName);
     }
   }
 
@@ -670,7 +1141,8 @@ class OsonEncoder extends GrowableBuffer {
       for (let i = 0; i < value.fields.length; i++) {
         const name = value.fields[i];
         const element = value.values[i];
-        if (!this.fieldNamesMap.has(name)) {
+        const fieldName = this.fieldNamesCache.get(name);
+        if (!fieldName || fieldName.valueNum !== this.valueNum) {
           this._addFieldName(name);
         }
         this._examineNode(element);
@@ -748,34 +1220,53 @@ class OsonEncoder extends GrowableBuffer {
   // encode()
   //
   // Encodes the value as OSON and returns a buffer containing the OSON bytes.
+  // The buffer is only valid until the next call to encode().
   //---------------------------------------------------------------------------
   encode(value, maxFieldNameSize) {
 
-    this.maxFieldNameSize = maxFieldNameSize;
+    // names that were validated against a different maximum size cannot be
+    // reused; the cache is also discarded if it has grown too large, which
+    // can occur when values use generated field names
+    if (maxFieldNameSize !== this.maxFieldNameSize ||
+        this.fieldNamesCache.size > constants.OSON_MAX_CACHED_FIELD_NAMES) {
+      this.fieldNamesCache.clear();
+      this.prevNumFieldNames = 0;
+      this.maxFieldNameSize = maxFieldNameSize;
+    }
+    this.pos = 0;
 
     // determine the flags to use
     let flags = constants.TNS_JSON_FLAG_INLINE_LEAF;
-    if (Array.isArray(value) || (value && Array.isArray(value.fields))) {
+    const isScalar = !Array.isArray(value) &&
+      !(value && Array.isArray(value.fields));
+    if (!isScalar) {
       // examine all values recursively to determine the unique set of field
-      // names and whether they need to be added to the long field names
-      // segment (> 255 bytes) or short field names segment (<= 255 bytes)
-      this.fieldNamesMap = new Map();
-      this.shortFieldNamesSeg = new OsonFieldNamesSegment();
+      // names; if this is the same set of names as the previous value, the
+      // field names segments built for that value are used as is
+      this.valueNum++;
+      this.fieldNames.length = 0;
+      this.numReusedFieldNames = 0;
       this._examineNode(value);
-
-      // perform processing of field names segments and determine the total
-      // number of unique field names in the value
-      let totalNumFieldNames = 0;
-      if (this.shortFieldNamesSeg) {
+      const numFieldNames = this.fieldNames.length;
+      const sameNames = numFieldNames === this.prevNumFieldNames &&
+        this.numReusedFieldNames === numFieldNames;
+      this.prevNumFieldNames = numFieldNames;
+      if (!sameNames) {
+
+        // determine whether the names need to be added to the long field
+        // names segment (> 255 bytes) or short field names segment (<= 255
+        // bytes) and then perform processing of the field names segments
+        this._buildFieldNamesSegs();
         this.shortFieldNamesSeg._processFieldNames(0);
-        totalNumFieldNames += this.shortFieldNamesSeg.fieldNames.length;
-      }
-      if (this.longFieldNamesSeg) {
-        this.longFieldNamesSeg._processFieldNames(totalNumFieldNames);
-        totalNumFieldNames += this.longFieldNamesSeg.fieldNames.length;
+        if (this.longFieldNamesSeg) {
+          this.longFieldNamesSeg._processFieldNames(
+            this.shortFieldNamesSeg.fieldNames.length);
+        }
+
       }
 
       // determine remaining flags and field id size
+      const totalNumFieldNames = numFieldNames;
       flags |= constants.TNS_JSON_FLAG_HASH_ID_UINT8 |
         constants.TNS_JSON_FLAG_TINY_NODES_STAT;
       if (totalNumFieldNames > 65535) {
@@ -796,7 +1287,8 @@ class OsonEncoder extends GrowableBuffer {
     }
 
     // encode values into the OSON tree segment
-    const treeSeg = new OsonTreeSegment();
+    const treeSeg = this.treeSeg;
+    treeSeg.pos = 0;
     treeSeg.encodeNode(value, this);
     if (treeSeg.pos > 65535) {
       flags |= constants.TNS_JSON_FLAG_TREE_SEG_UINT32;
@@ -806,7 +1298,7 @@ class OsonEncoder extends GrowableBuffer {
     this.writeUInt8(constants.TNS_JSON_MAGIC_BYTE_1);
     this.writeUInt8(constants.TNS_JSON_MAGIC_BYTE_2);
     this.writeUInt8(constants.TNS_JSON_MAGIC_BYTE_3);
-    if (this.longFieldNamesSeg) {
+    if (!isScalar && this.longFieldNamesSeg) {
       this.writeUInt8(constants.TNS_JSON_VERSION_MAX_FNAME_65535);
     } else {
       this.writeUInt8(constants.TNS_JSON_VERSION_MAX_FNAME_255);
@@ -814,7 +1306,7 @@ class OsonEncoder extends GrowableBuffer {
     this.writeUInt16BE(flags);
 
     // write extended header (when value is not scalar)
-    if (this.shortFieldNamesSeg) {
+    if (!isScalar) {
       this._writeExtendedHeader();
     }
 
@@ -826,7 +1318,7 @@ class OsonEncoder extends GrowableBuffer {
     }
 
     // write remainder of header and any data (when value is not scalar)
-    if (this.shortFieldNamesSeg) {
+    if (!isScalar) {
 
       // write number of "tiny" nodes (always zero)
       this.writeUInt16BE(0);
@@ -848,5 +1340,6 @@ class OsonEncoder extends GrowableBuffer {
 
 module.exports = {
   OsonDecoder,
+  OsonLazyDecoder,
   OsonEncoder
 };
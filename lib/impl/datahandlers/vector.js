@@ -32,6 +32,72 @@ const constants = require("./constants.js");
 const errors = require("../../errors.js");
 const types = require("../../types.js");
 
+/**
+ * Class used for allocating the typed arrays of decoded vectors from a shared
+ * ArrayBuffer. Each buffer is sized to hold the expected number of vectors so
+ * that a batch of rows with vectors of the same size shares a single buffer,
+ * with each vector following the previous one. If more vectors than expected
+ * are decoded, each new buffer holds at least as many vectors as have been
+ * allocated so far. The indices of sparse vectors are allocated from a
+ * separate slab.
+ */
+class VectorSlab {
+
+  constructor(numVectors) {
+    this.reset(numVectors);
+  }
+
+  //---------------------------------------------------------------------------
+  // alloc()
+  //
+  // Returns a typed array of the given type and number of elements which is a
+  // view of the current buffer. A new buffer is allocated if the current one
+  // has insufficient space.
+  //---------------------------------------------------------------------------
+  alloc(arrayType, numElements) {
+    const elementSize = arrayType.BYTES_PER_ELEMENT;
+    const numBytes = numElements * elementSize;
+    let offset = Math.ceil(this.offset / elementSize) * elementSize;
+    if (!this.buffer || offset + numBytes > this.buffer.byteLength) {
+      const numVectors = Math.max(this.numVectors - this.numAllocated,
+        this.numAllocated, 1);
+      this.buffer = new ArrayBuffer(numBytes * numVectors);
+      offset = 0;
+    }
+    this.offset = offset + numBytes;
+    this.numAllocated++;
+    return new arrayType(this.buffer, offset, numElements);
+  }
+
+  //---------------------------------------------------------------------------
+  // allocIndices()
+  //
+  // Returns a Uint32Array for the indices of a sparse vector.
+  //---------------------------------------------------------------------------
+  allocIndices(numElements) {
+    if (!this.indicesSlab) {
+      this.indicesSlab = new VectorSlab(this.numVectors);
+    }
+    return this.indicesSlab.alloc(Uint32Array, numElements);
+  }
+
+  //---------------------------------------------------------------------------
+  // reset()
+  //
+  // Prepares the slab for a new batch containing the given number of vectors.
+  // The current buffer is released; it remains in use by any typed arrays
+  // that were allocated from it.
+  //---------------------------------------------------------------------------
+  reset(numVectors) {
+    this.numVectors = numVectors;
+    this.numAllocated = 0;
+    this.buffer = null;
+    this.offset = 0;
+    this.indicesSlab = null;
+  }
+
+}
+
 /**
  * Class used for decoding
  */
@@ -56,9 +122,10 @@ class VectorDecoder extends BaseBuffer {
   // decode()
   //
   // Decodes the VECTOR image and returns a JavaScript array corresponding to
-  // its contents.
+  // its contents. If a slab is supplied, the typed arrays are allocated from
+  // it instead of each having its own ArrayBuffer.
   //---------------------------------------------------------------------------
-  decode() {
+  decode(slab) {
 
     // parse header
     const magicByte = this.readUInt8();
@@ -85,7 +152,8 @@ class VectorDecoder extends BaseBuffer {
       sparseValue.numDimensions = numElements; // vector dimensions.
       numElements = this.readUInt16BE(); // actual elements.
       this._verifyVectorDataSize(numElements, 4);
-      sparseValue.indices = new Uint32Array(numElements);
+      sparseValue.indices = (slab) ? slab.allocIndices(numElements) :
+        new Uint32Array(numElements);
       for (let i = 0; i < numElements; i++) {
         sparseValue.indices[i] = this.readUInt32BE();
       }
@@ -111,7 +179,8 @@ class VectorDecoder extends BaseBuffer {
       errors.throwErr(errors.ERR_VECTOR_FORMAT_NOT_SUPPORTED, vectorFormat);
     }
     this._verifyVectorDataSize(numElements, elementSize);
-    const value = new arrayType(numElements);
+    const value = (slab) ? slab.alloc(arrayType, numElements) :
+      new arrayType(numElements);
 
     if (sparseFormat) {
       sparseValue.values = value;
@@ -139,29 +208,25 @@ class VectorDecoder extends BaseBuffer {
 class VectorEncoder extends GrowableBuffer {
 
   // Writes Header from value.
-  // It returns function to serialize the value.
-  // sparseVal is provided for SparseVector.
-  _updateVectorHeader(value, sparseVal) {
+  // It returns the vector format which determines how the elements are
+  // serialized. sparseVal is provided for SparseVector. numElements is
+  // provided when only part of the value is being encoded.
+  _updateVectorHeader(value, sparseVal, numElements = value.length) {
     let flags = constants.TNS_VECTOR_FLAG_NORMSRC
     | constants.TNS_VECTOR_FLAG_NORM; // NORM is present and reserve space.
-    let numElements = value.length;
     let vectorVersion = constants.TNS_VECTOR_VERSION_BASE;
     let vectorFormat = constants.VECTOR_FORMAT_FLOAT32;
-    let writeFn = this.writeBinaryFloat.bind(this);
 
     if (Array.isArray(value) || value instanceof Float64Array) {
       vectorFormat = constants.VECTOR_FORMAT_FLOAT64;
-      writeFn = this.writeBinaryDouble.bind(this);
     } else if (value instanceof Int8Array) {
       vectorFormat = constants.VECTOR_FORMAT_INT8;
-      writeFn = this.writeSB1.bind(this);
     } else if (value.constructor.name === 'Uint8Array') {
       vectorFormat = constants.VECTOR_FORMAT_BINARY;
       // The number of dimensions are assumed to be multiple of 8.
       numElements = numElements * 8;
       vectorVersion = constants.TNS_VECTOR_VERSION_WITH_BINARY;
       flags = constants.TNS_VECTOR_FLAG_NORMSRC; // only space is reserved.
-      writeFn = this.writeUInt8.bind(this);
     }
     if (sparseVal && sparseVal instanceof types.SparseVector) {
       vectorVersion = constants.TNS_VECTOR_VERSION_WITH_SPARSE;
@@ -176,19 +241,47 @@ class VectorEncoder extends GrowableBuffer {
     this.writeUInt8(vectorFormat);
     this.writeUInt32BE(numElements);
     this.reserveBytes(8);
-    return writeFn;
+    return vectorFormat;
+  }
+
+  //---------------------------------------------------------------------------
+  // _writeElements()
+  //
+  // Writes the elements of the value from the start index up to (but not
+  // including) the end index in the given vector format. Space for all of the
+  // elements is reserved at once.
+  //---------------------------------------------------------------------------
+  _writeElements(value, start, end, vectorFormat) {
+    const numElements = end - start;
+    if (vectorFormat === constants.VECTOR_FORMAT_FLOAT32) {
+      let pos = this.reserveBytes(numElements * 4);
+      for (let i = start; i < end; i++, pos += 4) {
+        this.writeBinaryFloat(value[i], pos);
+      }
+    } else if (vectorFormat === constants.VECTOR_FORMAT_FLOAT64) {
+      let pos = this.reserveBytes(numElements * 8);
+      for (let i = start; i < end; i++, pos += 8) {
+        this.writeBinaryDouble(value[i], pos);
+      }
+    } else {
+      let pos = this.reserveBytes(numElements);
+      for (let i = start; i < end; i++) {
+        this.buf[pos++] = value[i];
+      }
+    }
   }
 
   //---------------------------------------------------------------------------
   // encode()
   //
-  // Encodes the value as OSON and returns a buffer containing the OSON bytes.
+  // Encodes the value as a vector and returns a buffer containing the vector
+  // bytes. The encoder may be reused; the buffer is only valid until the next
+  // call to encode() or encodeElements().
   //---------------------------------------------------------------------------
   encode(value) {
-    let writeFn;
-
     if (value instanceof types.SparseVector) {
-      writeFn = this._updateVectorHeader(value.values, value);
+      this.pos = 0;
+      const vectorFormat = this._updateVectorHeader(value.values, value);
       const numElements = value.indices.length;
       this.writeUInt16BE(numElements);
 
@@ -196,16 +289,29 @@ class VectorEncoder extends GrowableBuffer {
       value.indices.forEach((element) => {
         this.writeUInt32BE(element);
       });
-      value = value.values;
-    } else {
-      writeFn = this._updateVectorHeader(value);
-    }
 
-    // write data
-    value.forEach((element) => {
-      writeFn(element);
-    });
+      // write data
+      this._writeElements(value.values, 0, value.values.length,
+        vectorFormat);
+      return this.buf.subarray(0, this.pos);
+    }
+    return this.encodeElements(value, 0, value.length);
+  }
 
+  //---------------------------------------------------------------------------
+  // encodeElements()
+  //
+  // Encodes the given number of elements of the value, beginning at the start
+  // index, as a dense vector. This allows each row of a matrix of vectors to be
+  // encoded without creating a separate array for each row. The buffer
+  // returned is only valid until the next call to encode() or
+  // encodeElements().
+  //---------------------------------------------------------------------------
+  encodeElements(value, start, numElements) {
+    this.pos = 0;
+    const vectorFormat = this._updateVectorHeader(value, undefined,
+      numElements);
+    this._writeElements(value, start, start + numElements, vectorFormat);
     return this.buf.subarray(0, this.pos);
   }
 
@@ -213,5 +319,6 @@ class VectorEncoder extends GrowableBuffer {
 
 module.exports = {
   VectorDecoder,
-  VectorEncoder
+  VectorEncoder,
+  VectorSlab
 };
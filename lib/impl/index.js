@@ -34,6 +34,7 @@ const DbObjectImpl = require('./dbObject.js');
 const ConnectionImpl = require('./connection.js');
 const LobImpl = require('./lob.js');
 const PoolImpl = require('./pool.js');
+const PreparedStatementImpl = require('./preparedStatement.js');
 const ResultSetImpl = require('./resultset.js');
 const SodaCollectionImpl = require('./sodaCollection.js');
 const SodaDatabaseImpl = require('./sodaDatabase.js');
@@ -50,6 +51,7 @@ module.exports = {
   ConnectionImpl,
   LobImpl,
   PoolImpl,
+  PreparedStatementImpl,
   ResultSetImpl,
   SodaCollectionImpl,
   SodaDatabaseImpl,
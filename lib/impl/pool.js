@@ -183,6 +183,16 @@ class PoolImpl {
     errors.throwNotImplemented("getting the pool statement cache size");
   }
 
+  //---------------------------------------------------------------------------
+  // getWorkerStatistics()
+  //
+  // Returns the statistics of the native worker pool, or undefined if a
+  // native worker pool is not being used.
+  //---------------------------------------------------------------------------
+  getWorkerStatistics() {
+    return undefined;
+  }
+
   //---------------------------------------------------------------------------
   // _getConnectTraceConfig()
   //
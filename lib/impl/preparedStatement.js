@@ -0,0 +1,88 @@
+// Copyright (c) 2026, Oracle and/or its affiliates.
+
+//-----------------------------------------------------------------------------
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-----------------------------------------------------------------------------
+
+'use strict';
+
+const errors = require('../errors.js');
+const BaseImpl = require('./base.js');
+
+class PreparedStatementImpl extends BaseImpl {
+
+  //---------------------------------------------------------------------------
+  // _getConnImpl()
+  //
+  // Common method on all classes that make use of a connection -- used to
+  // ensure serialization of all use of the connection.
+  //---------------------------------------------------------------------------
+  _getConnImpl() {
+    return this._connImpl;
+  }
+
+  //---------------------------------------------------------------------------
+  // _setup()
+  //
+  // Setup the prepared statement after it has been created by the connection.
+  //---------------------------------------------------------------------------
+  _setup(connImpl, sql) {
+    this._connImpl = connImpl;
+    this.sql = sql;
+  }
+
+  //---------------------------------------------------------------------------
+  // close()
+  //
+  // Closes the prepared statement and releases the resources retained by it.
+  //---------------------------------------------------------------------------
+  close() {
+    errors.throwNotImplemented("closing a prepared statement");
+  }
+
+  //---------------------------------------------------------------------------
+  // execute()
+  //
+  // Executes the prepared statement using the connection that prepared it.
+  // The implementation reuses the statement (and its bind variables, where
+  // possible) instead of preparing the SQL again.
+  //---------------------------------------------------------------------------
+  async execute(binds, options) {
+    return await this._connImpl.executePrepared(this, 1, binds, options,
+      false);
+  }
+
+  //---------------------------------------------------------------------------
+  // executeMany()
+  //
+  // Executes the prepared statement for the specified number of iterations
+  // using the connection that prepared it.
+  //---------------------------------------------------------------------------
+  async executeMany(numIters, binds, options) {
+    return await this._connImpl.executePrepared(this, numIters, binds,
+      options, true);
+  }
+
+}
+
+module.exports = PreparedStatementImpl;
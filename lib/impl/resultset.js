@@ -34,8 +34,31 @@ const future = require('../future.js');
 const types = require('../types.js');
 const Lob = require('../lob.js');
 const oson = require('./datahandlers/oson.js');
+const transformer = require('../transformer.js');
 const BaseImpl = require('./base.js');
 
+// estimated number of bytes used by a column of each database type in a row
+// fetched from the database; this is used to size batches when the fetch array
+// size is determined automatically; the sizes of strings and raw columns are
+// taken from the metadata and other types use the default column size
+const COLUMN_BYTE_SIZES = new Map([
+  [types.DB_TYPE_BINARY_DOUBLE, 8],
+  [types.DB_TYPE_BINARY_FLOAT, 4],
+  [types.DB_TYPE_BINARY_INTEGER, 4],
+  [types.DB_TYPE_BOOLEAN, 4],
+  [types.DB_TYPE_CURSOR, 64],
+  [types.DB_TYPE_DATE, 7],
+  [types.DB_TYPE_INTERVAL_DS, 11],
+  [types.DB_TYPE_INTERVAL_YM, 5],
+  [types.DB_TYPE_NUMBER, 22],
+  [types.DB_TYPE_ROWID, 18],
+  [types.DB_TYPE_TIMESTAMP, 11],
+  [types.DB_TYPE_TIMESTAMP_LTZ, 11],
+  [types.DB_TYPE_TIMESTAMP_TZ, 13]
+]);
+const DEFAULT_COLUMN_BYTE_SIZE = 4000;
+const LOB_LOCATOR_BYTE_SIZE = 112;
+
 // define implementation class
 class ResultSetImpl extends BaseImpl {
 
@@ -154,7 +177,12 @@ class ResultSetImpl extends BaseImpl {
     if (settings.thin) {
       if (metadata.dbType === types.DB_TYPE_NUMBER &&
         metadata.fetchType === types.DB_TYPE_NUMBER) {
-        converter = (v) => (v === null) ? null : parseFloat(v);
+        // when fetching columns into typed arrays, the strings are converted
+        // directly into the typed arrays, so no converter is needed
+        if (options.outFormat !== constants.OUT_FORMAT_COLUMNS ||
+            userConverter) {
+          converter = (v) => (v === null) ? null : parseFloat(v);
+        }
       } else if (metadata.fetchType === types.DB_TYPE_VARCHAR) {
         if (metadata.dbType === types.DB_TYPE_BINARY_DOUBLE ||
           metadata.dbType === types.DB_TYPE_BINARY_FLOAT ||
@@ -182,6 +210,26 @@ class ResultSetImpl extends BaseImpl {
         const internalConverter = converter;
         converter = (v) => userConverter(internalConverter(v));
       }
+
+    // in thick mode, the Oracle Client libraries do not return the OSON image
+    // of JSON values so when JSON is fetched as a buffer, the value is fetched
+    // as JSON and then encoded as OSON
+    } else if (metadata.dbType === types.DB_TYPE_JSON &&
+        metadata.fetchType === types.DB_TYPE_RAW) {
+      const maxFieldNameSize = this._getConnImpl()._osonMaxFieldNameSize;
+      metadata.fetchType = types.DB_TYPE_JSON;
+      converter = function(val) {
+        if (val === null || val === undefined)
+          return val;
+        const encoder = new oson.OsonEncoder();
+        const buf = encoder.encode(transformer.transformJsonValue(val),
+          maxFieldNameSize);
+        return new types.OsonImage(buf.buffer, buf.byteOffset, buf.length);
+      };
+      if (userConverter) {
+        const internalConverter = converter;
+        converter = (v) => userConverter(internalConverter(v));
+      }
     }
 
     if (converter) {
@@ -190,6 +238,66 @@ class ResultSetImpl extends BaseImpl {
 
   }
 
+  //---------------------------------------------------------------------------
+  // _getColumnArrayType()
+  //
+  // Returns the type of array used to return the values of the column with
+  // the specified metadata when fetching with OUT_FORMAT_COLUMNS. Columns
+  // that have converters or that are not numeric, date or boolean are
+  // returned in regular JavaScript arrays.
+  //---------------------------------------------------------------------------
+  _getColumnArrayType(metadata) {
+    if (metadata.converter)
+      return constants.COLUMN_ARRAY_TYPE_ARRAY;
+    switch (metadata.fetchType) {
+      case types.DB_TYPE_NUMBER:
+        if (metadata.dbType === types.DB_TYPE_NUMBER &&
+            metadata.scale === 0 && metadata.precision > 0) {
+          if (metadata.precision <= 9)
+            return constants.COLUMN_ARRAY_TYPE_INT32;
+          if (metadata.precision <= 18)
+            return constants.COLUMN_ARRAY_TYPE_BIGINT64;
+        }
+        return constants.COLUMN_ARRAY_TYPE_FLOAT64;
+      case types.DB_TYPE_BINARY_DOUBLE:
+      case types.DB_TYPE_BINARY_FLOAT:
+      case types.DB_TYPE_BINARY_INTEGER:
+        return constants.COLUMN_ARRAY_TYPE_FLOAT64;
+      case types.DB_TYPE_DATE:
+      case types.DB_TYPE_TIMESTAMP:
+      case types.DB_TYPE_TIMESTAMP_LTZ:
+      case types.DB_TYPE_TIMESTAMP_TZ:
+        return constants.COLUMN_ARRAY_TYPE_DATE;
+      case types.DB_TYPE_BOOLEAN:
+        return constants.COLUMN_ARRAY_TYPE_BOOLEAN;
+      default:
+        return constants.COLUMN_ARRAY_TYPE_ARRAY;
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // _getColumnByteSize()
+  //
+  // Returns the estimated number of bytes used by the column with the
+  // specified metadata in each row fetched from the database.
+  //---------------------------------------------------------------------------
+  _getColumnByteSize(metadata) {
+    if (metadata.byteSize !== undefined)
+      return metadata.byteSize;
+    switch (metadata.fetchType) {
+      case types.DB_TYPE_BFILE:
+      case types.DB_TYPE_BLOB:
+      case types.DB_TYPE_CLOB:
+      case types.DB_TYPE_NCLOB:
+        return LOB_LOCATOR_BYTE_SIZE;
+      case types.DB_TYPE_VECTOR:
+        if (metadata.vectorDimensions)
+          return metadata.vectorDimensions * 8;
+        break;
+    }
+    return COLUMN_BYTE_SIZES.get(metadata.dbType) ?? DEFAULT_COLUMN_BYTE_SIZE;
+  }
+
   //---------------------------------------------------------------------------
   // _getConnImpl()
   //
@@ -200,13 +308,56 @@ class ResultSetImpl extends BaseImpl {
     return this._parentObj;
   }
 
+  //---------------------------------------------------------------------------
+  // _initFetchArraySize()
+  //
+  // Determines the initial and maximum fetch array sizes when the fetch array
+  // size is determined automatically. Each is the number of rows that fit
+  // within the corresponding byte budget, based on the estimated size of
+  // each row.
+  //---------------------------------------------------------------------------
+  _initFetchArraySize() {
+    let rowSize = 1;
+    for (const info of this.metaData) {
+      rowSize += this._getColumnByteSize(info);
+    }
+    this.maxFetchArraySize = Math.max(1,
+      Math.min(constants.FETCH_ARRAY_SIZE_AUTO_MAX,
+        Math.floor(constants.FETCH_ARRAY_SIZE_AUTO_MAX_BYTES / rowSize)));
+    this.fetchArraySize = Math.max(1, Math.min(this.maxFetchArraySize,
+      Math.floor(constants.FETCH_ARRAY_SIZE_AUTO_INITIAL_BYTES / rowSize)));
+  }
+
+  //---------------------------------------------------------------------------
+  // _tuneFetchArraySize()
+  //
+  // Adjusts the fetch array size used for the next batch when the fetch array
+  // size is determined automatically. If fewer rows than requested were
+  // fetched, all of the rows have been fetched and no adjustment is made.
+  // Otherwise, the size is doubled if the batch was fetched quickly and
+  // halved if it was fetched slowly.
+  //---------------------------------------------------------------------------
+  _tuneFetchArraySize(numRowsRequested, numRowsFetched, elapsedMs) {
+    if (numRowsFetched < numRowsRequested)
+      return;
+    if (elapsedMs < constants.FETCH_ARRAY_SIZE_AUTO_GROW_MS) {
+      this.fetchArraySize = Math.min(this.maxFetchArraySize,
+        this.fetchArraySize * 2);
+    } else if (elapsedMs > constants.FETCH_ARRAY_SIZE_AUTO_SHRINK_MS) {
+      this.fetchArraySize = Math.max(1, Math.floor(this.fetchArraySize / 2));
+    }
+  }
+
   //---------------------------------------------------------------------------
   // _setup()
   //
   // Setup a result set. The metadata is examined to to determine if any
   // columns need to be manipulated before being returned to the caller. If the
   // rows fetched from the result set are expected to be objects, a unique set
-  // of attribute names are also determined.
+  // of attribute names are also determined. If the rows are expected to be
+  // returned in columns, the type of array used for each column is also
+  // determined. If the fetch array size is determined automatically, its
+  // initial value is calculated once the fetch types are known.
   //---------------------------------------------------------------------------
   _setup(options, metaData) {
     this._parentObj = options.connection._impl;
@@ -217,8 +368,16 @@ class ResultSetImpl extends BaseImpl {
     this.converterIndices = [];
     this.outFormat = options.outFormat;
     this.fetchArraySize = options.fetchArraySize;
+    this.fetchArraySizeAuto = options.fetchArraySizeAuto;
     this.dbObjectAsPojo = options.dbObjectAsPojo;
+    this.jsonFetchMode = options.jsonFetchMode;
+    this.vectorFetchMode = options.vectorFetchMode;
+    this.fetchVectorsAsMatrix =
+      (options.vectorFetchMode === constants.VECTOR_FETCH_MODE_MATRIX);
     this.maxRows = options.maxRows;
+    if (this.outFormat === constants.OUT_FORMAT_COLUMNS) {
+      this.columnArrayTypes = [];
+    }
     const names = new Map();
     for (let i = 0; i < metaData.length; i++) {
       const name = metaData[i].name;
@@ -247,6 +406,9 @@ class ResultSetImpl extends BaseImpl {
       if (info.converter) {
         this.converterIndices.push(i);
       }
+      if (this.columnArrayTypes) {
+        this.columnArrayTypes.push(this._getColumnArrayType(info));
+      }
       let name = info.name;
       if (names.get(name) !== i) {
         let seqNum = 0;
@@ -258,6 +420,9 @@ class ResultSetImpl extends BaseImpl {
         info.name = name;
       }
     }
+    if (this.fetchArraySizeAuto) {
+      this._initFetchArraySize();
+    }
   }
 
   //---------------------------------------------------------------------------
@@ -161,6 +161,25 @@ class SodaCollectionImpl extends BaseImpl {
     errors.throwNotImplemented("saving a single doc in a collection");
   }
 
+  //---------------------------------------------------------------------------
+  // saveMany()
+  //
+  // Saves multiple documents into the collection.
+  //---------------------------------------------------------------------------
+  saveMany() {
+    errors.throwNotImplemented("saving multiple docs in a collection");
+  }
+
+  //---------------------------------------------------------------------------
+  // saveManyAndGet()
+  //
+  // Saves multiple documents into the collection and returns an array of
+  // documents containing metadata.
+  //---------------------------------------------------------------------------
+  saveManyAndGet() {
+    errors.throwNotImplemented("saving multiple docs in a collection");
+  }
+
   //---------------------------------------------------------------------------
   // truncate()
   //
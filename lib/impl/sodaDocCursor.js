@@ -59,6 +59,15 @@ class SodaDocCursorImpl extends BaseImpl {
     errors.throwNotImplemented("getting a document from a SODA doc cursor");
   }
 
+  //---------------------------------------------------------------------------
+  // getNextBatch()
+  //
+  // Returns up to the specified number of documents from the cursor.
+  //---------------------------------------------------------------------------
+  getNextBatch() {
+    errors.throwNotImplemented("getting documents from a SODA doc cursor");
+  }
+
 }
 
 module.exports = SodaDocCursorImpl;
@@ -39,6 +39,11 @@ class Lob extends Duplex {
     super({ decodeStrings: false });
     this.offset = 1;
     this._isActive = false;
+    this._readAhead = 0;
+    this._readQueue = [];
+    this._writeBuffer = [];
+    this._writeBufferLength = 0;
+    this._writeBufferSize = 0;
     this.once('finish', function() {
       if (this._autoCloseLob) {
         this.destroy();
@@ -68,6 +73,7 @@ class Lob extends Duplex {
     // if LOB was already closed, nothing to do!
     if (err && err.message.startsWith("NJS-003:"))
       delete this._impl;
+    await this._cancelReadAhead();
     if (this._impl) {
       const lobImpl = this._impl;
       delete this._impl;
@@ -81,20 +87,66 @@ class Lob extends Duplex {
     cb(err);
   }
 
+  // waits for any reads queued by read-ahead to complete and discards them;
+  // this is used when the LOB is about to be closed
+  async _cancelReadAhead() {
+    const queue = this._readQueue;
+    this._readQueue = [];
+    for (const entry of queue) {
+      try {
+        await entry.promise;
+      } catch {
+        // errors are only reported for pieces that are consumed
+      }
+    }
+  }
+
+  // returns the next piece of data for a streaming read; if read-ahead is
+  // enabled, reads of the pieces that follow are queued at the same time so
+  // that each one is requested as soon as the previous one completes instead
+  // of when the consumer asks for more data; queued reads that do not start
+  // at the offset actually reached are discarded
+  async _readPiece() {
+    const queue = this._readQueue;
+    while (queue.length > 0 && queue[0].offset !== this.offset)
+      queue.shift();
+    if (this._readAhead > 0 && this.type !== types.DB_TYPE_BFILE) {
+      const pieceSize = this.pieceSize;
+      const length = this.length;
+      let offset = (queue.length > 0) ?
+        queue[queue.length - 1].offset + pieceSize : this.offset;
+      while (queue.length <= this._readAhead && offset <= length) {
+        const promise = this._serializedRead(offset);
+        promise.catch(() => {});
+        queue.push({offset, promise});
+        offset += pieceSize;
+      }
+    }
+    if (queue.length > 0)
+      return await queue.shift().promise;
+    return await this._serializedRead(this.offset);
+  }
+
   // implementation of streaming read; if LOB is set to auto-close, the lob is
   // automatically closed when an error occurs or when there are no more bytes
   // to transfer; all that needs to be done here is to destroy the streaming
   // LOB
   async _read() {
     try {
-      const data = await this._serializedRead(this.offset);
+      const data = await this._readPiece();
       if (data) {
         this.offset += data.length;
         this.push(data);
       } else {
         this.push(null);
         if (this._autoCloseLob) {
-          this.destroy();
+          // pieces that were read ahead must be consumed before the LOB is
+          // destroyed or they would be discarded
+          if (this.readableLength === 0) {
+            this.destroy();
+          } else {
+            this.once('end', () => this.destroy());
+          }
         }
       }
     } catch (err) {
@@ -124,28 +176,95 @@ class Lob extends Duplex {
     this._autoCloseLob = autoCloseLob;
   }
 
+  // called when the writable side of the stream is ended; any data that is
+  // still buffered is written to the LOB before the "finish" event is emitted
+  async _final(cb) {
+    if (this._writeBufferLength > 0) {
+      try {
+        await this._flushWriteBuffer(true);
+      } catch (err) {
+        if (this._autoCloseLob)
+          this.destroy(err);
+        cb(err);
+        return;
+      }
+    }
+    cb(null);
+  }
+
+  // writes the buffered data to the LOB in a single call; unless all of the
+  // data is to be written, only a multiple of the LOB chunk size is written
+  // (if possible) and the remainder is retained for the next write
+  async _flushWriteBuffer(all) {
+    const buffered = this._writeBuffer;
+    let data;
+    if (buffered.length === 1) {
+      data = buffered[0];
+    } else if (buffered.every(Buffer.isBuffer)) {
+      data = Buffer.concat(buffered);
+    } else {
+      data = buffered.join('');
+    }
+    this._writeBuffer = [];
+    this._writeBufferLength = 0;
+    const chunkSize = (all) ? 0 : this.chunkSize;
+    if (chunkSize > 0) {
+      let length = data.length - (data.length % chunkSize);
+      if (length > 0 && length < data.length) {
+
+        // avoid splitting a surrogate pair across two writes
+        if (typeof data === 'string') {
+          const code = data.charCodeAt(length - 1);
+          if (code >= 0xD800 && code <= 0xDBFF)
+            length--;
+        }
+        if (length > 0) {
+          this._writeBuffer.push(data.slice(length));
+          this._writeBufferLength = data.length - length;
+          data = data.slice(0, length);
+        }
+      }
+    }
+    await this._serializedWrite(this.offset, data);
+    this.offset += data.length;
+  }
+
   // implementation of streaming write; if LOB is set to auto-close, the lob is
   // automatically closed in the "finish" event; all that needs to be done here
   // is to destroy the streaming LOB
   async _write(data, encoding, cb) {
+    await this._writev([{chunk: data, encoding}], cb);
+  }
+
+  // implementation of streaming write for multiple chunks; the chunks are
+  // buffered and written to the LOB in a single call once the amount of data
+  // buffered reaches the write buffer size
+  async _writev(chunks, cb) {
 
     // convert data if needed
-    if (this.type == constants.DB_TYPE_BLOB && !Buffer.isBuffer(data)) {
-      data = Buffer.from(data);
-    } else if (this.type == constants.DB_TYPE_CLOB &&
-        Buffer.isBuffer(data)) {
-      data = data.toString();
+    for (const {chunk} of chunks) {
+      let data = chunk;
+      if (this.type == constants.DB_TYPE_BLOB && !Buffer.isBuffer(data)) {
+        data = Buffer.from(data);
+      } else if (this.type == constants.DB_TYPE_CLOB &&
+          Buffer.isBuffer(data)) {
+        data = data.toString();
+      }
+      this._writeBuffer.push(data);
+      this._writeBufferLength += data.length;
     }
 
-    try {
-      await this._serializedWrite(this.offset, data);
-    } catch (err) {
-      if (this._autoCloseLob)
-        this.destroy(err);
-      cb(err);
-      return;
+    // write the data if the write buffer size has been reached
+    if (this._writeBufferLength >= this._writeBufferSize) {
+      try {
+        await this._flushWriteBuffer(this._writeBufferSize === 0);
+      } catch (err) {
+        if (this._autoCloseLob)
+          this.destroy(err);
+        cb(err);
+        return;
+      }
     }
-    this.offset += data.length;
     cb(null);
 
   }
@@ -262,8 +381,8 @@ class Lob extends Duplex {
     if (newSize === undefined) {
       newSize = 0;
     } else {
-      errors.assertParamValue(Number.isInteger(newSize) && newSize >= 0 &&
-        newSize < 2 ** 32, 1);
+      errors.assertParamValue(Number.isSafeInteger(newSize) && newSize >= 0,
+        1);
     }
     await this._impl.trim(newSize);
   }
@@ -305,6 +424,22 @@ class Lob extends Duplex {
     this._impl.setPieceSize(value);
   }
 
+  //---------------------------------------------------------------------------
+  // readAhead
+  //
+  // Property for the number of pieces that are read from the database ahead
+  // of the consumer when the LOB is streamed.
+  //---------------------------------------------------------------------------
+  get readAhead() {
+    return this._readAhead;
+  }
+
+  set readAhead(value) {
+    errors.assertPropValue(Number.isSafeInteger(value) && value >= 0,
+      "readAhead");
+    this._readAhead = value;
+  }
+
   //---------------------------------------------------------------------------
   // type
   //
@@ -314,6 +449,22 @@ class Lob extends Duplex {
     return this._type;
   }
 
+  //---------------------------------------------------------------------------
+  // writeBufferSize
+  //
+  // Property for the amount of data written to the LOB stream that is buffered
+  // before it is written to the database.
+  //---------------------------------------------------------------------------
+  get writeBufferSize() {
+    return this._writeBufferSize;
+  }
+
+  set writeBufferSize(value) {
+    errors.assertPropValue(Number.isSafeInteger(value) && value >= 0,
+      "writeBufferSize");
+    this._writeBufferSize = value;
+  }
+
 }
 
 nodbUtil.wrapFns(Lob.prototype, errors.ERR_BUSY_LOB,
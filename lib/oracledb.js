@@ -58,6 +58,7 @@ const Connection = require('./connection.js');
 const Lob = require('./lob.js');
 const Pool = require('./pool.js');
 const PoolStatistics = require('./poolStatistics.js');
+const PreparedStatement = require('./preparedStatement.js');
 const ResultSet = require('./resultset.js');
 const Pipeline = require('./pipeline.js');
 const settings = require('./settings.js');
@@ -78,8 +79,9 @@ let configProviderCache;
 // save arguments for call to initOracleClient()
 let _initOracleClientArgs;
 
-// Load the Oracledb binary
-function _initCLib(options) {
+// Load the Oracledb binary; if the binary is optional, undefined is returned
+// when it cannot be loaded instead of raising an error
+function _initCLib(options, required = true) {
   // Ensure that webpack compile does not throw any issues or warnings
   // See https://github.com/oracle/node-oracledb/issues/1156
   // and https://github.com/oracle/node-oracledb/issues/1678
@@ -114,6 +116,8 @@ function _initCLib(options) {
       break;
     } catch (err) {
       if (err.code !== 'MODULE_NOT_FOUND' || i == binaryLocations.length - 1) {
+        if (!required)
+          return;
         let nodeInfo;
         if (err.code === 'MODULE_NOT_FOUND') {
           // A binary was not found in any of the search directories.
@@ -1281,9 +1285,11 @@ module.exports = {
   Connection,
   JsonId: types.JsonId,
   Lob,
+  OsonImage: types.OsonImage,
   Pool,
   Pipeline,
   PoolStatistics,
+  PreparedStatement,
   ResultSet,
   SodaDatabase,
   SodaCollection,
@@ -1429,6 +1435,7 @@ module.exports = {
   // outFormat values
   OUT_FORMAT_ARRAY: constants.OUT_FORMAT_ARRAY,
   OUT_FORMAT_OBJECT: constants.OUT_FORMAT_OBJECT,
+  OUT_FORMAT_COLUMNS: constants.OUT_FORMAT_COLUMNS,
 
   // SODA collection creation modes
   SODA_COLL_MAP_MODE: constants.SODA_COLL_MAP_MODE,
@@ -1555,6 +1562,10 @@ module.exports = {
     return settings.dbObjectTypeHandler;
   },
 
+  get jsonFetchMode() {
+    return settings.jsonFetchMode;
+  },
+
   get lobPrefetchSize() {
     return settings.lobPrefetchSize;
   },
@@ -1563,6 +1574,10 @@ module.exports = {
     return settings.maxRows;
   },
 
+  get nativeWorkerThreads() {
+    return settings.nativeWorkerThreads;
+  },
+
   get oracleClientVersion() {
     return settings.oracleClientVersion;
   },
@@ -1620,6 +1635,10 @@ module.exports = {
     return settings.thin;
   },
 
+  get vectorFetchMode() {
+    return settings.vectorFetchMode;
+  },
+
   get version() {
     return constants.VERSION_MAJOR * 10000 + constants.VERSION_MINOR * 100 +
         constants.VERSION_PATCH;
@@ -1676,8 +1695,8 @@ module.exports = {
   },
 
   set fetchArraySize(value) {
-    errors.assertPropValue(Number.isInteger(value) && value > 0,
-      "fetchArraySize");
+    errors.assertPropValue(value === constants.FETCH_ARRAY_SIZE_AUTO ||
+      (Number.isInteger(value) && value > 0), "fetchArraySize");
     settings.fetchArraySize = value;
   },
 
@@ -1707,6 +1726,12 @@ module.exports = {
     settings.dbObjectTypeHandler = value;
   },
 
+  set jsonFetchMode(value) {
+    errors.assertPropValue(value === constants.JSON_FETCH_MODE_EAGER ||
+      value === constants.JSON_FETCH_MODE_LAZY, "jsonFetchMode");
+    settings.jsonFetchMode = value;
+  },
+
   set lobPrefetchSize(value) {
     errors.assertPropValue(Number.isInteger(value) && value >= 0,
       "lobPrefetchSize");
@@ -1725,6 +1750,12 @@ module.exports = {
     settings.maxRows = value;
   },
 
+  set nativeWorkerThreads(value) {
+    errors.assertPropValue(Number.isInteger(value) && value >= 0,
+      "nativeWorkerThreads");
+    settings.nativeWorkerThreads = value;
+  },
+
   set osUser(value) {
     errors.assertPropValue(typeof value === 'string', "osUser");
     const sanitizedValue = nodbUtil.sanitize(value);
@@ -1734,7 +1765,8 @@ module.exports = {
 
   set outFormat(value) {
     if (value !== constants.OUT_FORMAT_ARRAY &&
-        value !== constants.OUT_FORMAT_OBJECT) {
+        value !== constants.OUT_FORMAT_OBJECT &&
+        value !== constants.OUT_FORMAT_COLUMNS) {
       errors.throwErr(errors.ERR_INVALID_PROPERTY_VALUE, "outFormat");
     }
     settings.outFormat = value;
@@ -1804,6 +1836,12 @@ module.exports = {
     settings.terminal = value;
   },
 
+  set vectorFetchMode(value) {
+    errors.assertPropValue(value === constants.VECTOR_FETCH_MODE_SEPARATE ||
+      value === constants.VECTOR_FETCH_MODE_MATRIX, "vectorFetchMode");
+    settings.vectorFetchMode = value;
+  },
+
   set configProviderCacheTimeout(value) {
     errors.assertPropValue(Number.isInteger(value) && value >= 0,
       "configProviderCacheTimeout");
@@ -1818,4 +1856,18 @@ module.exports = {
     errors.assertPropValue(typeof value === 'boolean', "thickModeDSNPassthrough");
     settings.thickModeDSNPassthrough = value;
   },
+
+  get thinNativeDecode() {
+    return settings.thinNativeDecode;
+  },
+
+  set thinNativeDecode(value) {
+    errors.assertPropValue(typeof value === 'boolean', "thinNativeDecode");
+    if (value && !settings._thinDecodeRows) {
+      const oracledbCLib = _initCLib({}, false);
+      if (oracledbCLib && typeof oracledbCLib.decodeRows === 'function')
+        settings._thinDecodeRows = oracledbCLib.decodeRows;
+    }
+    settings.thinNativeDecode = value && Boolean(settings._thinDecodeRows);
+  },
 };
@@ -26,6 +26,7 @@
 
 'use strict';
 
+const constants = require('./constants.js');
 const errors = require('./errors.js');
 const nodbUtil = require('./util.js');
 const settings = require('./settings.js');
@@ -50,6 +51,15 @@ class Pipeline {
     }
   }
 
+  // the number of rows fetched by a pipeline operation is fixed when it is
+  // added so the default is used if the fetch array size is determined
+  // automatically
+  _getFetchArraySize(fetchArraySize) {
+    if (fetchArraySize === constants.FETCH_ARRAY_SIZE_AUTO)
+      return constants.DEFAULT_FETCH_ARRAY_SIZE;
+    return fetchArraySize;
+  }
+
   _addOperation(opType, data = {}) {
     if (['execute', 'fetchOne', 'fetchMany', 'fetchAll'].includes(opType))
       this._checkOptions(data.options, this._validExecOptions);
@@ -78,7 +88,8 @@ class Pipeline {
   }
 
   addFetchMany(statement, parameters = [], options = {},
-    numRows = settings.fetchArraySize, fetchLobs = true) {
+    numRows = this._getFetchArraySize(settings.fetchArraySize),
+    fetchLobs = true) {
     errors.assertParamValue(nodbUtil.isObject(options), 3);
     options.prefetchRows = options.prefetchRows ?? numRows;
     if (numRows > 0)
@@ -92,8 +103,8 @@ class Pipeline {
   addFetchAll(statement, parameters = [], options = {},
     fetchArraySize, fetchLobs) {
     errors.assertParamValue(nodbUtil.isObject(options), 3);
-    fetchArraySize = fetchArraySize ?? options.fetchArraySize ??
-      settings.fetchArraySize;
+    fetchArraySize = this._getFetchArraySize(fetchArraySize ??
+      options.fetchArraySize ?? settings.fetchArraySize);
     options.prefetchRows = options.prefetchRows ?? fetchArraySize;
     options.fetchArraySize = fetchArraySize;
     fetchLobs = fetchLobs ?? true;
@@ -38,6 +38,7 @@ class PoolStatistics {
 
   constructor(pool) {
     let averageTimeInQueue = 0;
+    const workerStats = pool._impl.getWorkerStatistics();
 
     if (pool._totalRequestsEnqueued !== 0) {
       averageTimeInQueue = Math.round(pool._totalTimeInQueue /
@@ -82,6 +83,12 @@ class PoolStatistics {
     this.user = pool.user;
     this.threadPoolSize = process.env.UV_THREADPOOL_SIZE;
     this.thin = settings.thin;
+    if (workerStats) {
+      this.nativeWorkerThreads = workerStats.threads;
+      this.nativeWorkerThreadsBusy = workerStats.busyThreads;
+      this.nativeWorkerQueueLength = workerStats.queueLength;
+      this.nativeWorkerPoolQueueLength = workerStats.poolQueueLength;
+    }
   }
 
   //---------------------------------------------------------------------------
@@ -135,6 +142,15 @@ class PoolStatistics {
     console.log('...sodaMetaDataCache:', this.sodaMetaDataCache);
     console.log('...stmtCacheSize:', this.stmtCacheSize);
     console.log('...user:', this.user);
+    if (this.nativeWorkerThreads !== undefined) {
+      console.log('Native worker pool:');
+      console.log('...threads:', this.nativeWorkerThreads);
+      console.log('...busy threads:', this.nativeWorkerThreadsBusy);
+      console.log('...requests waiting for a thread:',
+        this.nativeWorkerQueueLength);
+      console.log('...requests of this pool waiting for a thread:',
+        this.nativeWorkerPoolQueueLength);
+    }
     console.log('Related environment variables:');
     console.log('...UV_THREADPOOL_SIZE:', this.threadPoolSize);
   }
@@ -0,0 +1,153 @@
+// Copyright (c) 2026, Oracle and/or its affiliates.
+
+//-----------------------------------------------------------------------------
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-----------------------------------------------------------------------------
+
+'use strict';
+
+const { Buffer } = require('buffer');
+const errors = require('./errors.js');
+const nodbUtil = require('./util.js');
+
+class PreparedStatement {
+
+  //---------------------------------------------------------------------------
+  // _mergeBindDefs()
+  //
+  // Combines the bind values supplied to execute() with the bind definitions
+  // supplied when the statement was prepared, so that the same bind type and
+  // size is used on each execution and the bind buffers can be reused.
+  //---------------------------------------------------------------------------
+  _mergeBindDefs(binds) {
+    const bindDefs = this._bindDefs;
+    const mergeUnit = (value, bindDef) => {
+      if (bindDef === undefined)
+        return value;
+      if (nodbUtil.isObject(value) && !(value instanceof Date) &&
+          !Buffer.isBuffer(value) &&
+          ('val' in value || 'dir' in value || 'type' in value))
+        return {...bindDef, ...value};
+      return {...bindDef, val: value};
+    };
+    if (Array.isArray(bindDefs)) {
+      if (!Array.isArray(binds))
+        return binds;
+      const outBinds = [];
+      for (let i = 0; i < Math.max(binds.length, bindDefs.length); i++)
+        outBinds.push(mergeUnit(binds[i], bindDefs[i]));
+      return outBinds;
+    } else if (!nodbUtil.isObject(binds) || Array.isArray(binds)) {
+      return binds;
+    }
+    const outBinds = {...binds};
+    for (const [name, bindDef] of Object.entries(bindDefs))
+      outBinds[name] = mergeUnit(binds[name], bindDef);
+    return outBinds;
+  }
+
+  //---------------------------------------------------------------------------
+  // _setup()
+  //
+  // Setup the prepared statement after it has been created by the
+  // connection.
+  //---------------------------------------------------------------------------
+  _setup(connection, bindDefs) {
+    this._connection = connection;
+    this._bindDefs = bindDefs;
+  }
+
+  //---------------------------------------------------------------------------
+  // close()
+  //
+  // Closes the prepared statement and releases the resources held by it. The
+  // statement cannot be executed after it has been closed.
+  //---------------------------------------------------------------------------
+  async close() {
+    errors.assertArgCount(arguments, 0, 0);
+    errors.assert(this._impl, errors.ERR_INVALID_PREPARED_STMT);
+    errors.assert(!this._resultSet || !this._resultSet._impl,
+      errors.ERR_BUSY_PREPARED_STMT);
+    await this._impl.close();
+    delete this._impl;
+    delete this._resultSet;
+  }
+
+  //---------------------------------------------------------------------------
+  // execute()
+  //
+  // Executes the prepared statement with the supplied binds and options and
+  // returns the results in the same form as connection.execute().
+  //---------------------------------------------------------------------------
+  async execute(a1, a2) {
+    errors.assertArgCount(arguments, 0, 2);
+    errors.assert(this._impl && this._connection._impl,
+      errors.ERR_INVALID_PREPARED_STMT);
+    errors.assert(!this._resultSet || !this._resultSet._impl,
+      errors.ERR_BUSY_PREPARED_STMT);
+
+    // process arguments in the same way as connection.execute()
+    const conn = this._connection;
+    const args = [this._impl.sql];
+    if (arguments.length > 0) {
+      args.push((this._bindDefs) ? this._mergeBindDefs(a1) : a1);
+      if (arguments.length > 1)
+        args.push(a2);
+    } else if (this._bindDefs) {
+      args.push(this._mergeBindDefs(Array.isArray(this._bindDefs) ? [] : {}));
+    }
+    const { binds, options } = await conn._processExecuteArgs(...args);
+
+    // perform actual execute
+    let result;
+    try {
+      if (conn._impl._callLevelTraceData) {
+        conn._impl._callLevelTraceData.statement = this._impl.sql;
+      }
+      result = await this._impl.execute(binds, options);
+    } catch (err) {
+      if (err.errorNum === 1406)
+        errors.throwErr(errors.ERR_INSUFFICIENT_BUFFER_FOR_BINDS);
+      throw err;
+    }
+    result = await conn._transformExecuteResult(result, options);
+    this._resultSet = result.resultSet;
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  // sql
+  //
+  // Returns the SQL statement that was prepared.
+  //---------------------------------------------------------------------------
+  get sql() {
+    return this._impl && this._impl.sql;
+  }
+
+}
+
+nodbUtil.wrapFns(PreparedStatement.prototype, errors.ERR_BUSY_PREPARED_STMT,
+  "close",
+  "execute");
+
+module.exports = PreparedStatement;
@@ -56,6 +56,7 @@ class QueryStream extends Readable {
           this.once('_doneFetching', resolve));
       }
       try {
+        await rs._cancelFetchAhead();
         await rs._impl.close();
       } catch (closeErr) {
         cb(closeErr);
@@ -71,6 +72,12 @@ class QueryStream extends Readable {
   _open(rs) {
     this._resultSet = rs;
 
+    // rows are fetched ahead in the background by default since the consumer
+    // of the stream is expected to process them while the next batch is being
+    // fetched
+    if (rs._prefetchAhead === undefined)
+      rs._prefetchAhead = true;
+
     // trigger the event listener that may have been added in _read() now that
     // the result set is ready
     this.emit('open');
@@ -32,6 +32,7 @@ const nodbUtil = require('./util.js');
 const constants = require('./constants.js');
 const Lob = require('./lob.js');
 const errors = require('./errors.js');
+const settings = require('./settings.js');
 
 class ResultSet {
 
@@ -41,6 +42,59 @@ class ResultSet {
     this._convertedToStream = false;
     this._allowGetRowCall = false;
     this._isActive = false;
+    this._fetchAhead = null;
+    this._fetchedRows = null;
+    this._fetchedAllRows = false;
+  }
+
+  //---------------------------------------------------------------------------
+  // _canFetchAhead()
+  //
+  // Returns a boolean indicating if the next batch of rows can be fetched in
+  // the background. This is only possible when read-ahead has been requested
+  // and the rows can be fetched without any further calls being made to the
+  // database while they are being processed.
+  //---------------------------------------------------------------------------
+  _canFetchAhead() {
+    return (this._prefetchAhead && !settings.errorOnConcurrentExecute &&
+      this._impl.outFormat !== constants.OUT_FORMAT_COLUMNS &&
+      this._impl.nestedCursorIndices.length === 0 &&
+      this._impl.converterIndices.length === 0);
+  }
+
+  //---------------------------------------------------------------------------
+  // _cancelFetchAhead()
+  //
+  // Cancels any background fetch that has not yet started and waits for any
+  // that is running to complete. This is used when the result set is about to
+  // be closed outside of the connection lock.
+  //---------------------------------------------------------------------------
+  async _cancelFetchAhead() {
+    const fetchAhead = this._fetchAhead;
+    if (fetchAhead) {
+      this._fetchAhead = null;
+      fetchAhead.cancelled = true;
+      await fetchAhead.promise;
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // _fetchRows()
+  //
+  // Fetches up to the specified number of rows from the implementation. If the
+  // fetch array size is being determined automatically, the number of rows
+  // fetched and the time taken are used to adjust the size of the next batch.
+  //---------------------------------------------------------------------------
+  async _fetchRows(impl, numRows, options) {
+    if (!impl.fetchArraySizeAuto)
+      return await impl.getRows(numRows, options);
+    const startTime = Date.now();
+    const rows = await impl.getRows(numRows, options);
+    const numRowsFetched = (impl.outFormat === constants.OUT_FORMAT_COLUMNS) ?
+      rows.numRows : rows.length;
+    impl._tuneFetchArraySize(numRows, numRowsFetched,
+      Date.now() - startTime);
+    return rows;
   }
 
   //---------------------------------------------------------------------------
@@ -52,30 +106,43 @@ class ResultSet {
 
     try {
 
-      // retain initial values of the maximum number of rows to fetch and the
-      // number of rows to fetch from the database at a single time
+      // retain initial value of the maximum number of rows to fetch; the
+      // number of rows to fetch from the database at a single time is checked
+      // for each batch since it may be adjusted as rows are fetched
       let maxRows = this._impl.maxRows;
-      let fetchArraySize = this._impl.fetchArraySize;
+
+      // when fetching columns, each batch is retained and they are merged
+      // together once all of the rows have been fetched
+      const columnar = (this._impl.outFormat === constants.OUT_FORMAT_COLUMNS);
 
       // fetch all rows
       let rowsFetched = [];
       while (true) {
+        let fetchArraySize = this._impl.fetchArraySize;
         if (maxRows > 0 && fetchArraySize >= maxRows) {
           fetchArraySize = maxRows;
         }
         const rows = await this._getRows(fetchArraySize);
+        const numRowsFetched = (columnar) ? rows.numRows : rows.length;
         if (rows) {
           await this._processRows(rows, true);
-          rowsFetched = rowsFetched.concat(rows);
+          if (columnar) {
+            rowsFetched.push(rows);
+          } else {
+            rowsFetched = rowsFetched.concat(rows);
+          }
         }
-        if (rows.length == maxRows || rows.length < fetchArraySize) {
+        if (numRowsFetched == maxRows || numRowsFetched < fetchArraySize) {
           break;
         }
         if (maxRows > 0) {
-          maxRows -= rows.length;
+          maxRows -= numRowsFetched;
         }
       }
 
+      if (columnar) {
+        return this._mergeColumns(rowsFetched);
+      }
       return rowsFetched;
 
     } finally {
@@ -85,12 +152,40 @@ class ResultSet {
 
   }
 
+  //---------------------------------------------------------------------------
+  // _doGetColumns()
+  //
+  // Return up to the specified number of rows from the result set in column
+  // format. If the number of rows is zero, all remaining rows are fetched and
+  // merged into a single set of columns.
+  //---------------------------------------------------------------------------
+  async _doGetColumns(numRows) {
+    if (numRows > 0) {
+      const batch = await this._getRows(numRows);
+      await this._processRows(batch, false);
+      return batch;
+    }
+    const batches = [];
+    while (true) {
+      const fetchArraySize = this._impl.fetchArraySize;
+      const batch = await this._getRows(fetchArraySize);
+      await this._processRows(batch, false);
+      batches.push(batch);
+      if (batch.numRows < fetchArraySize)
+        break;
+    }
+    return this._mergeColumns(batches);
+  }
+
   //---------------------------------------------------------------------------
   // _getRows()
   //
   // Return up to the specified number of rows from the result set. If nested
   // cursors are possible, setup the execute options so that they can be
-  // examined within the implementation's setup routine.
+  // examined within the implementation's setup routine. Rows fetched in the
+  // background by a previous call are returned first and, if read-ahead is
+  // enabled and a full batch was returned, the next batch is requested before
+  // the rows are handed to the caller.
   //---------------------------------------------------------------------------
   async _getRows(numRows) {
     let options = {};
@@ -99,12 +194,204 @@ class ResultSet {
         connection: this._connection,
         outFormat: this._impl.outFormat,
         fetchArraySize: this._impl.fetchArraySize,
+        fetchArraySizeAuto: this._impl.fetchArraySizeAuto,
         dbObjectAsPojo: this._impl.dbObjectAsPojo,
+        jsonFetchMode: this._impl.jsonFetchMode,
+        vectorFetchMode: this._impl.vectorFetchMode,
         maxRows: this._impl.maxRows,
         fetchTypeMap: this._impl.fetchTypeMap
       };
     }
-    return await this._impl.getRows(numRows, options);
+
+    // collect the results of any background fetch; since this method is
+    // always called with the connection lock held, the background fetch has
+    // either completed or has not yet started (in which case it is cancelled)
+    const fetchAhead = this._fetchAhead;
+    if (fetchAhead) {
+      this._fetchAhead = null;
+      fetchAhead.cancelled = true;
+      if (fetchAhead.err)
+        throw fetchAhead.err;
+      if (fetchAhead.rows && fetchAhead.rows.length > 0) {
+        this._fetchedRows = fetchAhead.rows;
+        this._fetchedAllRows = fetchAhead.complete;
+      }
+    }
+
+    let rows;
+    if (this._fetchedRows) {
+      rows = this._fetchedRows.splice(0, numRows);
+      if (this._fetchedRows.length === 0)
+        this._fetchedRows = null;
+      if (rows.length < numRows && !this._fetchedAllRows) {
+        const moreRows = await this._fetchRows(this._impl,
+          numRows - rows.length, options);
+        rows = rows.concat(moreRows);
+      }
+    } else {
+      rows = await this._fetchRows(this._impl, numRows, options);
+    }
+
+    if (rows.length === numRows && !this._fetchedRows && this._canFetchAhead())
+      this._startFetchAhead(options);
+    return rows;
+  }
+
+  //---------------------------------------------------------------------------
+  // _startFetchAhead()
+  //
+  // Starts fetching the next batch of rows in the background. The connection
+  // lock is acquired first so the fetch only takes place once the current
+  // call has completed and does not interleave with other uses of the
+  // connection. Errors are retained and raised by the next call to _getRows().
+  //---------------------------------------------------------------------------
+  _startFetchAhead(options) {
+    const connImpl = this._connection._impl;
+    const impl = this._impl;
+    const numRows = impl.fetchArraySize;
+    const fetchAhead = {cancelled: false, complete: false};
+    fetchAhead.promise = (async () => {
+      try {
+        await connImpl._acquireLock();
+      } catch {
+        return;
+      }
+      try {
+        if (!fetchAhead.cancelled) {
+          fetchAhead.rows = await this._fetchRows(impl, numRows, options);
+          fetchAhead.complete = (fetchAhead.rows.length < numRows);
+        }
+      } catch (err) {
+        fetchAhead.err = err;
+      } finally {
+        connImpl._releaseLock();
+      }
+    })();
+    this._fetchAhead = fetchAhead;
+  }
+
+  //---------------------------------------------------------------------------
+  // _mergeColumns()
+  //
+  // Merge the batches of columns returned by the implementation into a single
+  // batch. Typed arrays are copied into a new typed array of the same type and
+  // the null bitmaps are rebuilt for the merged set of rows.
+  //---------------------------------------------------------------------------
+  _mergeColumns(batches) {
+    if (batches.length === 1)
+      return batches[0];
+    let numRows = 0;
+    for (const batch of batches) {
+      numRows += batch.numRows;
+    }
+    const columns = batches[0].columns.map((column, i) => {
+      const nulls = new Uint8Array((numRows + 7) >> 3);
+      let values;
+      if (Array.isArray(column.values)) {
+        values = new Array(numRows);
+      } else {
+        values = new column.values.constructor(numRows);
+      }
+      let offset = 0;
+      for (const batch of batches) {
+        const batchColumn = batch.columns[i];
+        if (Array.isArray(values)) {
+          for (let j = 0; j < batch.numRows; j++) {
+            values[offset + j] = batchColumn.values[j];
+          }
+        } else {
+          values.set(batchColumn.values.subarray(0, batch.numRows), offset);
+        }
+        for (let j = 0; j < batch.numRows; j++) {
+          if (batchColumn.nulls[j >> 3] & (1 << (j & 7))) {
+            const pos = offset + j;
+            nulls[pos >> 3] |= 1 << (pos & 7);
+          }
+        }
+        offset += batch.numRows;
+      }
+      return { values, nulls };
+    });
+    return { numRows, columns };
+  }
+
+  //---------------------------------------------------------------------------
+  // _processColumns()
+  //
+  // Process columns returned by the implementation when the output format is
+  // OUT_FORMAT_COLUMNS. The same transformations that are performed on rows
+  // are performed on the values of each column; these columns are always
+  // returned in regular JavaScript arrays.
+  //---------------------------------------------------------------------------
+  async _processColumns(batch, expandNestedCursors) {
+
+    // transform any nested cursors into user facing objects
+    for (const i of this._impl.nestedCursorIndices) {
+      const values = batch.columns[i].values;
+      for (let j = 0; j < batch.numRows; j++) {
+        const val = values[j];
+        if (val) {
+          const resultSet = new ResultSet();
+          resultSet._setup(this._connection, val);
+          this._impl.metaData[i].metaData = val.metaData;
+          if (expandNestedCursors) {
+            values[j] = await resultSet._getAllRows();
+          } else {
+            values[j] = resultSet;
+          }
+        }
+      }
+    }
+
+    // transform any LOBs into user facing objects
+    for (const i of this._impl.lobIndices) {
+      const values = batch.columns[i].values;
+      for (let j = 0; j < batch.numRows; j++) {
+        const val = values[j];
+        if (val) {
+          const lob = values[j] = new Lob();
+          lob._setup(val, true);
+        }
+      }
+    }
+
+    // transform any database objects into user facing objects
+    for (const i of this._impl.dbObjectIndices) {
+      const dbObjectClass = this._impl.metaData[i].dbTypeClass;
+      const values = batch.columns[i].values;
+      for (let j = 0; j < batch.numRows; j++) {
+        const val = values[j];
+        if (val) {
+          const obj = values[j] = Object.create(dbObjectClass.prototype);
+          obj._impl = val;
+          if (this._impl.dbObjectAsPojo) {
+            values[j] = obj._toPojo();
+          } else if (obj.isCollection) {
+            values[j] = new Proxy(obj, BaseDbObject._collectionProxyHandler);
+          }
+        }
+      }
+    }
+
+    // run any conversion functions, if applicable; see the note in
+    // _processRows() regarding the connection in progress flag
+    for (const i of this._impl.converterIndices) {
+      const fn = this._impl.metaData[i].converter;
+      const values = batch.columns[i].values;
+      this._connection._impl._inProgress = false;
+      try {
+        for (let j = 0; j < batch.numRows; j++) {
+          let result = fn(values[j]);
+          if (result instanceof Promise) {
+            result = await result;
+          }
+          values[j] = result;
+        }
+      } finally {
+        this._connection._impl._inProgress = true;
+      }
+    }
+
   }
 
   //---------------------------------------------------------------------------
@@ -116,18 +403,29 @@ class ResultSet {
   //---------------------------------------------------------------------------
   async _processRows(rows, expandNestedCursors) {
 
+    // columns are processed separately
+    if (this._impl.outFormat === constants.OUT_FORMAT_COLUMNS) {
+      return await this._processColumns(rows, expandNestedCursors);
+    }
+
+    // rows are returned by the implementation as arrays or, if desired, as
+    // objects keyed by the (unique) column names
+    const metaData = this._impl.metaData;
+    const asObjects = (this._impl.outFormat === constants.OUT_FORMAT_OBJECT);
+
     // transform any nested cursors into user facing objects
     for (const i of this._impl.nestedCursorIndices) {
+      const key = (asObjects) ? metaData[i].name : i;
       for (let j = 0; j < rows.length; j++) {
-        const val = rows[j][i];
+        const val = rows[j][key];
         if (val) {
           const resultSet = new ResultSet();
           resultSet._setup(this._connection, val);
-          this._impl.metaData[i].metaData = val.metaData;
+          metaData[i].metaData = val.metaData;
           if (expandNestedCursors) {
-            rows[j][i] = await resultSet._getAllRows();
+            rows[j][key] = await resultSet._getAllRows();
           } else {
-            rows[j][i] = resultSet;
+            rows[j][key] = resultSet;
           }
         }
       }
@@ -135,10 +433,11 @@ class ResultSet {
 
     // transform any LOBs into user facing objects
     for (const i of this._impl.lobIndices) {
+      const key = (asObjects) ? metaData[i].name : i;
       for (let j = 0; j < rows.length; j++) {
-        const val = rows[j][i];
+        const val = rows[j][key];
         if (val) {
-          const lob = rows[j][i] = new Lob();
+          const lob = rows[j][key] = new Lob();
           lob._setup(val, true);
         }
       }
@@ -146,16 +445,17 @@ class ResultSet {
 
     // transform any database objects into user facing objects
     for (const i of this._impl.dbObjectIndices) {
-      const dbObjectClass = this._impl.metaData[i].dbTypeClass;
+      const key = (asObjects) ? metaData[i].name : i;
+      const dbObjectClass = metaData[i].dbTypeClass;
       for (let j = 0; j < rows.length; j++) {
-        const val = rows[j][i];
+        const val = rows[j][key];
         if (val) {
-          const obj = rows[j][i] = Object.create(dbObjectClass.prototype);
+          const obj = rows[j][key] = Object.create(dbObjectClass.prototype);
           obj._impl = val;
           if (this._impl.dbObjectAsPojo) {
-            rows[j][i] = obj._toPojo();
+            rows[j][key] = obj._toPojo();
           } else if (obj.isCollection) {
-            rows[j][i] = new Proxy(obj, BaseDbObject._collectionProxyHandler);
+            rows[j][key] = new Proxy(obj, BaseDbObject._collectionProxyHandler);
           }
         }
       }
@@ -167,33 +467,22 @@ class ResultSet {
     // the database (like getting LOB data) to succeed, as this code is running
     // in the middle of a call to connection.execute() or resultSet.getRows()
     for (const i of this._impl.converterIndices) {
-      const fn = this._impl.metaData[i].converter;
+      const key = (asObjects) ? metaData[i].name : i;
+      const fn = metaData[i].converter;
       this._connection._impl._inProgress = false;
       try {
         for (let j = 0; j < rows.length; j++) {
-          let result = fn(rows[j][i]);
+          let result = fn(rows[j][key]);
           if (result instanceof Promise) {
             result = await result;
           }
-          rows[j][i] = result;
+          rows[j][key] = result;
         }
       } finally {
         this._connection._impl._inProgress = true;
       }
     }
 
-    // create objects, if desired
-    if (this._impl.outFormat === constants.OUT_FORMAT_OBJECT) {
-      for (let i = 0; i < rows.length; i++) {
-        const origRow = rows[i];
-        const newRow = rows[i] = {};
-        const metaData = this._impl.metaData;
-        for (let j = 0; j < metaData.length; j++) {
-          newRow[metaData[j].name] = origRow[j];
-        }
-      }
-    }
-
   }
 
   //---------------------------------------------------------------------------
@@ -217,6 +506,11 @@ class ResultSet {
     this._processingStarted = true;
     const resultSetImpl = this._impl;
     delete this._impl;
+    if (this._fetchAhead) {
+      this._fetchAhead.cancelled = true;
+      this._fetchAhead = null;
+    }
+    this._fetchedRows = null;
     await resultSetImpl.close();
   }
 
@@ -236,6 +530,8 @@ class ResultSet {
     if (this._convertedToStream && !this._allowGetRowCall) {
       errors.throwErr(errors.ERR_CANNOT_INVOKE_RS_METHODS);
     }
+    errors.assert(this._impl.outFormat !== constants.OUT_FORMAT_COLUMNS,
+      errors.ERR_NOT_SUPPORTED_WITH_COLUMNS, "getRow()");
 
     this._allowGetRowCall = false;
     this._processingStarted = true;
@@ -277,11 +573,15 @@ class ResultSet {
 
     this._processingStarted = true;
 
+    if (this._impl.outFormat === constants.OUT_FORMAT_COLUMNS) {
+      return await this._doGetColumns(numRows);
+    }
+
     let requestedRows;
     if (numRows == 0) {
       requestedRows = this._rowCache;
-      const fetchArraySize = this._impl.fetchArraySize;
       while (true) {
+        const fetchArraySize = this._impl.fetchArraySize;
         const rows = await this._getRows(fetchArraySize);
         if (rows) {
           await this._processRows(rows, false);
@@ -343,6 +643,9 @@ class ResultSet {
   //---------------------------------------------------------------------------
   toQueryStream() {
     errors.assertArgCount(arguments, 0, 0);
+    if (this._impl && this._impl.outFormat === constants.OUT_FORMAT_COLUMNS) {
+      errors.throwErr(errors.ERR_NOT_SUPPORTED_WITH_COLUMNS, "toQueryStream()");
+    }
 
     if (this._processingStarted) {
       errors.throwErr(errors.ERR_CANNOT_CONVERT_RS_TO_STREAM);
@@ -45,8 +45,10 @@ class Settings {
     this.fetchArraySize = 100;
     this.fetchAsBuffer = [];
     this.fetchAsString = [];
+    this.jsonFetchMode = constants.JSON_FETCH_MODE_EAGER;
     this.lobPrefetchSize = 16384;
     this.maxRows = 0;
+    this.nativeWorkerThreads = 0;
     this.outFormat = constants.OUT_FORMAT_ARRAY;
     this.poolIncrement = 1;
     this.poolMax = 4;
@@ -63,6 +65,9 @@ class Settings {
     this.thin = true;
     this.thinDriverInitialized = false;
     this.thickModeDSNPassthrough = true;
+    this.thinNativeDecode = false;
+    this.vectorFetchMode = constants.VECTOR_FETCH_MODE_SEPARATE;
+    this._thinDecodeRows = null;
     this.createFetchTypeMap(this.fetchAsString, this.fetchAsBuffer);
     this.fetchTypeHandler = undefined;
     this.dbObjectTypeHandler = undefined;
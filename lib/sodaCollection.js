@@ -28,6 +28,7 @@
 
 const SodaDocument = require('./sodaDocument.js');
 const SodaOperation = require('./sodaOperation.js');
+const constants = require('./constants.js');
 const errors = require('./errors.js');
 const nodbUtil = require('./util.js');
 const settings = require('./settings.js');
@@ -38,6 +39,162 @@ class SodaCollection {
     this._sodaDb = sodaDb;
   }
 
+  //---------------------------------------------------------------------------
+  // _insertManyBatches()
+  //
+  // Reads documents from the source supplied to insertManyStream() or
+  // insertManyAndGetStream() and inserts (or saves) them in batches. The
+  // SODA document handles for the next batch are created while the previous
+  // batch is being inserted by the database. The result of each batch is
+  // yielded in turn. If a lock on the connection is not already held, it is
+  // acquired for each batch.
+  //---------------------------------------------------------------------------
+  async *_insertManyBatches(source, options, getResultDocs, acquireLock) {
+    const iterator = (typeof source[Symbol.asyncIterator] === 'function') ?
+      source[Symbol.asyncIterator]() : source[Symbol.iterator]();
+    const autoCommit = options.autoCommit;
+    const batchOptions = {...options, autoCommit: false};
+    let completed = false;
+    try {
+      let batch = await this._readSodaDocBatch(iterator, options.batchSize);
+      while (batch) {
+        const [insertOutcome, readOutcome] = await Promise.allSettled([
+          this._insertManyBatch(batch, batchOptions, getResultDocs,
+            acquireLock),
+          this._readSodaDocBatch(iterator, options.batchSize)
+        ]);
+        if (insertOutcome.status === 'rejected')
+          throw insertOutcome.reason;
+        if (readOutcome.status === 'rejected')
+          throw readOutcome.reason;
+        batch = readOutcome.value;
+        if (!batch && autoCommit)
+          await this._runWithLock(() => this._impl._getConnImpl().commit(),
+            acquireLock);
+        yield insertOutcome.value;
+      }
+      completed = true;
+    } finally {
+      if (!completed && typeof iterator.return === 'function')
+        await iterator.return();
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // _insertManyBatch()
+  //
+  // Inserts (or saves) a batch of SODA document implementations. If result
+  // documents are requested, an array of SodaDocument objects is returned;
+  // otherwise, the number of documents in the batch is returned.
+  //---------------------------------------------------------------------------
+  async _insertManyBatch(docImpls, options, getResultDocs, acquireLock) {
+    return await this._runWithLock(async () => {
+      let resultDocImpls;
+      if (options.save && getResultDocs) {
+        resultDocImpls = await this._impl.saveManyAndGet(docImpls, options);
+      } else if (options.save) {
+        await this._impl.saveMany(docImpls, options);
+      } else if (getResultDocs) {
+        resultDocImpls = await this._impl.insertManyAndGet(docImpls, options);
+      } else {
+        await this._impl.insertMany(docImpls, options);
+      }
+      if (!resultDocImpls)
+        return docImpls.length;
+      const resultDocs = new Array(resultDocImpls.length);
+      for (let i = 0; i < resultDocImpls.length; i++) {
+        resultDocs[i] = new SodaDocument();
+        resultDocs[i]._impl = resultDocImpls[i];
+      }
+      return resultDocs;
+    }, acquireLock);
+  }
+
+  //---------------------------------------------------------------------------
+  // _readSodaDocBatch()
+  //
+  // Reads up to the specified number of documents from the source and returns
+  // an array of SODA document implementations. If the source has no more
+  // documents, undefined is returned.
+  //---------------------------------------------------------------------------
+  async _readSodaDocBatch(iterator, batchSize) {
+    const docImpls = [];
+    while (docImpls.length < batchSize) {
+      const item = await iterator.next();
+      if (item.done)
+        break;
+      const value = item.value;
+      if (value != null && value._sodaDocumentMarker) {
+        docImpls.push(value._impl);
+      } else {
+        const content = this._sodaDb._verifySodaDoc(value);
+        docImpls.push(this._sodaDb._impl.createDocument(content, {}));
+      }
+    }
+    if (docImpls.length > 0)
+      return docImpls;
+  }
+
+  //---------------------------------------------------------------------------
+  // _runWithLock()
+  //
+  // Runs the function, first acquiring a lock on the connection if requested.
+  // This is used by insertManyStream() and insertManyAndGetStream() which do
+  // not hold the lock while reading from the source, since the source may
+  // itself use the connection (such as a query stream) and other operations
+  // on the connection should not wait for the whole source to be read.
+  //---------------------------------------------------------------------------
+  async _runWithLock(fn, acquireLock) {
+    if (!acquireLock)
+      return await fn();
+    const connImpl = this._impl._getConnImpl();
+    await connImpl._acquireLock();
+    try {
+      return await fn();
+    } catch (err) {
+      throw errors.transformErr(err);
+    } finally {
+      connImpl._releaseLock();
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // _verifyInsertManyStreamArgs()
+  //
+  // Verifies the arguments passed to insertManyStream() and
+  // insertManyAndGetStream() and returns the options to use.
+  //---------------------------------------------------------------------------
+  _verifyInsertManyStreamArgs(args, allowHint) {
+    const options = {
+      autoCommit: settings.autoCommit,
+      batchSize: constants.DEFAULT_SODA_INSERT_MANY_BATCH_SIZE,
+      save: false
+    };
+    errors.assertArgCount(args, 1, 2);
+    const source = args[0];
+    errors.assertParamValue(nodbUtil.isObject(source) &&
+      (typeof source[Symbol.asyncIterator] === 'function' ||
+      typeof source[Symbol.iterator] === 'function'), 1);
+    if (args.length == 2) {
+      const a2 = args[1];
+      errors.assertParamValue(nodbUtil.isObject(a2), 2);
+      if (a2.batchSize !== undefined) {
+        errors.assertParamPropValue(Number.isInteger(a2.batchSize) &&
+          a2.batchSize > 0, 2, "batchSize");
+        options.batchSize = a2.batchSize;
+      }
+      if (a2.save !== undefined) {
+        errors.assertParamPropBool(a2, 2, "save");
+        options.save = a2.save;
+      }
+      if (allowHint && a2.hint !== undefined) {
+        errors.assertParamPropValue(typeof a2.hint === 'string', 2, "hint");
+        options.hint = a2.hint;
+      }
+    }
+    return options;
+  }
+
   //---------------------------------------------------------------------------
   // createIndex()
   //
@@ -156,6 +313,45 @@ class SodaCollection {
     return actualDocs;
   }
 
+  //---------------------------------------------------------------------------
+  // insertManyAndGetStream()
+  //
+  // Inserts the documents supplied by an array, an iterable or an async
+  // iterable (such as a Readable stream in object mode) into the collection
+  // in batches. An async iterable is returned which yields a result document
+  // containing metadata for each document as soon as the batch containing it
+  // has been inserted.
+  //---------------------------------------------------------------------------
+  insertManyAndGetStream() {
+    const options = this._verifyInsertManyStreamArgs(arguments, true);
+    const source = arguments[0];
+    const coll = this;
+    return (async function *() {
+      for await (const docs of coll._insertManyBatches(source, options, true,
+        true)) {
+        yield* docs;
+      }
+    })();
+  }
+
+  //---------------------------------------------------------------------------
+  // insertManyStream()
+  //
+  // Inserts the documents supplied by an array, an iterable or an async
+  // iterable (such as a Readable stream in object mode) into the collection
+  // in batches, so that the documents do not all need to be held in memory
+  // at once. The number of documents inserted is returned.
+  //---------------------------------------------------------------------------
+  async insertManyStream() {
+    const options = this._verifyInsertManyStreamArgs(arguments, false);
+    let numDocs = 0;
+    for await (const count of this._insertManyBatches(arguments[0], options,
+      false, true)) {
+      numDocs += count;
+    }
+    return numDocs;
+  }
+
   //---------------------------------------------------------------------------
   // insertOne()
   //
@@ -281,4 +477,8 @@ nodbUtil.wrapFns(SodaCollection.prototype,
   "saveAndGet",
   "truncate");
 
+// insertManyStream() acquires the lock on the connection for each batch
+nodbUtil.wrapFns(SodaCollection.prototype, false,
+  "insertManyStream");
+
 module.exports = SodaCollection;
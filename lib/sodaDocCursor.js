@@ -26,12 +26,32 @@
 
 'use strict';
 
+const constants = require('./constants.js');
 const errors = require('./errors.js');
 const nodbUtil = require('./util.js');
 const SodaDocument = require('./sodaDocument.js');
 
 class SodaDocCursor {
 
+  constructor() {
+    this._fetchArraySize = constants.DEFAULT_FETCH_ARRAY_SIZE;
+    this._bufferedDocs = [];
+  }
+
+  //---------------------------------------------------------------------------
+  // _makeDocs()
+  //
+  // Wraps an array of document implementations in SodaDocument objects.
+  //---------------------------------------------------------------------------
+  _makeDocs(docImpls) {
+    const docs = new Array(docImpls.length);
+    for (let i = 0; i < docImpls.length; i++) {
+      docs[i] = new SodaDocument();
+      docs[i]._impl = docImpls[i];
+    }
+    return docs;
+  }
+
   //---------------------------------------------------------------------------
   // close()
   //
@@ -41,17 +61,21 @@ class SodaDocCursor {
     errors.assertArgCount(arguments, 0, 0);
     errors.assert(this._impl, errors.ERR_INVALID_SODA_DOC_CURSOR);
     await this._impl.close();
+    this._bufferedDocs = [];
     delete this._impl;
   }
 
   //---------------------------------------------------------------------------
   // getNext()
   //
-  // Return the next document available from the cursor.
+  // Return the next document available from the cursor. Documents already
+  // fetched by the async iterator are returned first.
   //---------------------------------------------------------------------------
   async getNext() {
     errors.assertArgCount(arguments, 0, 0);
     errors.assert(this._impl, errors.ERR_INVALID_SODA_DOC_CURSOR);
+    if (this._bufferedDocs.length > 0)
+      return this._bufferedDocs.shift();
     const docImpl = await this._impl.getNext();
     if (docImpl) {
       const doc = new SodaDocument();
@@ -60,11 +84,47 @@ class SodaDocCursor {
     }
   }
 
+  //---------------------------------------------------------------------------
+  // getNextBatch()
+  //
+  // Return an array containing up to the specified number of documents from
+  // the cursor. The documents are fetched in a single call to the thread
+  // pool. An empty array is returned when the cursor has no more documents.
+  //---------------------------------------------------------------------------
+  async getNextBatch(numDocs) {
+    errors.assertArgCount(arguments, 0, 1);
+    if (numDocs === undefined) {
+      numDocs = this._fetchArraySize;
+    } else {
+      errors.assertParamValue(Number.isInteger(numDocs) && numDocs > 0 &&
+        numDocs <= 0xFFFFFFFF, 1);
+    }
+    errors.assert(this._impl, errors.ERR_INVALID_SODA_DOC_CURSOR);
+    let docs = [];
+    if (this._bufferedDocs.length > 0) {
+      docs = this._bufferedDocs.splice(0, numDocs);
+      if (docs.length === numDocs)
+        return docs;
+      numDocs -= docs.length;
+    }
+    const docImpls = await this._impl.getNextBatch(numDocs);
+    return docs.concat(this._makeDocs(docImpls));
+  }
+
+  //---------------------------------------------------------------------------
+  // [Symbol.asyncIterator]()
+  //
+  // Returns documents from the cursor, fetching fetchArraySize documents at a
+  // time. The cursor is not closed when iteration completes.
+  //---------------------------------------------------------------------------
   [Symbol.asyncIterator]() {
     const cursor = this;
     return {
       async next() {
-        const doc = await cursor.getNext();
+        if (cursor._bufferedDocs.length === 0 && cursor._impl) {
+          cursor._bufferedDocs = await cursor.getNextBatch();
+        }
+        const doc = cursor._bufferedDocs.shift();
         return {value: doc, done: doc === undefined};
       },
       return() {
@@ -77,6 +137,7 @@ class SodaDocCursor {
 
 nodbUtil.wrapFns(SodaDocCursor.prototype,
   "close",
-  "getNext");
+  "getNext",
+  "getNextBatch");
 
 module.exports = SodaDocCursor;
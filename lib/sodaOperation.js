@@ -28,6 +28,7 @@
 
 const SodaDocCursor = require('./sodaDocCursor.js');
 const SodaDocument = require('./sodaDocument.js');
+const constants = require('./constants.js');
 const errors = require('./errors.js');
 const nodbUtil = require('./util.js');
 const settings = require('./settings.js');
@@ -39,6 +40,8 @@ class SodaOperation {
       autoCommit: settings.autoCommit,
       fetchArraySize: settings.fetchArraySize
     };
+    if (this._options.fetchArraySize === constants.FETCH_ARRAY_SIZE_AUTO)
+      this._options.fetchArraySize = constants.DEFAULT_FETCH_ARRAY_SIZE;
     this._sodaDb = sodaDb;
   }
 
@@ -62,9 +65,33 @@ class SodaOperation {
     errors.assertArgCount(arguments, 0, 0);
     const cursor = new SodaDocCursor();
     cursor._impl = await this._impl.getCursor(this._options);
+    cursor._fetchArraySize = this._options.fetchArraySize ||
+      constants.DEFAULT_FETCH_ARRAY_SIZE;
     return cursor;
   }
 
+  //---------------------------------------------------------------------------
+  // [Symbol.asyncIterator]()
+  //
+  // Returns the documents that match the search criteria without holding all
+  // of them in memory. A cursor is opened when iteration starts and
+  // fetchArraySize documents are fetched at a time. The cursor is closed when
+  // iteration completes or is stopped early.
+  //---------------------------------------------------------------------------
+  async *[Symbol.asyncIterator]() {
+    const cursor = await this.getCursor();
+    try {
+      while (true) {
+        const docs = await cursor.getNextBatch();
+        if (docs.length === 0)
+          break;
+        yield* docs;
+      }
+    } finally {
+      await cursor.close();
+    }
+  }
+
   //---------------------------------------------------------------------------
   // getDocuments()
   //   Return an array of documents that match the search criteria.
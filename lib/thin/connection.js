@@ -30,6 +30,7 @@ const { Buffer } = require('buffer');
 const ConnectionImpl = require('../impl/connection.js');
 const ThinResultSetImpl = require('./resultSet.js');
 const ThinLobImpl  = require("./lob.js");
+const ThinPreparedStatementImpl = require('./preparedStatement.js');
 const Protocol = require("./protocol/protocol.js");
 const { BaseBuffer } = require('../impl/datahandlers/buffer.js');
 const {NetworkSession: nsi} = require("./sqlnet/networkSession.js");
@@ -1265,11 +1266,29 @@ class ThinConnectionImpl extends ConnectionImpl {
   _prepare(sql, options) {
     const forceNew = Boolean(options.fetchTypeMap);
     const statement = this._getStatement(sql, options.keepInStmtCache, forceNew);
+    this._resetStatement(statement);
+    return statement;
+  }
+
+  //---------------------------------------------------------------------------
+  // Returns the statement pinned by a prepared statement, ready for execution
+  //---------------------------------------------------------------------------
+  _preparePinned(statement, options) {
+    const forceNew = Boolean(options.fetchTypeMap) ||
+      this._drcpEstablishSession;
+    statement = this.statementCache.getPinnedStatement(statement, forceNew);
+    this._resetStatement(statement);
+    return statement;
+  }
+
+  //---------------------------------------------------------------------------
+  // Resets the fetch state of the statement before it is executed
+  //---------------------------------------------------------------------------
+  _resetStatement(statement) {
     statement.bufferRowIndex = 0;
     statement.bufferRowCount = 0;
     statement.lastRowIndex = 0;
     statement.moreRowsToFetch = true;
-    return statement;
   }
 
   //---------------------------------------------------------------------------
@@ -1314,11 +1333,13 @@ class ThinConnectionImpl extends ConnectionImpl {
     if (variable.type === types.DB_TYPE_CLOB ||
         variable.type === types.DB_TYPE_NCLOB ||
         variable.type === types.DB_TYPE_BLOB) {
+      let chunkSize;
       for (const [index, val] of variable.values.entries()) {
         if (!(val instanceof ThinLobImpl)) {
           if (val && val.length > 0) {
             const lobImpl = new ThinLobImpl();
-            await lobImpl.create(this, variable.type);
+            await lobImpl.create(this, variable.type, chunkSize);
+            chunkSize = lobImpl._chunkSize;
             internalTempLobs.push(lobImpl);
             await lobImpl.write(1, val);
             variable.values[index] = lobImpl;
@@ -1380,6 +1401,18 @@ class ThinConnectionImpl extends ConnectionImpl {
     return info;
   }
 
+  //---------------------------------------------------------------------------
+  // prepare()
+  //
+  // Returns a prepared statement which retains its statement (and cursor)
+  // until it is closed.
+  //---------------------------------------------------------------------------
+  prepare(sql) {
+    const stmtImpl = new ThinPreparedStatementImpl();
+    stmtImpl._setup(this, sql);
+    return stmtImpl;
+  }
+
   //---------------------------------------------------------------------------
   // getStatementInfo()
   //
@@ -1421,8 +1454,11 @@ class ThinConnectionImpl extends ConnectionImpl {
   //
   // Calls the RPC that executes a SQL statement and returns the results.
   //---------------------------------------------------------------------------
-  async execute(sql, numIters, binds, options, executeManyFlag) {
-    const statement = this._prepare(sql, options);
+  async execute(sql, numIters, binds, options, executeManyFlag,
+    preparedStmtImpl) {
+    const statement = (preparedStmtImpl) ?
+      this._preparePinned(preparedStmtImpl.statement, options) :
+      this._prepare(sql, options);
     const internalTempLobs = [];
     try {
       return await this._execute(statement, numIters, binds, options,
@@ -1439,6 +1475,16 @@ class ThinConnectionImpl extends ConnectionImpl {
     }
   }
 
+  //---------------------------------------------------------------------------
+  // executePrepared()
+  //
+  // Executes the statement pinned by a prepared statement.
+  //---------------------------------------------------------------------------
+  async executePrepared(stmtImpl, numIters, binds, options, executeManyFlag) {
+    return await this.execute(stmtImpl.sql, numIters, binds, options,
+      executeManyFlag, stmtImpl);
+  }
+
   async _prepareForExecute(sql, numIters, binds, options, executeManyFlag) {
     const statement = this._prepare(sql, options);
     const internalTempLobs = [];
@@ -1557,6 +1603,35 @@ class ThinConnectionImpl extends ConnectionImpl {
     return lobImpl;
   }
 
+  //---------------------------------------------------------------------------
+  // createLobs()
+  //
+  // Creates a number of temporary LOBs. Newly created temporary LOBs of the
+  // same type share the same chunk size so it is only requested from the
+  // database for the first LOB. If any LOB cannot be created, the LOBs that
+  // were already created are closed before the error is thrown.
+  //---------------------------------------------------------------------------
+  async createLobs(dbType, count) {
+    const lobImpls = [];
+    let chunkSize;
+    try {
+      for (let i = 0; i < count; i++) {
+        const lobImpl = new ThinLobImpl();
+        await lobImpl.create(this, dbType, chunkSize);
+        chunkSize = lobImpl._chunkSize;
+        lobImpls.push(lobImpl);
+      }
+    } catch (err) {
+      if (this.nscon.connected) {
+        for (const lobImpl of lobImpls) {
+          lobImpl.close();
+        }
+      }
+      throw err;
+    }
+    return lobImpls;
+  }
+
   // Check the state returned by the tpcCommit() call.
   checkTpcCommitState(state, onePhase) {
     if ((onePhase && state !== constants.TNS_TPC_TXN_STATE_READ_ONLY
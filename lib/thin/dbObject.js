@@ -273,7 +273,7 @@ class ThinDbObjectImpl extends DbObjectImpl {
           buf.writeBytesWithLength(Buffer.from(value, 'utf16le').swap16());
           break;
         case types.DB_TYPE_NUMBER:
-          buf.writeOracleNumber(value.toString());
+          buf.writeOracleNumber(value);
           break;
         case types.DB_TYPE_BINARY_INTEGER:
         case types.DB_TYPE_BOOLEAN:
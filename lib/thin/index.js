@@ -30,6 +30,7 @@ const ThinConnectionImpl = require('./connection.js');
 const ThinResultSetImpl = require('./resultSet.js');
 const ThinPoolImpl = require('./pool.js');
 const ThinLobImpl = require('./lob.js');
+const ThinPreparedStatementImpl = require('./preparedStatement.js');
 const { ThinDbObjectImpl } = require('./dbObject.js');
 
 const impl = require('../impl');
@@ -37,4 +38,5 @@ impl.ConnectionImpl = ThinConnectionImpl;
 impl.ResultSetImpl = ThinResultSetImpl;
 impl.PoolImpl = ThinPoolImpl;
 impl.LobImpl = ThinLobImpl;
+impl.PreparedStatementImpl = ThinPreparedStatementImpl;
 impl.DbObjectImpl = ThinDbObjectImpl;
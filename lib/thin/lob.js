@@ -228,8 +228,10 @@ class ThinLobImpl extends LobImpl {
    *
    * @param {object} conn Connection Impl object
    * @param {number} dbType indicates BLOB/CLOB DB type
+   * @param {number} [chunkSize] chunk size already known for temporary LOBs
+   *   of this type; when not specified it is requested from the database
    */
-  async create(conn, dbType) {
+  async create(conn, dbType, chunkSize) {
     this.dirtyLength = false;
     this.conn = conn;
     this.dbType = dbType;
@@ -244,7 +246,11 @@ class ThinLobImpl extends LobImpl {
       destLength: constants.TNS_DURATION_SESSION
     };
     await this._sendMessage(options);
-    await this._getChunkSizeAsync();
+    if (chunkSize) {
+      this._chunkSize = this._pieceSize = chunkSize;
+    } else {
+      await this._getChunkSizeAsync();
+    }
   }
 
   //---------------------------------------------------------------------------
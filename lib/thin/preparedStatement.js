@@ -0,0 +1,57 @@
+// Copyright (c) 2026, Oracle and/or its affiliates.
+
+//-----------------------------------------------------------------------------
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-----------------------------------------------------------------------------
+
+'use strict';
+
+const PreparedStatementImpl = require('../impl/preparedStatement.js');
+
+class ThinPreparedStatementImpl extends PreparedStatementImpl {
+
+  //---------------------------------------------------------------------------
+  // _setup()
+  //
+  // Pins the statement in the statement cache of the connection so that the
+  // cursor is retained across executions.
+  //---------------------------------------------------------------------------
+  _setup(connImpl, sql) {
+    super._setup(connImpl, sql);
+    this.statement = connImpl.statementCache.pinStatement(sql);
+  }
+
+  //---------------------------------------------------------------------------
+  // close()
+  //
+  // Unpins the statement. The cursor is closed on the next round trip to the
+  // database.
+  //---------------------------------------------------------------------------
+  close() {
+    this._connImpl.statementCache.unpinStatement(this.statement);
+    this.statement = null;
+  }
+
+}
+
+module.exports = ThinPreparedStatementImpl;
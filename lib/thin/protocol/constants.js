@@ -931,6 +931,20 @@ module.exports = {
   VECTOR_META_FLAG_FLEXIBLE_DIM: 1,
   VECTOR_META_FLAG_SPARSE: 2,
 
+  // kinds and flags of columns decoded by the native row decoder; these must
+  // match the values defined in njsModule.h
+  NATIVE_DECODE_NULL: 0,
+  NATIVE_DECODE_STRING: 1,
+  NATIVE_DECODE_NSTRING: 2,
+  NATIVE_DECODE_RAW: 3,
+  NATIVE_DECODE_NUMBER: 4,
+  NATIVE_DECODE_DATE_LOCAL: 5,
+  NATIVE_DECODE_DATE_UTC: 6,
+  NATIVE_DECODE_BINARY_DOUBLE: 7,
+  NATIVE_DECODE_BINARY_FLOAT: 8,
+  NATIVE_DECODE_BOOLEAN: 9,
+  NATIVE_DECODE_FLAG_INDICATORS: 0x01,
+
   // other constants
   PACKET_HEADER_SIZE: 8,
   NUMBER_AS_TEXT_CHARS: 172,
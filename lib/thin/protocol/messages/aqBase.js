@@ -235,8 +235,11 @@ class AqBaseMessage extends BaseMessage {
   //--------------------------------------------------------------------------
   _writePayload(buf, propsImpl) {
     if (this.queueImpl.isJson) {
+      if (!this.osonEncoder) {
+        this.osonEncoder = new oson.OsonEncoder();
+      }
       buf.writeOson(propsImpl.payload, this.connection._osonMaxFieldNameSize,
-        false);
+        false, this.osonEncoder);
     } else if (this.queueImpl.payloadTypeClass) {
       buf.writeDbObject(propsImpl.payload);
     } else {
@@ -101,6 +101,8 @@ class PieceBuffer extends BaseBuffer {
     this._encodingTempBuf = new BaseBuffer(
       Buffer.alloc(constants.TNS_DPLS_MAX_BUFFER_SIZE_FACTOR)
     );
+    this._osonEncoder = null;
+    this._vectorEncoder = null;
   }
 
   _writeMoreData() {
@@ -233,7 +235,7 @@ class PieceBuffer extends BaseBuffer {
       columnDataBuffer = Buffer.from(value);
       // Encode the data bytes into a temporary buffer for Oracle types
     } else if (oraType === types.DB_TYPE_NUMBER) {
-      this._encodingTempBuf.writeOracleNumber(value.toString(), false);
+      this._encodingTempBuf.writeOracleNumber(value, false);
     } else if (oraType === types.DB_TYPE_BINARY_DOUBLE) {
       this._encodingTempBuf.writeBinaryDouble(value);
     } else if (oraType === types.DB_TYPE_BINARY_FLOAT) {
@@ -259,14 +261,18 @@ class PieceBuffer extends BaseBuffer {
         this._encodingTempBuf.writeUInt8(0x00);
       }
     } else if (oraType === types.DB_TYPE_JSON) {
-      const encoder = new oson.OsonEncoder();
-      columnDataBuffer = encoder.encode(
+      if (!this._osonEncoder) {
+        this._osonEncoder = new oson.OsonEncoder();
+      }
+      columnDataBuffer = this._osonEncoder.encode(
         value,
         this.connection._osonMaxFieldSize
       );
     } else if (oraType === types.DB_TYPE_VECTOR) {
-      const encoder = new vector.VectorEncoder();
-      columnDataBuffer = encoder.encode(value);
+      if (!this._vectorEncoder) {
+        this._vectorEncoder = new vector.VectorEncoder();
+      }
+      columnDataBuffer = this._vectorEncoder.encode(value);
     } else {
       errors.throwErr(
         errors.ERR_UNSUPPORTED_DATA_TYPE,
@@ -144,17 +144,20 @@ class LobOpMessage extends Message {
   processMessage(buf, messageType) {
     if (messageType === constants.TNS_MSG_TYPE_LOB_DATA) {
       const oraTypeNum = this.sourceLobImpl.dbType._oraTypeNum;
-      let data = buf.readBytesWithLength();
-      if (data !== null) {
-        if (
-          oraTypeNum === constants.TNS_DATA_TYPE_BLOB ||
-          oraTypeNum === constants.TNS_DATA_TYPE_BFILE
-        ) {
-          data = Buffer.from(data);
-        } else if (this.sourceLobImpl.getCsfrm() === constants.CSFRM_NCHAR) {
-          data = Buffer.from(data).swap16().toString('utf16le');
-        } else {
-          data = data.toString();
+      let data;
+      if (
+        oraTypeNum === constants.TNS_DATA_TYPE_BLOB ||
+        oraTypeNum === constants.TNS_DATA_TYPE_BFILE
+      ) {
+        data = buf.readRetainableBytesWithLength();
+      } else {
+        data = buf.readBytesWithLength();
+        if (data !== null) {
+          if (this.sourceLobImpl.getCsfrm() === constants.CSFRM_NCHAR) {
+            data = Buffer.from(data).swap16().toString('utf16le');
+          } else {
+            data = data.toString();
+          }
         }
       }
       this.data = data;
@@ -33,7 +33,11 @@ const Message = require("./base.js");
 const { ThinDbObjectImpl, readXML } = require("../../dbObject.js");
 const ThinLobImpl = require("../../lob.js");
 const errors = require('../../../errors');
+const oson = require('../../../impl/datahandlers/oson.js');
+const vector = require('../../../impl/datahandlers/vector.js');
 const types = require('../../../types.js');
+const settings = require('../../../settings.js');
+const nodbUtil = require('../../../util.js');
 
 /**
  * Handles data like row header, rowdata , ... recevied from an RPC Execute
@@ -73,6 +77,7 @@ class MessageWithData extends Message {
       this.statement.bufferRowIndex = 0;
       this.processDescribeInfo(buf, this.resultSet, prevQueryVars);
       this.outVariables = this.statement.queryVars;
+      this.nativeColumns = undefined;
     } else if (messageType === constants.TNS_MSG_TYPE_ROW_HEADER) {
       this.processRowHeader(buf);
     } else if (messageType === constants.TNS_MSG_TYPE_ROW_DATA) {
@@ -215,8 +220,108 @@ class MessageWithData extends Message {
     return (this.bitVector[byteNum] & (1 << bitNum)) === 0;
   }
 
+  //---------------------------------------------------------------------------
+  // getNativeColumns()
+  //
+  // Returns the kinds and flags of each column for use by the native row
+  // decoder, or null if any of the columns are of a type that it does not
+  // support.
+  //---------------------------------------------------------------------------
+  getNativeColumns(caps) {
+    const columns = new Uint8Array(this.outVariables.length * 2);
+    for (const [col, variable] of this.outVariables.entries()) {
+      const oraTypeNum = variable.type._oraTypeNum;
+      let kind;
+      if (variable.isArray) {
+        return null;
+      } else if (variable.maxSize === 0) {
+        if (oraTypeNum === constants.TNS_DATA_TYPE_LONG ||
+            oraTypeNum === constants.TNS_DATA_TYPE_LONG_RAW ||
+            oraTypeNum === constants.TNS_DATA_TYPE_UROWID) {
+          return null;
+        }
+        kind = constants.NATIVE_DECODE_NULL;
+      } else {
+        switch (oraTypeNum) {
+          case constants.TNS_DATA_TYPE_VARCHAR:
+          case constants.TNS_DATA_TYPE_CHAR:
+            if (variable.type._csfrm === constants.CSFRM_NCHAR) {
+              caps.checkNCharsetId();
+              kind = constants.NATIVE_DECODE_NSTRING;
+            } else {
+              kind = constants.NATIVE_DECODE_STRING;
+            }
+            break;
+          case constants.TNS_DATA_TYPE_RAW:
+            kind = constants.NATIVE_DECODE_RAW;
+            break;
+          case constants.TNS_DATA_TYPE_NUMBER:
+            kind = constants.NATIVE_DECODE_NUMBER;
+            break;
+          case constants.TNS_DATA_TYPE_DATE:
+          case constants.TNS_DATA_TYPE_TIMESTAMP:
+            kind = constants.NATIVE_DECODE_DATE_LOCAL;
+            break;
+          case constants.TNS_DATA_TYPE_TIMESTAMP_LTZ:
+          case constants.TNS_DATA_TYPE_TIMESTAMP_TZ:
+            kind = constants.NATIVE_DECODE_DATE_UTC;
+            break;
+          case constants.TNS_DATA_TYPE_BINARY_DOUBLE:
+            kind = constants.NATIVE_DECODE_BINARY_DOUBLE;
+            break;
+          case constants.TNS_DATA_TYPE_BINARY_FLOAT:
+            kind = constants.NATIVE_DECODE_BINARY_FLOAT;
+            break;
+          case constants.TNS_DATA_TYPE_BOOLEAN:
+            kind = constants.NATIVE_DECODE_BOOLEAN;
+            break;
+          default:
+            return null;
+        }
+      }
+      columns[col * 2] = kind;
+      if (variable.maxSize > caps.maxStringSize) {
+        columns[col * 2 + 1] = constants.NATIVE_DECODE_FLAG_INDICATORS;
+      }
+    }
+    return columns;
+  }
+
+  //---------------------------------------------------------------------------
+  // processRowDataNative()
+  //
+  // Decodes the current row, and any further rows that are contained entirely
+  // within the current packet, using the native row decoder. Returns false if
+  // no rows were decoded, in which case the row is processed in JavaScript.
+  //---------------------------------------------------------------------------
+  processRowDataNative(buf) {
+    if (this.nativeColumns === undefined) {
+      this.nativeColumns = this.getNativeColumns(buf.caps);
+    }
+    if (!this.nativeColumns) {
+      return false;
+    }
+    const values = this.outVariables.map(variable => variable.values);
+    const [numRows, pos] = settings._thinDecodeRows(buf.buf, buf.pos,
+      buf.size, this.nativeColumns, values, this.rowIndex,
+      this.bitVector || null, nodbUtil.makeDate);
+    if (numRows === 0) {
+      return false;
+    }
+    buf.pos = pos;
+    this.rowIndex += numRows;
+    this.statement.lastRowIndex = this.rowIndex - 1;
+    this.statement.bufferRowCount += numRows;
+    this.bitVector = null;
+    return true;
+  }
+
   processRowData(buf) {
     let value;
+    if (this.inFetch && !this.statement.isReturning &&
+        settings.thinNativeDecode && this.processRowDataNative(buf)) {
+      return;
+    }
     for (const [col, variable] of this.outVariables.entries()) {
       if (variable.isArray) {
         variable.numElementsInArray = buf.readUB4();
@@ -302,10 +407,7 @@ class MessageWithData extends Message {
       colValue = buf.readStr(csfrm);
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_RAW ||
       oraTypeNum === constants.TNS_DATA_TYPE_LONG_RAW) {
-      colValue = buf.readBytesWithLength();
-      if (colValue !== null) {
-        colValue = Buffer.from(colValue);
-      }
+      colValue = buf.readRetainableBytesWithLength();
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_NUMBER) {
       colValue = buf.readOracleNumber();
       if (!this.inFetch && colValue !== null)
@@ -386,9 +488,16 @@ class MessageWithData extends Message {
         colValue.init(this.connection, locator, dbType, length, chunkSize);
       }
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_JSON) {
-      colValue = buf.readOson();
+      if (variable.fetchInfo &&
+          variable.fetchInfo.fetchType === types.DB_TYPE_RAW) {
+        colValue = buf.readOsonImage();
+      } else if (variable.decodeJsonLazily) {
+        colValue = buf.readOsonLazy();
+      } else {
+        colValue = buf.readOson();
+      }
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_VECTOR) {
-      colValue = buf.readVector();
+      colValue = buf.readVector(variable.vectorSlab);
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_INT_NAMED) {
       const obj = buf.readDbObject();
       if (obj.packedData) {
@@ -504,7 +613,11 @@ class MessageWithData extends Message {
             variable.type === types.DB_TYPE_BLOB ||
             variable.type === types.DB_TYPE_JSON ||
             variable.type === types.DB_TYPE_VECTOR) {
-          if (variable.type !== variable.fetchInfo.fetchType) {
+          // JSON fetched as a buffer is still defined as JSON; the OSON
+          // image is returned without being decoded
+          if (variable.type !== variable.fetchInfo.fetchType &&
+              !(variable.type === types.DB_TYPE_JSON &&
+              variable.fetchInfo.fetchType === types.DB_TYPE_RAW)) {
             variable.type = variable.fetchInfo.fetchType;
             variable.maxSize = constants.TNS_MAX_LONG_LENGTH;
           }
@@ -643,12 +756,14 @@ class MessageWithData extends Message {
         for (let i = 0; i < numElements; i++) {
           this.writeBindParamsColumn(buf, variable, variable.values[i]);
         }
+      } else if (variable.dims !== undefined) {
+        this.writeBindParamsVectorRow(buf, variable, pos + offset);
       } else {
         if ((!this.statement.isPlSql) && variable.maxSize > buf.caps.maxStringSize) {
           foundLong = true;
         } else {
           this.writeBindParamsColumn(buf, variable,
-            variable.values[pos + offset]);
+            getBindValue(variable, pos + offset));
         }
       }
     }
@@ -658,15 +773,33 @@ class MessageWithData extends Message {
           continue;
         const variable = bindInfo.bindVar;
         if (variable.maxSize > buf.caps.maxStringSize) {
-          this.writeBindParamsColumn(buf, variable, variable.values[pos + offset]);
+          this.writeBindParamsColumn(buf, variable,
+            getBindValue(variable, pos + offset));
         }
       }
     }
   }
 
+  //---------------------------------------------------------------------------
+  // writeBindParamsVectorRow()
+  //
+  // Writes one row of a matrix of vectors supplied to executeMany(). The
+  // vector is encoded directly from the matrix.
+  //---------------------------------------------------------------------------
+  writeBindParamsVectorRow(buf, variable, pos) {
+    if (variable.nulls && (variable.nulls[pos >> 3] & (1 << (pos & 7)))) {
+      buf.writeUInt8(0);
+    } else {
+      if (!this.vectorEncoder) {
+        this.vectorEncoder = new vector.VectorEncoder();
+      }
+      buf.writeVectorElements(variable.values, pos * variable.dims,
+        variable.dims, this.vectorEncoder);
+    }
+  }
+
   writeBindParamsColumn(buf, variable, value) {
     const oraTypeNum = variable.type._oraTypeNum;
-    let tempVal;
     if ((value === undefined || value === null) && oraTypeNum !== constants.TNS_DATA_TYPE_CURSOR && oraTypeNum !== constants.TNS_DATA_TYPE_JSON) {
       if (oraTypeNum === constants.TNS_DATA_TYPE_BOOLEAN) {
         buf.writeUInt8(constants.TNS_ESCAPE_CHAR);
@@ -684,11 +817,9 @@ class MessageWithData extends Message {
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_NUMBER ||
       oraTypeNum === constants.TNS_DATA_TYPE_BINARY_INTEGER) {
       if (typeof value === 'boolean') {
-        tempVal = (value) ? "1" : "0";
-      } else {
-        tempVal = value.toString();
+        value = (value) ? 1 : 0;
       }
-      buf.writeOracleNumber(tempVal);
+      buf.writeOracleNumber(value);
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_VARCHAR ||
       oraTypeNum === constants.TNS_DATA_TYPE_CHAR ||
       oraTypeNum === constants.TNS_DATA_TYPE_LONG ||
@@ -747,9 +878,16 @@ class MessageWithData extends Message {
     } else if ([constants.TNS_DATA_TYPE_ROWID, constants.TNS_DATA_TYPE_UROWID].includes(oraTypeNum)) {
       buf.writeBytesWithLength(Buffer.from(value));
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_JSON) {
-      buf.writeOson(value, this.connection._osonMaxFieldNameSize);
+      if (!this.osonEncoder) {
+        this.osonEncoder = new oson.OsonEncoder();
+      }
+      buf.writeOson(value, this.connection._osonMaxFieldNameSize, true,
+        this.osonEncoder);
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_VECTOR) {
-      buf.writeVector(value);
+      if (!this.vectorEncoder) {
+        this.vectorEncoder = new vector.VectorEncoder();
+      }
+      buf.writeVector(value, this.vectorEncoder);
     } else if (oraTypeNum === constants.TNS_DATA_TYPE_INT_NAMED) {
       buf.writeDbObject(value);
     } else {
@@ -784,4 +922,12 @@ const isNullLength = (len) => {
   return len === 0 || len === constants.TNS_NULL_LENGTH_INDICATOR;
 };
 
+// columns of values supplied to executeMany() may be typed arrays which are
+// accompanied by a bitmap identifying which of the values are null
+const getBindValue = (variable, pos) => {
+  if (variable.nulls && (variable.nulls[pos >> 3] & (1 << (pos & 7))))
+    return null;
+  return variable.values[pos];
+};
+
 module.exports = MessageWithData;
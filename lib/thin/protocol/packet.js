@@ -30,6 +30,7 @@ const { BaseBuffer } = require('../../impl/datahandlers/buffer.js');
 const { Buffer } = require('buffer');
 const constants = require('./constants.js');
 const oson = require('../../impl/datahandlers/oson.js');
+const types = require('../../types.js');
 const utils = require('./utils.js');
 const vector = require('../../impl/datahandlers/vector.js');
 const errors = require("../../errors.js");
@@ -169,6 +170,39 @@ class ReadPacket extends BaseBuffer {
     return this.chunkedBytesBuf.endChunkedRead();
   }
 
+  /**
+   * Reads the length from the buffer and then returns a Buffer containing the
+   * specified number of bytes which may be retained by the caller. When a long
+   * value lies entirely within one packet, a view of the packet is returned
+   * instead of a copy; the packet buffers are never reused once they have been
+   * received. Short values are always copied (which is cheap) so that they do
+   * not keep the packet alive. If the length is 0 or the special null length
+   * indicator value, null is returned instead.
+   */
+  readRetainableBytesWithLength() {
+    const numBytes = this.readUInt8();
+    if (numBytes === 0 || numBytes === constants.TNS_NULL_LENGTH_INDICATOR)
+      return null;
+    if (numBytes !== constants.TNS_LONG_LENGTH_INDICATOR)
+      return Buffer.from(this.readBytes(numBytes));
+
+    // a value sent in a single chunk is returned directly (readBytes() only
+    // copies when the chunk is split across packets); values sent in multiple
+    // chunks are copied once into a buffer of the total size
+    const chunks = [];
+    while (true) {
+      const numBytesInChunk = this.readUB4();
+      if (numBytesInChunk === 0) {
+        break;
+      }
+      chunks.push(this.readBytes(numBytesInChunk));
+    }
+    if (chunks.length === 1) {
+      return chunks[0];
+    }
+    return Buffer.concat(chunks);
+  }
+
   skipBytes(numBytes) {
 
     // if no bytes are left in the buffer, a new packet needs to be fetched
@@ -390,6 +424,39 @@ class ReadPacket extends BaseBuffer {
     return decoder.decode();
   }
 
+  /**
+   * Reads OSON (QLocator followed by data) and returns a view over it which
+   * decodes values only when they are accessed.
+   */
+  readOsonLazy() {
+    const numBytes = this.readUB4();
+    if (numBytes === 0) {
+      return null;
+    }
+    this.skipUB8();                     // size (unused)
+    this.skipUB4();                     // chunk size (unused)
+    const image = Buffer.from(this.readBytesWithLength());
+    this.skipBytesChunked();            // locator (unused)
+    const decoder = new oson.OsonLazyDecoder(image);
+    return decoder.decode();
+  }
+
+  /**
+   * Reads OSON (QLocator followed by data) and returns the OSON image without
+   * decoding it.
+   */
+  readOsonImage() {
+    const numBytes = this.readUB4();
+    if (numBytes === 0) {
+      return null;
+    }
+    this.skipUB8();                     // size (unused)
+    this.skipUB4();                     // chunk size (unused)
+    const image = new types.OsonImage(this.readBytesWithLength());
+    this.skipBytesChunked();            // locator (unused)
+    return image;
+  }
+
   readURowID() {
     let outputOffset = 0, inputOffset = 1;
     let buf = this.readBytesWithLength();
@@ -471,9 +538,10 @@ class ReadPacket extends BaseBuffer {
 
   /**
    * Reads VECTOR data (QLocator followed by data) and decodes it into a
-   * JavaScript object.
+   * JavaScript object. If a slab is supplied, the typed arrays are allocated
+   * from it.
    */
-  readVector() {
+  readVector(slab) {
     const numBytes = this.readUB4();
     if (numBytes === 0) {
       return null;
@@ -482,7 +550,7 @@ class ReadPacket extends BaseBuffer {
     this.skipUB4();                     // chunk size (unused)
     const decoder = new vector.VectorDecoder(this.readBytesWithLength());
     this.skipBytesChunked();            // locator (unused)
-    return decoder.decode();
+    return decoder.decode(slab);
   }
 
   skipBytesChunked() {
@@ -665,11 +733,14 @@ class WritePacket extends BaseBuffer {
 
   /**
    * Encodes a JavaScript object into OSON and then writes it (QLocator
-   * followed by data) to the buffer.
+   * followed by data) to the buffer. An encoder may be passed in so that it
+   * can be reused when many values are being written. OSON images are written
+   * unchanged.
    */
-  writeOson(value, osonMaxFieldSize, writeLength = true) {
-    const encoder = new oson.OsonEncoder();
-    const buf = encoder.encode(value, osonMaxFieldSize);
+  writeOson(value, osonMaxFieldSize, writeLength = true,
+    encoder = new oson.OsonEncoder()) {
+    const buf = (value instanceof types.OsonImage) ? value._toBuffer() :
+      encoder.encode(value, osonMaxFieldSize);
     this.writeQLocator(buf.length, writeLength);
     this.writeBytesWithLength(buf);
   }
@@ -681,15 +752,26 @@ class WritePacket extends BaseBuffer {
 
   /**
    * Encodes a JavaScript object into VECTOR data and then writes it (QLocator
-   * followed by data) to the buffer.
+   * followed by data) to the buffer. An encoder may be passed in so that it
+   * can be reused when many values are being written.
    */
-  writeVector(value) {
-    const encoder = new vector.VectorEncoder();
+  writeVector(value, encoder = new vector.VectorEncoder()) {
     const buf = encoder.encode(value);
     this.writeQLocator(buf.length);
     this.writeBytesWithLength(buf);
   }
 
+  /**
+   * Encodes one row of a matrix of vectors (numElements elements beginning at
+   * the start index) into VECTOR data and then writes it (QLocator followed by
+   * data) to the buffer.
+   */
+  writeVectorElements(value, start, numElements, encoder) {
+    const buf = encoder.encodeElements(value, start, numElements);
+    this.writeQLocator(buf.length);
+    this.writeBytesWithLength(buf);
+  }
+
   //---------------------------------------------------------------------------
   // writeQLocator()
   //
@@ -26,7 +26,10 @@
 
 'use strict';
 
+const constants = require('../constants.js');
 const ResultSetImpl = require('../impl/resultset.js');
+const types = require('../types.js');
+const { VectorSlab } = require('../impl/datahandlers/vector.js');
 const ExecuteMessage = require('./protocol/messages/execute.js');
 const FetchMessage = require('./protocol/messages/fetch.js');
 
@@ -39,12 +42,39 @@ class ThinResultSetImpl extends ResultSetImpl {
   // OAL8 RPC if needed; otherwise, the simpler OFETCH RPC is used.
   //---------------------------------------------------------------------------
   async _fetchMoreRows(options) {
+    for (const variable of this.statement.queryVars) {
+      if (variable.vectorSlab)
+        variable.vectorSlab.reset(options.fetchArraySize);
+    }
     const cls = (this.statement.requiresFullExecute) ? ExecuteMessage : FetchMessage;
     const message = new cls(this.connection, this.statement, options, this);
     await this.connection._protocol._processMessage(message);
     this.statement.requiresFullExecute = false;
   }
 
+  //---------------------------------------------------------------------------
+  // _setup()
+  //
+  // Performs the common setup and then marks the JSON columns that are to be
+  // decoded lazily as they are read from the database. VECTOR columns fetched
+  // as a matrix are given a slab from which the vectors of each batch are
+  // allocated; the rows returned by the execute are sized by prefetchRows.
+  //---------------------------------------------------------------------------
+  _setup(options, metaData) {
+    super._setup(options, metaData);
+    const lazy = (this.jsonFetchMode === constants.JSON_FETCH_MODE_LAZY);
+    for (const variable of this.statement.queryVars) {
+      variable.decodeJsonLazily = lazy &&
+        variable.fetchInfo.fetchType === types.DB_TYPE_JSON;
+      if (this.fetchVectorsAsMatrix &&
+          variable.fetchInfo.fetchType === types.DB_TYPE_VECTOR) {
+        variable.vectorSlab = new VectorSlab(options.prefetchRows || 0);
+      } else {
+        variable.vectorSlab = null;
+      }
+    }
+  }
+
   //---------------------------------------------------------------------------
   // Set the metadata info for a new resultSet object
   //---------------------------------------------------------------------------
@@ -65,17 +95,86 @@ class ThinResultSetImpl extends ResultSetImpl {
   }
 
   //---------------------------------------------------------------------------
-  // Returns rows fetched to the common layer in array format
+  // Returns the values of a single column in the array type requested for
+  // that column; null values are recorded in the supplied bitmap
+  //---------------------------------------------------------------------------
+  _getColumnValues(values, arrayType, bufferRowIndex, numRows, nulls) {
+    let columnValues, fn;
+    switch (arrayType) {
+      case constants.COLUMN_ARRAY_TYPE_FLOAT64:
+        columnValues = new Float64Array(numRows);
+        fn = Number;
+        break;
+      case constants.COLUMN_ARRAY_TYPE_INT32:
+        columnValues = new Int32Array(numRows);
+        fn = Number;
+        break;
+      case constants.COLUMN_ARRAY_TYPE_BIGINT64:
+        columnValues = new BigInt64Array(numRows);
+        fn = BigInt;
+        break;
+      case constants.COLUMN_ARRAY_TYPE_DATE:
+        columnValues = new Float64Array(numRows);
+        fn = (v) => v.getTime();
+        break;
+      case constants.COLUMN_ARRAY_TYPE_BOOLEAN:
+        columnValues = new Uint8Array(numRows);
+        fn = (v) => (v) ? 1 : 0;
+        break;
+      default:
+        columnValues = new Array(numRows);
+        break;
+    }
+    for (let i = 0; i < numRows; i++) {
+      const value = values[bufferRowIndex + i];
+      if (value === null || value === undefined) {
+        nulls[i >> 3] |= 1 << (i & 7);
+        if (!fn) {
+          columnValues[i] = null;
+        }
+      } else {
+        columnValues[i] = (fn) ? fn(value) : value;
+      }
+    }
+    return columnValues;
+  }
+
+  //---------------------------------------------------------------------------
+  // Returns rows fetched to the common layer in array format or, if the
+  // output format requires it, in object or column format
   //---------------------------------------------------------------------------
   _processRows(numRowsFetched) {
-    const rows = [];
+    let rows;
     const bufferRowIndex = this.statement.bufferRowIndex;
-    for (let row = bufferRowIndex; row < bufferRowIndex + numRowsFetched; row++) {
-      const rowObj = [];
+    if (this.outFormat === constants.OUT_FORMAT_COLUMNS) {
+      const columns = [];
       for (let col = 0; col < this.statement.numQueryVars; col++) {
-        rowObj.push(this.statement.queryVars[col].values[row]);
+        const nulls = new Uint8Array((numRowsFetched + 7) >> 3);
+        const values = this._getColumnValues(
+          this.statement.queryVars[col].values, this.columnArrayTypes[col],
+          bufferRowIndex, numRowsFetched, nulls);
+        columns.push({ values, nulls });
+      }
+      rows = { numRows: numRowsFetched, columns };
+    } else if (this.outFormat === constants.OUT_FORMAT_OBJECT) {
+      rows = [];
+      const names = this.metaData.map(info => info.name);
+      for (let row = bufferRowIndex; row < bufferRowIndex + numRowsFetched; row++) {
+        const rowObj = {};
+        for (let col = 0; col < this.statement.numQueryVars; col++) {
+          rowObj[names[col]] = this.statement.queryVars[col].values[row];
+        }
+        rows.push(rowObj);
+      }
+    } else {
+      rows = [];
+      for (let row = bufferRowIndex; row < bufferRowIndex + numRowsFetched; row++) {
+        const rowObj = [];
+        for (let col = 0; col < this.statement.numQueryVars; col++) {
+          rowObj.push(this.statement.queryVars[col].values[row]);
+        }
+        rows.push(rowObj);
       }
-      rows.push(rowObj);
     }
     this.statement.bufferRowIndex += numRowsFetched;
     if (this.statement.bufferRowIndex === this.statement.bufferRowCount) {
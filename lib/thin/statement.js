@@ -362,6 +362,7 @@ class Statement {
     this.bufferRowIndex = 0;
     this.bufferRowCount = 0;
     this.pendingClear = false;
+    this.pinned = false;
     this.statementType = constants.STMT_TYPE_UNKNOWN;
   }
 
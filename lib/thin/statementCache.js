@@ -79,7 +79,7 @@ class StatementCache {
   clearCursors() {
     const newOpenCursors = new Set();
     for (const stmt of this._openCursors) {
-      if (stmt.inUse || stmt.returnToCache) {
+      if (stmt.inUse || stmt.returnToCache || stmt.pinned) {
         stmt.pendingClear = true;
         newOpenCursors.add(stmt);
       }
@@ -144,6 +144,49 @@ class StatementCache {
     return stmt;
   }
 
+  //---------------------------------------------------------------------------
+  // getPinnedStatement()
+  // Get a pinned statement for execution. If the statement is already in use
+  // or a copy is required (for DRCP), a copy is made which is closed when it
+  // is returned.
+  //---------------------------------------------------------------------------
+  getPinnedStatement(statement, forceNew = false) {
+    if (forceNew || statement.inUse) {
+      statement = statement._copy();
+      this._openCursors.add(statement);
+    }
+    statement.inUse = true;
+    return statement;
+  }
+
+  //---------------------------------------------------------------------------
+  // pinStatement()
+  // Prepare a statement that is retained by a prepared statement object until
+  // it is unpinned. Pinned statements are not stored in the LRU cache, so
+  // they are never evicted and do not count towards the cache size.
+  //---------------------------------------------------------------------------
+  pinStatement(sql) {
+    const stmt = new Statement();
+    stmt._prepare(sql);
+    stmt.pinned = true;
+    this._openCursors.add(stmt);
+    return stmt;
+  }
+
+  //---------------------------------------------------------------------------
+  // unpinStatement()
+  // Release a statement previously pinned. The cursor is closed on the next
+  // round trip to the database.
+  //---------------------------------------------------------------------------
+  unpinStatement(statement) {
+    statement.pinned = false;
+    if (statement.inUse) {
+      statement.returnToCache = false;
+    } else {
+      this._addCursorToClose(statement);
+    }
+  }
+
   clearCursor(statement) {
     this._addCursorToClose(statement);
     statement.cursorId = 0;
@@ -168,7 +211,7 @@ class StatementCache {
         queryVar.values.fill(null);
       });
     }
-    if (statement.returnToCache) {
+    if (statement.returnToCache || statement.pinned) {
       statement.inUse = false;
     } else {
       this._addCursorToClose(statement);
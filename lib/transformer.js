@@ -32,6 +32,8 @@ const Lob = require('./lob.js');
 const ResultSet = require('./resultset.js');
 const constants = require('./constants.js');
 const errors = require('./errors.js');
+const oson = require('./impl/datahandlers/oson.js');
+const settings = require('./settings.js');
 const util = require('util');
 const types = require('./types.js');
 const nodbUtil = require('./util.js');
@@ -124,6 +126,20 @@ function transformJsonValue(value) {
 
 }
 
+//-----------------------------------------------------------------------------
+// transformOsonImage()
+//
+// Returns the value to bind for an OSON image. In Thin mode the image is sent
+// to the database unchanged. In Thick mode the Oracle Client libraries expect
+// a JSON value so the image is decoded first.
+//-----------------------------------------------------------------------------
+function transformOsonImage(value) {
+  if (settings.thin)
+    return value;
+  const decoder = new oson.OsonDecoder(value._toBuffer());
+  return transformJsonValue(decoder.decode());
+}
+
 //-----------------------------------------------------------------------------
 // transformValueIn()
 //
@@ -148,6 +164,8 @@ function transformValueIn(info, value, options) {
 
   // handle setting plain JS values to JSON
   } else if (info.type === types.DB_TYPE_JSON) {
+    if (value instanceof types.OsonImage)
+      return transformOsonImage(value);
     return transformJsonValue(value);
 
   // handle strings
@@ -228,6 +246,11 @@ function transformValueIn(info, value, options) {
     }
     return value;
 
+  // handle OSON images
+  } else if (value instanceof types.OsonImage) {
+    checkType(info, options, types.DB_TYPE_JSON);
+    return transformOsonImage(value);
+
   // handle result sets
   } else if (value instanceof ResultSet) {
     checkType(info, options, types.DB_TYPE_CURSOR);
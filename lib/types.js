@@ -241,6 +241,7 @@ const DB_TYPE_CONVERSION_MAP = new Map([
     [DB_TYPE_TIMESTAMP_LTZ, DB_TYPE_TIMESTAMP_LTZ]
   ])],
   [DB_TYPE_JSON, new Map([
+    [DB_TYPE_RAW, DB_TYPE_RAW],
     [DB_TYPE_VARCHAR, DB_TYPE_VARCHAR]
   ])],
   [DB_TYPE_LONG, new Map([
@@ -344,6 +345,18 @@ class JsonId extends Uint8Array {
   }
 }
 
+// Contains an OSON image (the binary format of the JSON data type). These are
+// returned when JSON columns are fetched as buffers and are sent to the
+// database unchanged when bound as JSON.
+class OsonImage extends Uint8Array {
+
+  // returns a Buffer sharing the same memory as the image
+  _toBuffer() {
+    return Buffer.from(this.buffer, this.byteOffset, this.byteLength);
+  }
+
+}
+
 // Represents the SparseVector.
 // indices must be an regular Array
 // values can be regular or typedArray.
@@ -600,6 +613,7 @@ module.exports = {
   getTypeByNum,
   getTypeByOraTypeNum,
   JsonId,
+  OsonImage,
   SparseVector,
   IntervalYM,
   IntervalDS
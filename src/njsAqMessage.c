@@ -173,7 +173,7 @@ NJS_NAPI_METHOD_IMPL_SYNC(njsAqMessage_getEnqTime, 0, NULL)
     NJS_CHECK_NAPI(env, napi_get_reference_value(env,
             globals->jsMakeDateFn, &makeDateFn))
     return njsUtils_getDateValue(DPI_ORACLE_TYPE_TIMESTAMP, env,
-            makeDateFn, &timestamp, returnValue);
+            &globals->dateCache, makeDateFn, &timestamp, returnValue);
 }
 
 
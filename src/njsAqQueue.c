@@ -142,8 +142,11 @@ static bool njsAqQueue_createMessage(njsBaton *baton, njsAqQueue *queue,
         status = dpiMsgProps_setPayloadObject(tempHandle, obj->handle);
     } else if (queue->isJson) {
         // JSON
-        if (!njsJsonBuffer_fromValue(&jsonBuffer, env, payloadObj, &baton->jsContext))
+        if (!njsJsonBuffer_fromValue(&jsonBuffer, env, payloadObj,
+                &baton->jsContext, &baton->jsonArena)) {
+            njsJsonBuffer_free(&jsonBuffer);
             return false;
+        }
         if (dpiConn_newJson(queue->conn->handle, &json) < 0) {
             njsJsonBuffer_free(&jsonBuffer);
             return njsBaton_setErrorDPI(baton);
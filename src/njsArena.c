@@ -0,0 +1,115 @@
+// Copyright (c) 2026, Oracle and/or its affiliates.
+
+//-----------------------------------------------------------------------------
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// NAME
+//   njsArena.c
+//
+// DESCRIPTION
+//   Implementation of an arena used for short lived allocations. Memory is
+// handed out by advancing an offset within a block and is released all at
+// once, which avoids the cost of many small allocations and frees.
+//
+//-----------------------------------------------------------------------------
+
+#include "njsModule.h"
+
+// all allocations are aligned to this boundary
+#define NJS_ARENA_ALIGNMENT             8
+
+
+//-----------------------------------------------------------------------------
+// njsArena_alloc()
+//   Allocates memory of the requested size from the arena. The memory is
+// zeroed and is valid until the arena is reset or freed. If the current block
+// has insufficient space the next block is used (if it was retained by a
+// previous reset and is large enough) or a new block is allocated. NULL is
+// returned if memory cannot be allocated.
+//-----------------------------------------------------------------------------
+void *njsArena_alloc(njsArena *arena, size_t size)
+{
+    njsArenaBlock *block, *nextBlock;
+    size_t blockSize;
+    char *ptr;
+
+    size = (size + NJS_ARENA_ALIGNMENT - 1) & ~(NJS_ARENA_ALIGNMENT - 1);
+    block = arena->currentBlock;
+    if (!block || block->size - block->used < size) {
+        nextBlock = (block) ? block->next : arena->firstBlock;
+        if (nextBlock && nextBlock->used == 0 && nextBlock->size >= size) {
+            block = nextBlock;
+        } else {
+            blockSize = NJS_MAX_NUM(size, NJS_ARENA_BLOCK_SIZE);
+            nextBlock = malloc(sizeof(njsArenaBlock) + blockSize);
+            if (!nextBlock)
+                return NULL;
+            nextBlock->size = blockSize;
+            nextBlock->used = 0;
+            if (block) {
+                nextBlock->next = block->next;
+                block->next = nextBlock;
+            } else {
+                nextBlock->next = arena->firstBlock;
+                arena->firstBlock = nextBlock;
+            }
+            block = nextBlock;
+        }
+        arena->currentBlock = block;
+    }
+    ptr = ((char*) (block + 1)) + block->used;
+    block->used += size;
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsArena_free()
+//   Frees all of the blocks allocated by the arena.
+//-----------------------------------------------------------------------------
+void njsArena_free(njsArena *arena)
+{
+    njsArenaBlock *block;
+
+    while (arena->firstBlock) {
+        block = arena->firstBlock;
+        arena->firstBlock = block->next;
+        free(block);
+    }
+    arena->currentBlock = NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsArena_reset()
+//   Makes all of the memory allocated by the arena available for reuse. The
+// blocks themselves are retained until the arena is freed.
+//-----------------------------------------------------------------------------
+void njsArena_reset(njsArena *arena)
+{
+    njsArenaBlock *block;
+
+    for (block = arena->firstBlock; block; block = block->next)
+        block->used = 0;
+    arena->currentBlock = arena->firstBlock;
+}
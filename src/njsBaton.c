@@ -37,6 +37,10 @@ static bool njsBaton_completeAsyncHelper(njsBaton *baton, napi_env env,
         napi_value *resolution);
 static void njsBaton_freeShardingKeys(uint8_t *numShardingKeyColumns,
         dpiShardingKeyColumn **shardingKeyColumns);
+static bool njsBaton_getVectorArray(napi_env env, napi_typedarray_type type,
+        size_t elementLength, size_t numElem, const void *elements,
+        napi_value matrixBuffer, char *matrixPtr, size_t *matrixOffset,
+        napi_value *value);
 
 //-----------------------------------------------------------------------------
 // njsBaton_commonConnectProcessArgs()
@@ -88,7 +92,7 @@ bool njsBaton_commonConnectProcessArgs(njsBaton *baton, napi_env env,
 // calls should be avoided. The baton is destroyed after the assigned routine
 // is called.
 //-----------------------------------------------------------------------------
-static void njsBaton_completeAsync(napi_env env, napi_status ignoreStatus,
+void njsBaton_completeAsync(napi_env env, napi_status ignoreStatus,
         void *data)
 {
     njsBaton *baton = (njsBaton*) data;
@@ -217,10 +221,13 @@ void njsBaton_free(njsBaton *baton, napi_env env)
     NJS_FREE_AND_CLEAR(baton->bindNames);
     NJS_FREE_AND_CLEAR(baton->bindNameLengths);
     NJS_FREE_AND_CLEAR(baton->sodaOperOptions);
+    njsArena_free(&baton->jsonArena);
     if (baton->lob) {
-        if (baton->lob->handle) {
-            dpiLob_release(baton->lob->handle);
-            baton->lob->handle = NULL;
+        for (i = 0; i < baton->numLobs; i++) {
+            if (baton->lob[i].handle) {
+                dpiLob_release(baton->lob[i].handle);
+                baton->lob[i].handle = NULL;
+            }
         }
         free(baton->lob);
         baton->lob = NULL;
@@ -307,6 +314,14 @@ void njsBaton_free(njsBaton *baton, napi_env env)
     }
     NJS_FREE_AND_CLEAR(baton->keysLengths);
 
+    // bind variables used to execute a prepared statement successfully are
+    // retained by the prepared statement so they can be reused
+    if (baton->preparedStmt) {
+        if (!baton->hasError)
+            njsPreparedStatement_retainBindVars(baton->preparedStmt, baton);
+        baton->preparedStmt = NULL;
+    }
+
     // free variables
     if (baton->queryVars) {
         for (i = 0; i < baton->numQueryVars; i++)
@@ -324,6 +339,18 @@ void njsBaton_free(njsBaton *baton, napi_env env)
     // free batch errors
     NJS_FREE_AND_CLEAR(baton->batchErrorInfos);
 
+    // free pipeline operations
+    if (baton->pipelineOps) {
+        for (i = 0; i < baton->numPipelineOps; i++) {
+            if (baton->pipelineOps[i].baton) {
+                njsBaton_free(baton->pipelineOps[i].baton, env);
+                baton->pipelineOps[i].baton = NULL;
+            }
+        }
+        free(baton->pipelineOps);
+        baton->pipelineOps = NULL;
+    }
+
     // free implicit results
     while (baton->implicitResults) {
         currImplicitResult = baton->implicitResults;
@@ -346,6 +373,7 @@ void njsBaton_free(njsBaton *baton, napi_env env)
     NJS_DELETE_REF_AND_CLEAR(baton->jsCallingObjRef);
     NJS_DELETE_REF_AND_CLEAR(baton->jsSubscriptionRef);
     NJS_DELETE_REF_AND_CLEAR(baton->jsExecuteOptionsRef);
+    NJS_DELETE_REF_AND_CLEAR(baton->jsPreparedStatementRef);
     if (baton->accessTokenCallback) {
         njsTokenCallback_free(env, baton->accessTokenCallback);
         baton->accessTokenCallback = NULL;
@@ -406,8 +434,7 @@ void njsBaton_freeShardingKeys(uint8_t *numShardingKeyColumns,
 // false is returned, the callback should not be invoked; instead an exception
 // will be passed on to JavaScript.
 //-----------------------------------------------------------------------------
-static bool njsBaton_getErrorInfo(njsBaton *baton, napi_env env,
-        napi_value *error)
+bool njsBaton_getErrorInfo(njsBaton *baton, napi_env env, napi_value *error)
 {
     napi_value tempString, tempError;
     dpiErrorInfo *errorInfo;
@@ -515,7 +542,8 @@ bool njsBaton_initCommonCreateParams(njsBaton *baton,
 // njsBaton_queueWork()
 //   Queue work on a separate thread. The baton is passed as context. If this
 // method fails for some reason, the baton is destroyed and is no longer
-// usable.
+// usable. The native worker pool is used instead of the libuv thread pool
+// when one has been created.
 //-----------------------------------------------------------------------------
 bool njsBaton_queueWork(njsBaton *baton, napi_env env,
         const char *methodName, bool (*workCallback)(njsBaton*),
@@ -528,6 +556,14 @@ bool njsBaton_queueWork(njsBaton *baton, napi_env env,
     baton->workCallback = workCallback;
     baton->afterWorkCallback = afterWorkCallback;
 
+    // use the native worker pool, if applicable
+    if (baton->globals->workerPool) {
+        NJS_CHECK_NAPI(env, napi_create_promise(env, &baton->deferred,
+                promise))
+        return njsWorkerPool_queueWork(baton->globals->workerPool, env,
+                baton);
+    }
+
     // set up asynchronous work handle and return promise to JavaScript
     NJS_CHECK_NAPI(env, napi_create_string_utf8(env, methodName,
             NAPI_AUTO_LENGTH, &asyncResourceName))
@@ -628,24 +664,83 @@ bool njsBaton_setJsContext(njsBaton *baton, napi_env env)
     return njsJsContext_populate(env, baton-> globals, &baton->jsContext);
 }
 
+//-----------------------------------------------------------------------------
+// njsBaton_getVectorArray()
+//   Return a typed array containing a copy of the given elements. If a matrix
+// buffer is supplied, the typed array is a view of that buffer at the next
+// offset aligned to the element size; otherwise, a new array buffer is
+// created for it.
+//-----------------------------------------------------------------------------
+static bool njsBaton_getVectorArray(napi_env env, napi_typedarray_type type,
+        size_t elementLength, size_t numElem, const void *elements,
+        napi_value matrixBuffer, char *matrixPtr, size_t *matrixOffset,
+        napi_value *value)
+{
+    size_t byteLength = elementLength * numElem, offset = 0;
+    void *destData = NULL;
+    napi_value arrBuf;
+
+    if (matrixBuffer) {
+        offset = (*matrixOffset + elementLength - 1) / elementLength *
+                elementLength;
+        *matrixOffset = offset + byteLength;
+        destData = matrixPtr + offset;
+        arrBuf = matrixBuffer;
+    } else {
+        NJS_CHECK_NAPI(env, napi_create_arraybuffer(env, byteLength,
+                &destData, &arrBuf))
+    }
+    if (byteLength > 0) {
+        memcpy(destData, elements, byteLength);
+    }
+    NJS_CHECK_NAPI(env, napi_create_typedarray(env, type, numElem, arrBuf,
+            offset, value))
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsBaton_getVectorElementLength()
+//   Return the size of each element of a vector with the given format and
+// the typed array type used for the elements, or 0 if the format is not
+// supported.
+//-----------------------------------------------------------------------------
+size_t njsBaton_getVectorElementLength(uint8_t format,
+        napi_typedarray_type *type)
+{
+    switch (format) {
+        case DPI_VECTOR_FORMAT_FLOAT64:
+            *type = napi_float64_array;
+            return 8;
+        case DPI_VECTOR_FORMAT_FLOAT32:
+            *type = napi_float32_array;
+            return 4;
+        case DPI_VECTOR_FORMAT_INT8:
+            *type = napi_int8_array;
+            return 1;
+        case DPI_VECTOR_FORMAT_BINARY:
+            *type = napi_uint8_array;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+
 //-----------------------------------------------------------------------------
 // njsBaton_getVectorValue()
-//   Return an appropriate JavaScript value for the Vector type.
+//   Return an appropriate JavaScript value for the Vector type. If a matrix
+// is supplied, the typed arrays are views of its shared array buffers.
 //-----------------------------------------------------------------------------
 bool njsBaton_getVectorValue(njsBaton *baton, dpiVector *vector,
-        napi_env env, napi_value *value)
+        njsVectorMatrix *matrix, napi_env env, napi_value *value)
 {
-    dpiVectorInfo vectorInfo;
-    size_t elementLength = 0;
-    size_t byteLength = 0;
-    const size_t bufferOffset = 0;
-    void *destData = NULL;
-    void *destDataIndices = NULL;
     napi_typedarray_type type = napi_int8_array;
-    size_t numElem = 0;
-    napi_value arrBuf, arrBufIndices;
     napi_value valueArray, indexArray, numDims;
     napi_value retSparseObject;
+    dpiVectorInfo vectorInfo;
+    size_t elementLength;
+    size_t numElem = 0;
 
     if (dpiVector_getValue(vector, &vectorInfo) < 0) {
         return njsBaton_setErrorDPI(baton);
@@ -657,48 +752,31 @@ bool njsBaton_getVectorValue(njsBaton *baton, dpiVector *vector,
         numElem = vectorInfo.numDimensions;
     }
 
-    switch(vectorInfo.format) {
-        case DPI_VECTOR_FORMAT_FLOAT64:
-            type = napi_float64_array;
-            elementLength = 8;
-            break;
-        case DPI_VECTOR_FORMAT_FLOAT32:
-            type = napi_float32_array;
-            elementLength = 4;
-            break;
-        case DPI_VECTOR_FORMAT_INT8:
-            type = napi_int8_array;
-            elementLength = 1;
-            break;
-        case DPI_VECTOR_FORMAT_BINARY:
-            type = napi_uint8_array;
-            elementLength = 1;
-            // dimensions for binary is assumed to be multiples of 8.
-            numElem = numElem / 8;
-            break;
-        default:
-            return njsBaton_setErrorUnsupportedVectorFormat
-                            (baton, vectorInfo.format);
-    }
+    elementLength = njsBaton_getVectorElementLength(vectorInfo.format, &type);
+    if (elementLength == 0)
+        return njsBaton_setErrorUnsupportedVectorFormat(baton,
+                vectorInfo.format);
+
+    // dimensions for binary is assumed to be multiples of 8.
+    if (vectorInfo.format == DPI_VECTOR_FORMAT_BINARY)
+        numElem = numElem / 8;
+
     if (vectorInfo.isSparse) {
         // Create values property.
-        byteLength = elementLength * numElem;
-        NJS_CHECK_NAPI(env, napi_create_arraybuffer(env, byteLength,
-                &destData, &arrBuf))
-        if (byteLength > 0) {
-            memcpy(destData, vectorInfo.dimensions.asPtr, byteLength);
-        }
-        NJS_CHECK_NAPI(env, napi_create_typedarray(env, type,
-                numElem, arrBuf, bufferOffset, &valueArray))
+        if (!njsBaton_getVectorArray(env, type, elementLength, numElem,
+                vectorInfo.dimensions.asPtr,
+                (matrix) ? matrix->values : NULL,
+                (matrix) ? matrix->valuesPtr : NULL,
+                (matrix) ? &matrix->valuesOffset : NULL, &valueArray))
+            return false;
 
         //Create indices property.
-        NJS_CHECK_NAPI(env, napi_create_arraybuffer(env, 4 * numElem,
-                &destDataIndices, &arrBufIndices))
-        if (numElem > 0) {
-            memcpy(destDataIndices, vectorInfo.sparseIndices, 4 * numElem);
-        }
-        NJS_CHECK_NAPI(env, napi_create_typedarray(env, napi_uint32_array,
-                numElem, arrBufIndices, bufferOffset, &indexArray))
+        if (!njsBaton_getVectorArray(env, napi_uint32_array, 4, numElem,
+                vectorInfo.sparseIndices,
+                (matrix) ? matrix->indices : NULL,
+                (matrix) ? matrix->indicesPtr : NULL,
+                (matrix) ? &matrix->indicesOffset : NULL, &indexArray))
+            return false;
 
         // Create an object with values, indices and numDimensions properties
         NJS_CHECK_NAPI(env, napi_create_object(env, &retSparseObject))
@@ -710,14 +788,12 @@ bool njsBaton_getVectorValue(njsBaton *baton, dpiVector *vector,
                 baton->jsContext.jsSparseVectorConstructor, 1,
                 &retSparseObject, value))
     } else {
-        byteLength = elementLength * numElem;
-        NJS_CHECK_NAPI(env, napi_create_arraybuffer(env, byteLength,
-                &destData, &arrBuf))
-        if (byteLength > 0) {
-            memcpy(destData, vectorInfo.dimensions.asPtr, byteLength);
-        }
-        NJS_CHECK_NAPI(env, napi_create_typedarray(env, type, numElem, arrBuf,
-                bufferOffset, value))
+        if (!njsBaton_getVectorArray(env, type, elementLength, numElem,
+                vectorInfo.dimensions.asPtr,
+                (matrix) ? matrix->values : NULL,
+                (matrix) ? matrix->valuesPtr : NULL,
+                (matrix) ? &matrix->valuesOffset : NULL, value))
+            return false;
     }
     return true;
 }
@@ -39,7 +39,9 @@ NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_close);
 NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_commit);
 NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_connect);
 NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_createLob);
+NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_createLobs);
 NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_execute);
+NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_executePrepared);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_getCallTimeout);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_getCurrentSchema);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_getDbName);
@@ -64,7 +66,9 @@ NJS_NAPI_METHOD_DECL_SYNC(njsConnection_getTransactionInProgress);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_getWarning);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_isHealthy);
 NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_ping);
+NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_prepare);
 NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_rollback);
+NJS_NAPI_METHOD_DECL_ASYNC(njsConnection_runPipeline);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_setAction);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_setCallTimeout);
 NJS_NAPI_METHOD_DECL_SYNC(njsConnection_setClientId);
@@ -98,13 +102,16 @@ static NJS_ASYNC_METHOD(njsConnection_closeAsync);
 static NJS_ASYNC_METHOD(njsConnection_commitAsync);
 static NJS_ASYNC_METHOD(njsConnection_connectAsync);
 static NJS_ASYNC_METHOD(njsConnection_createLobAsync);
+static NJS_ASYNC_METHOD(njsConnection_createLobsAsync);
 static NJS_ASYNC_METHOD(njsConnection_executeAsync);
 static NJS_ASYNC_METHOD(njsConnection_executeManyAsync);
 static NJS_ASYNC_METHOD(njsConnection_getDbObjectClassAsync);
 static NJS_ASYNC_METHOD(njsConnection_getQueueAsync);
 static NJS_ASYNC_METHOD(njsConnection_getStatementInfoAsync);
 static NJS_ASYNC_METHOD(njsConnection_pingAsync);
+static NJS_ASYNC_METHOD(njsConnection_prepareAsync);
 static NJS_ASYNC_METHOD(njsConnection_rollbackAsync);
+static NJS_ASYNC_METHOD(njsConnection_runPipelineAsync);
 static NJS_ASYNC_METHOD(njsConnection_shutdownAsync);
 static NJS_ASYNC_METHOD(njsConnection_startSessionlessTransactionAsync);
 static NJS_ASYNC_METHOD(njsConnection_startupAsync);
@@ -121,11 +128,14 @@ static NJS_ASYNC_METHOD(njsConnection_unsubscribeAsync);
 // post asynchronous methods
 static NJS_ASYNC_POST_METHOD(njsConnection_connectPostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_createLobPostAsync);
+static NJS_ASYNC_POST_METHOD(njsConnection_createLobsPostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_executePostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_executeManyPostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_getDbObjectClassPostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_getQueuePostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_getStatementInfoPostAsync);
+static NJS_ASYNC_POST_METHOD(njsConnection_preparePostAsync);
+static NJS_ASYNC_POST_METHOD(njsConnection_runPipelinePostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_tpcPreparePostAsync);
 static NJS_ASYNC_POST_METHOD(njsConnection_subscribePostAsync);
 
@@ -150,8 +160,12 @@ static const napi_property_descriptor njsClassProperties[] = {
             NULL },
     { "createLob", NULL, njsConnection_createLob, NULL, NULL, NULL,
             napi_default, NULL },
+    { "createLobs", NULL, njsConnection_createLobs, NULL, NULL, NULL,
+            napi_default, NULL },
     { "execute", NULL, njsConnection_execute, NULL, NULL, NULL,
             napi_default, NULL },
+    { "executePrepared", NULL, njsConnection_executePrepared, NULL, NULL,
+            NULL, napi_default, NULL },
     { "getCallTimeout", NULL, njsConnection_getCallTimeout, NULL, NULL, NULL,
             napi_default, NULL },
     { "getCurrentSchema", NULL, njsConnection_getCurrentSchema, NULL, NULL,
@@ -201,8 +215,12 @@ static const napi_property_descriptor njsClassProperties[] = {
             napi_default, NULL },
     { "ping", NULL, njsConnection_ping, NULL, NULL, NULL, napi_default,
             NULL },
+    { "prepare", NULL, njsConnection_prepare, NULL, NULL, NULL,
+            napi_default, NULL },
     { "rollback", NULL, njsConnection_rollback, NULL, NULL, NULL,
             napi_default, NULL },
+    { "runPipeline", NULL, njsConnection_runPipeline, NULL, NULL, NULL,
+            napi_default, NULL },
     { "setAction", NULL, njsConnection_setAction, NULL, NULL, NULL,
             napi_default, NULL },
     { "setCallTimeout", NULL, njsConnection_setCallTimeout, NULL, NULL, NULL,
@@ -261,6 +279,10 @@ const njsClassDef njsClassDefConnection = {
 };
 
 // other methods used internally
+static void njsConnection_copyErrorMessage(dpiErrorInfo *errorInfo,
+        char *buffer);
+static bool njsConnection_createPipelineOp(njsBaton *baton, napi_env env,
+        napi_value value, njsPipelineOp *op);
 static bool njsConnection_getBatchErrors(njsBaton *baton, napi_env env,
         napi_value *batchErrors);
 static bool njsConnection_getExecuteManyOutBinds(njsBaton *baton, napi_env env,
@@ -276,10 +298,15 @@ static bool njsConnection_getRowCounts(njsBaton *baton, napi_env env,
 static bool njsConnection_prepareAndBind(njsConnection *conn, njsBaton *baton);
 static bool njsConnection_processBinds(njsBaton *baton, napi_env env,
         napi_value binds);
+static bool njsConnection_processExecuteOptions(njsBaton *baton, napi_env env,
+        napi_value options, bool executeMany);
 static bool njsConnection_processImplicitResults(njsBaton *baton);
+static bool njsConnection_reuseBindVar(njsBaton *baton, njsVariable *var);
 static bool njsConnection_setTextAttribute(napi_env env, void *instance,
         njsModuleGlobals *globals, napi_value value,
         int (*setter)(dpiConn*, const char *, uint32_t));
+static bool njsConnection_transferPipelineOpError(njsBaton *baton,
+        njsBaton *opBaton);
 
 //-----------------------------------------------------------------------------
 // njsConnection_breakExecution()
@@ -567,6 +594,30 @@ static bool njsConnection_connectPostAsync(njsBaton *baton, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsConnection_copyErrorMessage()
+//   Copies the message of an error or warning acquired from ODPI-C into the
+// supplied buffer and points the error information at it. ODPI-C retains the
+// message in a buffer that is reused by the next error on the same thread, so
+// this is needed when more than one statement is executed by a single worker
+// function. Messages that are too long are truncated.
+//-----------------------------------------------------------------------------
+static void njsConnection_copyErrorMessage(dpiErrorInfo *errorInfo,
+        char *buffer)
+{
+    uint32_t length = errorInfo->messageLength;
+
+    if (errorInfo->message == buffer)
+        return;
+    if (length > NJS_MAX_ERROR_MSG_LEN)
+        length = NJS_MAX_ERROR_MSG_LEN;
+    memcpy(buffer, errorInfo->message, length);
+    buffer[length] = '\0';
+    errorInfo->message = buffer;
+    errorInfo->messageLength = length;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_createLob()
 //   Create a new temporary LOB and return it for use by the application.
@@ -597,6 +648,7 @@ static bool njsConnection_createLobAsync(njsBaton *baton)
     baton->lob = calloc(1, sizeof(njsLobBuffer));
     if (!baton->lob)
         return njsBaton_setErrorInsufficientMemory(baton);
+    baton->numLobs = 1;
     if (dpiConn_newTempLob(conn->handle, baton->lobType,
                 &baton->lob->handle) < 0)
         return njsBaton_setErrorDPI(baton);
@@ -623,6 +675,157 @@ static bool njsConnection_createLobPostAsync(njsBaton *baton, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsConnection_createLobs()
+//   Create a number of new temporary LOBs of the same type and return them
+// for use by the application.
+//
+// PARAMETERS
+//   - LOB type
+//   - number of LOBs to create
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsConnection_createLobs, 2, NULL)
+{
+    napi_value lobType;
+
+    NJS_CHECK_NAPI(env, napi_get_named_property(env, args[0], "num", &lobType))
+    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, lobType, &baton->lobType))
+    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[1], &baton->numLobs))
+    return njsBaton_queueWork(baton, env, "CreateLobs",
+            njsConnection_createLobsAsync, njsConnection_createLobsPostAsync,
+            returnValue);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsConnection_createLobsAsync()
+//   Worker function for njsConnection_createLobs(). All of the LOBs are
+// created in a single trip to the worker thread. Newly created temporary LOBs
+// are empty and share the same chunk size so only the chunk size of the first
+// LOB is requested from the database.
+//-----------------------------------------------------------------------------
+static bool njsConnection_createLobsAsync(njsBaton *baton)
+{
+    njsConnection *conn = (njsConnection*) baton->callingInstance;
+    njsLobBuffer *lob;
+    uint32_t i;
+
+    baton->lob = calloc(baton->numLobs, sizeof(njsLobBuffer));
+    if (!baton->lob && baton->numLobs > 0)
+        return njsBaton_setErrorInsufficientMemory(baton);
+    for (i = 0; i < baton->numLobs; i++) {
+        lob = &baton->lob[i];
+        if (dpiConn_newTempLob(conn->handle, baton->lobType,
+                    &lob->handle) < 0)
+            return njsBaton_setErrorDPI(baton);
+        lob->dataType = baton->lobType;
+        if (i == 0) {
+            if (dpiLob_getChunkSize(lob->handle, &lob->chunkSize) < 0)
+                return njsBaton_setErrorDPI(baton);
+        } else {
+            lob->chunkSize = baton->lob[0].chunkSize;
+        }
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsConnection_createLobsPostAsync()
+//   Defines the value returned to JS.
+//-----------------------------------------------------------------------------
+static bool njsConnection_createLobsPostAsync(njsBaton *baton, napi_env env,
+        napi_value *result)
+{
+    napi_value connObj, lobObj;
+    uint32_t i;
+
+    NJS_CHECK_NAPI(env, napi_get_reference_value(env, baton->jsCallingObjRef,
+            &connObj))
+    NJS_CHECK_NAPI(env, napi_create_array_with_length(env, baton->numLobs,
+            result))
+    for (i = 0; i < baton->numLobs; i++) {
+        if (!njsLob_new(baton->globals, &baton->lob[i], env, connObj,
+                &lobObj))
+            return false;
+        NJS_CHECK_NAPI(env, napi_set_element(env, *result, i, lobObj))
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsConnection_createPipelineOp()
+//   Creates the baton for an operation of a pipeline and processes its
+// arguments in the same way as is done by njsConnection_execute() and
+// njsConnection_commit(). A null value indicates that the operation is to be
+// skipped. Any error that occurs is transferred to the pipeline baton.
+//-----------------------------------------------------------------------------
+static bool njsConnection_createPipelineOp(njsBaton *baton, napi_env env,
+        napi_value value, njsPipelineOp *op)
+{
+    bool commit = false, executeMany = false, ok;
+    napi_value binds, options;
+    napi_valuetype valueType;
+    njsBaton *opBaton;
+
+    // null values are skipped
+    op->opType = NJS_PIPELINE_OP_SKIP;
+    NJS_CHECK_NAPI(env, napi_typeof(env, value, &valueType))
+    if (valueType != napi_object)
+        return true;
+
+    // create baton for the operation which shares the calling instance of
+    // the pipeline baton
+    opBaton = calloc(1, sizeof(njsBaton));
+    if (!opBaton)
+        return njsUtils_throwInsufficientMemory(env);
+    op->baton = opBaton;
+    opBaton->globals = baton->globals;
+    opBaton->callingInstance = baton->callingInstance;
+    NJS_CHECK_NAPI(env, napi_create_reference(env, baton->jsCallingObj, 1,
+            &opBaton->jsCallingObjRef))
+
+    // commit operations have no further arguments
+    if (!njsUtils_getNamedPropertyBool(env, value, "commit", &commit))
+        return false;
+    if (commit) {
+        op->opType = NJS_PIPELINE_OP_COMMIT;
+        return true;
+    }
+
+    // process arguments for execute operations
+    ok = njsBaton_setJsContext(opBaton, env);
+    if (ok)
+        ok = njsUtils_getNamedPropertyString(env, value, "sql",
+                &opBaton->sql, &opBaton->sqlLength);
+    if (ok)
+        ok = njsUtils_getNamedPropertyUnsignedInt(env, value, "numIters",
+                &opBaton->bindArraySize);
+    if (ok)
+        ok = njsUtils_getNamedPropertyBool(env, value, "executeManyFlag",
+                &executeMany);
+    if (ok) {
+        op->opType = (executeMany) ? NJS_PIPELINE_OP_EXECUTE_MANY :
+                NJS_PIPELINE_OP_EXECUTE;
+        ok = njsUtils_getNamedProperty(env, value, "options", &options);
+    }
+    if (ok)
+        ok = njsConnection_processExecuteOptions(opBaton, env, options,
+                executeMany);
+    if (ok)
+        ok = njsUtils_getNamedProperty(env, value, "binds", &binds);
+    if (ok)
+        ok = njsConnection_processBinds(opBaton, env, binds);
+    if (!ok && opBaton->hasError)
+        return njsConnection_transferPipelineOpError(baton, opBaton);
+
+    return ok;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_execute()
 //   Executes a statement on the connection.
@@ -637,7 +840,6 @@ static bool njsConnection_createLobPostAsync(njsBaton *baton, napi_env env,
 NJS_NAPI_METHOD_IMPL_ASYNC(njsConnection_execute, 5, NULL)
 {
     bool executeMany;
-    napi_value temp;
 
     // validate connection and process arguments
     if (!njsBaton_setJsContext(baton, env))
@@ -650,36 +852,9 @@ NJS_NAPI_METHOD_IMPL_ASYNC(njsConnection_execute, 5, NULL)
     NJS_CHECK_NAPI(env, napi_get_value_bool(env, args[4], &executeMany))
 
     // process options
-    NJS_CHECK_NAPI(env, napi_create_reference(env, args[3], 1,
-            &baton->jsExecuteOptionsRef))
-    if (executeMany) {
-        if (!njsUtils_getNamedPropertyBool(env, args[3], "batchErrors",
-                &baton->batchErrors))
-            return false;
-        if (!njsUtils_getNamedPropertyBool(env, args[3], "dmlRowCounts",
-                &baton->dmlRowCounts))
-            return false;
-    } else {
-        NJS_CHECK_NAPI(env, napi_get_named_property(env, args[3],
-                "fetchArraySize", &temp))
-        NJS_CHECK_NAPI(env, napi_get_value_uint32(env, temp,
-                &baton->fetchArraySize))
-        NJS_CHECK_NAPI(env, napi_get_named_property(env, args[3],
-                "prefetchRows", &temp))
-        NJS_CHECK_NAPI(env, napi_get_value_uint32(env, temp,
-                &baton->prefetchRows))
-    }
-    NJS_CHECK_NAPI(env, napi_get_named_property(env, args[3], "autoCommit",
-            &temp))
-    NJS_CHECK_NAPI(env, napi_get_value_bool(env, temp, &baton->autoCommit))
-    NJS_CHECK_NAPI(env, napi_get_named_property(env, args[3],
-            "keepInStmtCache", &temp))
-    NJS_CHECK_NAPI(env, napi_get_value_bool(env, temp,
-            &baton->keepInStmtCache))
-    NJS_CHECK_NAPI(env, napi_get_named_property(env, args[3],
-            "suspendOnSuccess", &temp))
-    NJS_CHECK_NAPI(env, napi_get_value_bool(env, temp,
-            &baton->suspendOnSuccess))
+    if (!njsConnection_processExecuteOptions(baton, env, args[3],
+            executeMany))
+        return false;
 
     // process binds
     if (!njsConnection_processBinds(baton, env, args[2]))
@@ -716,8 +891,9 @@ static bool njsConnection_executeAsync(njsBaton *baton)
             return njsBaton_setErrorDPI(baton);
     }
 
-    // mark statement for removal from the cache, if applicable
-    if (!baton->keepInStmtCache) {
+    // mark statement for removal from the cache, if applicable; prepared
+    // statements are retained until they are closed
+    if (!baton->keepInStmtCache && !baton->preparedStmt) {
         if (dpiStmt_deleteFromCache(baton->dpiStmtHandle) < 0) {
             return njsBaton_setErrorDPI(baton);
         }
@@ -877,8 +1053,9 @@ static bool njsConnection_executeManyAsync(njsBaton *baton)
     if (!njsConnection_prepareAndBind(conn, baton))
         return false;
 
-    // mark statement for removal from the cache, if applicable
-    if (!baton->keepInStmtCache) {
+    // mark statement for removal from the cache, if applicable; prepared
+    // statements are retained until they are closed
+    if (!baton->keepInStmtCache && !baton->preparedStmt) {
         if (dpiStmt_deleteFromCache(baton->dpiStmtHandle) < 0) {
             return njsBaton_setErrorDPI(baton);
         }
@@ -996,6 +1173,57 @@ static bool njsConnection_executeManyPostAsync(njsBaton *baton, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsConnection_executePrepared()
+//   Executes a statement that was prepared by njsConnection_prepare(). The
+// statement handle is reused and bind variables retained by the prepared
+// statement from its previous execution are reused where possible.
+//
+// PARAMETERS
+//   - prepared statement
+//   - number of iterations to execute (for executeMany)
+//   - array of binds
+//   - options
+//   - executeMany flag
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsConnection_executePrepared, 5, NULL)
+{
+    njsPreparedStatement *stmt;
+    bool executeMany;
+
+    // validate prepared statement and process arguments
+    if (!njsBaton_setJsContext(baton, env))
+        return false;
+    NJS_CHECK_NAPI(env, napi_unwrap(env, args[0], (void**) &stmt))
+    if (!stmt->handle)
+        return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+    NJS_CHECK_NAPI(env, napi_create_reference(env, args[0], 1,
+            &baton->jsPreparedStatementRef))
+    baton->preparedStmt = stmt;
+    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[1],
+            &baton->bindArraySize))
+    NJS_CHECK_NAPI(env, napi_get_value_bool(env, args[4], &executeMany))
+
+    // process options
+    if (!njsConnection_processExecuteOptions(baton, env, args[3],
+            executeMany))
+        return false;
+
+    // process binds
+    if (!njsConnection_processBinds(baton, env, args[2]))
+        return false;
+
+    // queue async work
+    if (executeMany)
+        return njsBaton_queueWork(baton, env, "ExecuteMany",
+                njsConnection_executeManyAsync,
+                njsConnection_executeManyPostAsync, returnValue);
+    return njsBaton_queueWork(baton, env, "Execute",
+            njsConnection_executeAsync, njsConnection_executePostAsync,
+            returnValue);
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_finalize()
 //   Invoked when the njsConnection object is garbage collected.
@@ -1963,6 +2191,53 @@ static bool njsConnection_pingAsync(njsBaton *baton)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// njsConnection_prepare()
+//   Prepares a statement for repeated execution.
+//
+// PARAMETERS
+//   - SQL statement
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsConnection_prepare, 1, NULL)
+{
+    if (!njsUtils_copyStringFromJS(env, args[0], &baton->sql,
+            &baton->sqlLength))
+        return false;
+    return njsBaton_queueWork(baton, env, "Prepare",
+            njsConnection_prepareAsync, njsConnection_preparePostAsync,
+            returnValue);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsConnection_prepareAsync()
+//   Worker function for njsConnection_prepare().
+//-----------------------------------------------------------------------------
+static bool njsConnection_prepareAsync(njsBaton *baton)
+{
+    njsConnection *conn = (njsConnection*) baton->callingInstance;
+
+    if (dpiConn_prepareStmt(conn->handle, 0, baton->sql,
+            (uint32_t) baton->sqlLength, NULL, 0, &baton->dpiStmtHandle) < 0)
+        return njsBaton_setErrorDPI(baton);
+    if (dpiStmt_getInfo(baton->dpiStmtHandle, &baton->stmtInfo) < 0)
+        return njsBaton_setErrorDPI(baton);
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsConnection_preparePostAsync()
+//   Defines the value returned to JS.
+//-----------------------------------------------------------------------------
+static bool njsConnection_preparePostAsync(njsBaton *baton, napi_env env,
+        napi_value *result)
+{
+    return njsPreparedStatement_newFromBaton(baton, env, result);
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_prepareAndBind()
 //   Prepare statement and bind data to the statement.
@@ -1973,16 +2248,23 @@ static bool njsConnection_prepareAndBind(njsConnection *conn, njsBaton *baton)
     uint32_t i;
     int status;
 
-    // prepare statement
-    if (dpiConn_prepareStmt(conn->handle, 0, baton->sql,
-            (uint32_t) baton->sqlLength, NULL, 0, &baton->dpiStmtHandle) < 0)
-        return njsBaton_setErrorDPI(baton);
-
-    // determine statement information
-    if (dpiStmt_getInfo(baton->dpiStmtHandle, &baton->stmtInfo) < 0)
-        return njsBaton_setErrorDPI(baton);
+    // prepare statement, or use the statement that was prepared earlier
+    if (baton->preparedStmt) {
+        if (dpiStmt_addRef(baton->preparedStmt->handle) < 0)
+            return njsBaton_setErrorDPI(baton);
+        baton->dpiStmtHandle = baton->preparedStmt->handle;
+        baton->stmtInfo = baton->preparedStmt->stmtInfo;
+    } else {
+        if (dpiConn_prepareStmt(conn->handle, 0, baton->sql,
+                (uint32_t) baton->sqlLength, NULL, 0,
+                &baton->dpiStmtHandle) < 0)
+            return njsBaton_setErrorDPI(baton);
+        if (dpiStmt_getInfo(baton->dpiStmtHandle, &baton->stmtInfo) < 0)
+            return njsBaton_setErrorDPI(baton);
+    }
 
-    // perform any binds necessary
+    // perform any binds necessary; variables that are being reused are
+    // already bound to the statement, which ODPI-C detects
     for (i = 0; i < baton->numBindVars; i++) {
         var = &baton->bindVars[i];
         if (var->name) {
@@ -2008,8 +2290,8 @@ static bool njsConnection_processBindUnit(njsBaton *baton, napi_env env,
         napi_value bindUnit, njsVariable *var)
 {
     njsConnection *conn = (njsConnection*) baton->callingInstance;
+    uint32_t i, arrayLength, numDimensions = 0;
     napi_value temp, bindValues, bindType;
-    uint32_t i, arrayLength;
 
     // determine name/position
     if (!njsUtils_getNamedProperty(env, bindUnit, "name", &temp))
@@ -2059,14 +2341,35 @@ static bool njsConnection_processBindUnit(njsBaton *baton, napi_env env,
         var->maxArraySize = baton->bindArraySize;
     }
 
-    // create buffer for variable
-    if (!njsVariable_createBuffer(var, conn, baton))
+    // determine if the values were supplied to executeMany() as a typed array
+    // (optional)
+    if (!njsUtils_getNamedPropertyUnsignedInt(env, bindUnit,
+            "columnArrayType", &var->columnArrayType))
+        return false;
+
+    // create buffer for variable, unless the buffer used by the previous
+    // execution of a prepared statement can be reused
+    if (!njsConnection_reuseBindVar(baton, var) &&
+            !njsVariable_createBuffer(var, conn, baton))
         return false;
 
     // process bind value (except for OUT variables)
     if (var->bindDir != NJS_BIND_OUT) {
         NJS_CHECK_NAPI(env, napi_get_named_property(env, bindUnit, "values",
                 &bindValues))
+        if (var->columnArrayType != NJS_COLUMN_ARRAY_TYPE_ARRAY) {
+            NJS_CHECK_NAPI(env, napi_get_named_property(env, bindUnit,
+                    "nulls", &temp))
+            if (var->columnArrayType == NJS_COLUMN_ARRAY_TYPE_VECTOR) {
+                if (!njsUtils_getNamedPropertyUnsignedInt(env, bindUnit,
+                        "dims", &numDimensions))
+                    return false;
+                return njsVariable_setVectorColumnValues(var, env,
+                        bindValues, temp, numDimensions, baton);
+            }
+            return njsVariable_setColumnValues(var, env, bindValues, temp,
+                    baton);
+        }
         if (var->isArray) {
             NJS_CHECK_NAPI(env, napi_get_array_length(env, bindValues,
                     &arrayLength))
@@ -2118,6 +2421,51 @@ static bool njsConnection_processBinds(njsBaton *baton, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsConnection_processExecuteOptions()
+//   Process the options passed through to the execute() and executeMany()
+// calls.
+//-----------------------------------------------------------------------------
+static bool njsConnection_processExecuteOptions(njsBaton *baton, napi_env env,
+        napi_value options, bool executeMany)
+{
+    napi_value temp;
+
+    NJS_CHECK_NAPI(env, napi_create_reference(env, options, 1,
+            &baton->jsExecuteOptionsRef))
+    if (executeMany) {
+        if (!njsUtils_getNamedPropertyBool(env, options, "batchErrors",
+                &baton->batchErrors))
+            return false;
+        if (!njsUtils_getNamedPropertyBool(env, options, "dmlRowCounts",
+                &baton->dmlRowCounts))
+            return false;
+    } else {
+        NJS_CHECK_NAPI(env, napi_get_named_property(env, options,
+                "fetchArraySize", &temp))
+        NJS_CHECK_NAPI(env, napi_get_value_uint32(env, temp,
+                &baton->fetchArraySize))
+        NJS_CHECK_NAPI(env, napi_get_named_property(env, options,
+                "prefetchRows", &temp))
+        NJS_CHECK_NAPI(env, napi_get_value_uint32(env, temp,
+                &baton->prefetchRows))
+    }
+    NJS_CHECK_NAPI(env, napi_get_named_property(env, options, "autoCommit",
+            &temp))
+    NJS_CHECK_NAPI(env, napi_get_value_bool(env, temp, &baton->autoCommit))
+    NJS_CHECK_NAPI(env, napi_get_named_property(env, options,
+            "keepInStmtCache", &temp))
+    NJS_CHECK_NAPI(env, napi_get_value_bool(env, temp,
+            &baton->keepInStmtCache))
+    NJS_CHECK_NAPI(env, napi_get_named_property(env, options,
+            "suspendOnSuccess", &temp))
+    NJS_CHECK_NAPI(env, napi_get_value_bool(env, temp,
+            &baton->suspendOnSuccess))
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_processImplicitResults()
 //   Process implicit results.
@@ -2200,6 +2548,146 @@ static bool njsConnection_rollbackAsync(njsBaton *baton)
 }
 
 
+//-----------------------------------------------------------------------------
+// njsConnection_runPipeline()
+//   Executes all of the operations of a pipeline in a single worker function
+// so that only one trip to the thread pool is required. An array is returned
+// with one element for each operation which is either undefined (when the
+// operation was not executed), an object containing the result of the
+// operation or an object containing the error that occurred.
+//
+// PARAMETERS
+//   - array of operations (null when the operation is to be skipped)
+//   - continue on error flag
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsConnection_runPipeline, 2, NULL)
+{
+    napi_value op;
+    uint32_t i;
+
+    // process arguments
+    if (!njsBaton_setJsContext(baton, env))
+        return false;
+    NJS_CHECK_NAPI(env, napi_get_value_bool(env, args[1],
+            &baton->continueOnError))
+    NJS_CHECK_NAPI(env, napi_get_array_length(env, args[0],
+            &baton->numPipelineOps))
+
+    // create batons for each of the operations
+    if (baton->numPipelineOps > 0) {
+        baton->pipelineOps = calloc(baton->numPipelineOps,
+                sizeof(njsPipelineOp));
+        if (!baton->pipelineOps)
+            return njsUtils_throwInsufficientMemory(env);
+        for (i = 0; i < baton->numPipelineOps; i++) {
+            NJS_CHECK_NAPI(env, napi_get_element(env, args[0], i, &op))
+            if (!njsConnection_createPipelineOp(baton, env, op,
+                    &baton->pipelineOps[i]))
+                return false;
+        }
+    }
+
+    // queue async work
+    return njsBaton_queueWork(baton, env, "RunPipeline",
+            njsConnection_runPipelineAsync,
+            njsConnection_runPipelinePostAsync, returnValue);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsConnection_runPipelineAsync()
+//   Worker function for njsConnection_runPipeline(). Errors are retained on
+// the baton of the operation that failed. Unless continuing on error, the
+// remaining operations are skipped when an error occurs.
+//-----------------------------------------------------------------------------
+static bool njsConnection_runPipelineAsync(njsBaton *baton)
+{
+    njsPipelineOp *op;
+    uint32_t i, j;
+    bool ok;
+
+    for (i = 0; i < baton->numPipelineOps; i++) {
+        op = &baton->pipelineOps[i];
+        switch (op->opType) {
+            case NJS_PIPELINE_OP_COMMIT:
+                ok = njsConnection_commitAsync(op->baton);
+                break;
+            case NJS_PIPELINE_OP_EXECUTE:
+                ok = njsConnection_executeAsync(op->baton);
+                break;
+            case NJS_PIPELINE_OP_EXECUTE_MANY:
+                ok = njsConnection_executeManyAsync(op->baton);
+                break;
+            default:
+                continue;
+        }
+        if (op->baton->warningInfo.isWarning)
+            njsConnection_copyErrorMessage(&op->baton->warningInfo,
+                    op->warning);
+        if (!ok) {
+            op->baton->hasError = true;
+            if (op->baton->dpiError)
+                njsConnection_copyErrorMessage(&op->baton->errorInfo,
+                        op->baton->error);
+            if (!baton->continueOnError) {
+                for (j = i + 1; j < baton->numPipelineOps; j++)
+                    baton->pipelineOps[j].opType = NJS_PIPELINE_OP_SKIP;
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsConnection_runPipelinePostAsync()
+//   Defines the value returned to JS.
+//-----------------------------------------------------------------------------
+static bool njsConnection_runPipelinePostAsync(njsBaton *baton, napi_env env,
+        napi_value *result)
+{
+    napi_value opResult, temp;
+    njsPipelineOp *op;
+    uint32_t i;
+    bool ok;
+
+    NJS_CHECK_NAPI(env, napi_create_array_with_length(env,
+            baton->numPipelineOps, result))
+    for (i = 0; i < baton->numPipelineOps; i++) {
+        op = &baton->pipelineOps[i];
+        if (op->opType == NJS_PIPELINE_OP_SKIP)
+            continue;
+        NJS_CHECK_NAPI(env, napi_create_object(env, &opResult))
+        if (op->baton->hasError) {
+            if (!njsBaton_getErrorInfo(op->baton, env, &temp))
+                return false;
+            NJS_CHECK_NAPI(env, napi_set_named_property(env, opResult,
+                    "error", temp))
+        } else {
+            NJS_CHECK_NAPI(env, napi_get_undefined(env, &temp))
+            ok = true;
+            if (op->opType == NJS_PIPELINE_OP_EXECUTE) {
+                ok = njsConnection_executePostAsync(op->baton, env, &temp);
+            } else if (op->opType == NJS_PIPELINE_OP_EXECUTE_MANY) {
+                ok = njsConnection_executeManyPostAsync(op->baton, env,
+                        &temp);
+            }
+            if (!ok && op->baton->hasError)
+                return njsConnection_transferPipelineOpError(baton, op->baton);
+            if (!ok)
+                return false;
+            NJS_CHECK_NAPI(env, napi_set_named_property(env, opResult,
+                    "result", temp))
+        }
+        NJS_CHECK_NAPI(env, napi_set_element(env, *result, i, opResult))
+    }
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_setAction()
 //   Set accessor of "action" property.
@@ -2331,6 +2819,70 @@ NJS_NAPI_METHOD_IMPL_SYNC(njsConnection_setTag, 1, NULL)
 }
 
 
+//-----------------------------------------------------------------------------
+// njsConnection_reuseBindVar()
+//   Determines if the bind variable retained by a prepared statement from its
+// previous execution can be reused for the variable. This is only possible
+// for scalar IN binds of the same type at the same position or name, which
+// require no more space than the variable that is being reused. If the
+// variable can be reused, its ODPI-C variable and buffer are transferred.
+//-----------------------------------------------------------------------------
+static bool njsConnection_reuseBindVar(njsBaton *baton, njsVariable *var)
+{
+    njsPreparedStatement *stmt = baton->preparedStmt;
+    njsVariable *prevVar;
+    uint32_t varIndex;
+
+    // only variables retained by a prepared statement can be reused
+    varIndex = (uint32_t) (var - baton->bindVars);
+    if (!stmt || stmt->numBindVars != baton->numBindVars)
+        return false;
+    prevVar = &stmt->bindVars[varIndex];
+    if (!prevVar->dpiVarHandle)
+        return false;
+
+    // the bind position or name must match
+    if (var->name) {
+        if (!prevVar->name || var->nameLength != prevVar->nameLength ||
+                strncmp(var->name, prevVar->name, var->nameLength) != 0)
+            return false;
+    } else if (prevVar->name || var->pos != prevVar->pos) {
+        return false;
+    }
+
+    // the variable must be a scalar IN bind of the same type and size
+    if (var->bindDir != NJS_BIND_IN || prevVar->bindDir != NJS_BIND_IN ||
+            var->isArray || prevVar->isArray ||
+            var->varTypeNum != prevVar->varTypeNum ||
+            var->columnArrayType != prevVar->columnArrayType ||
+            var->maxArraySize != prevVar->maxArraySize ||
+            var->maxSize > prevVar->maxSize)
+        return false;
+
+    // variables which reference other ODPI-C handles are not reused
+    switch (prevVar->nativeTypeNum) {
+        case DPI_NATIVE_TYPE_LOB:
+        case DPI_NATIVE_TYPE_OBJECT:
+        case DPI_NATIVE_TYPE_STMT:
+        case DPI_NATIVE_TYPE_JSON:
+        case DPI_NATIVE_TYPE_ROWID:
+        case DPI_NATIVE_TYPE_VECTOR:
+            return false;
+        default:
+            break;
+    }
+
+    // transfer the variable
+    var->nativeTypeNum = prevVar->nativeTypeNum;
+    var->maxSize = prevVar->maxSize;
+    var->dpiVarHandle = prevVar->dpiVarHandle;
+    var->buffer = prevVar->buffer;
+    prevVar->dpiVarHandle = NULL;
+    prevVar->buffer = NULL;
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_setTextAttribute()
 //   Sets the specified text attribute by calling the specified ODPI-C
@@ -3007,6 +3559,27 @@ static bool njsConnection_tpcRollbackAsync(njsBaton *baton)
 }
 
 
+//-----------------------------------------------------------------------------
+// njsConnection_transferPipelineOpError()
+//   Transfers the error that occurred on the baton of an operation of a
+// pipeline to the pipeline baton so that it is reported to the caller. False
+// is returned as a convenience to the caller.
+//-----------------------------------------------------------------------------
+static bool njsConnection_transferPipelineOpError(njsBaton *baton,
+        njsBaton *opBaton)
+{
+    if (opBaton->dpiError)
+        njsConnection_copyErrorMessage(&opBaton->errorInfo, opBaton->error);
+    baton->dpiError = opBaton->dpiError;
+    baton->errorInfo = opBaton->errorInfo;
+    strcpy(baton->error, opBaton->error);
+    if (baton->dpiError)
+        baton->errorInfo.message = baton->error;
+    baton->hasError = true;
+    return false;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsConnection_unsubscribe()
 //   Unsubscribe from events in the database that were originally subscribed
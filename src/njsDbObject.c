@@ -674,7 +674,8 @@ static bool njsDbObject_transformFromOracle(njsDbObject *obj, napi_env env,
             NJS_CHECK_NAPI(env, napi_get_reference_value(env,
                     globals->jsMakeDateFn, &makeDateFn))
             return njsUtils_getDateValue(typeInfo->oracleTypeNum, env,
-                    makeDateFn, &data->value.asTimestamp, value);
+                    &globals->dateCache, makeDateFn, &data->value.asTimestamp,
+                    value);
         case DPI_ORACLE_TYPE_CLOB:
         case DPI_ORACLE_TYPE_NCLOB:
         case DPI_ORACLE_TYPE_BLOB:
@@ -784,7 +785,8 @@ static bool njsDbObject_transformToOracle(njsDbObject *obj, napi_env env,
                         globals->jsGetDateComponentsFn, &getComponentsFn))
                 *nativeTypeNum = DPI_NATIVE_TYPE_TIMESTAMP;
                 return njsUtils_setDateValue(oracleTypeNum, env, value,
-                        getComponentsFn, &data->value.asTimestamp);
+                        &globals->dateCache, getComponentsFn,
+                        &data->value.asTimestamp);
             }
 
             // handle buffers
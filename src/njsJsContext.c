@@ -32,6 +32,10 @@
 
 #include "njsModule.h"
 
+// forward declarations for functions only used in this file
+static bool njsJsContext_getJsonKey(njsJsContext *jsContext, const char *name,
+        uint32_t nameLength, napi_env env, napi_value *key);
+
 //-----------------------------------------------------------------------------
 // njsJsContext_populate()
 //   Sets the JavaScript values on the njsContext structure. These are a number
@@ -41,6 +45,14 @@
 bool njsJsContext_populate(napi_env env, njsModuleGlobals *globals,
         njsJsContext *jsContext)
 {
+    // acquire the cache of time zone offsets
+    jsContext->dateCache = &globals->dateCache;
+
+    // acquire the cache of JSON field names
+    jsContext->jsonKeyCache = &globals->jsonKeyCache;
+    NJS_CHECK_NAPI(env, napi_get_reference_value(env, globals->jsJsonKeys,
+            &jsContext->jsJsonKeys))
+
     // acquire the LOB constructor
     NJS_CHECK_NAPI(env, napi_get_reference_value(env,
             globals->jsLobConstructor, &jsContext->jsLobConstructor))
@@ -95,6 +107,56 @@ bool njsJsContext_populate(napi_env env, njsModuleGlobals *globals,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsJsContext_getJsonKey()
+//   Return the JavaScript string used as the key for a field of a JSON
+// object. Names that are short enough are looked up in a cache (indexed by a
+// hash of the name) and are only created if they are not already present.
+//-----------------------------------------------------------------------------
+static bool njsJsContext_getJsonKey(njsJsContext *jsContext, const char *name,
+        uint32_t nameLength, napi_env env, napi_value *key)
+{
+    njsJsonKeyCacheEntry *entry;
+    uint32_t hash, i, index;
+
+    // long names are not cached
+    if (nameLength > NJS_JSON_KEY_CACHE_MAX_LENGTH) {
+        NJS_CHECK_NAPI(env, napi_create_string_utf8(env, name, nameLength,
+                key))
+        return true;
+    }
+
+    // calculate the hash of the name (FNV-1a) to determine the entry to use
+    hash = 2166136261u;
+    for (i = 0; i < nameLength; i++) {
+        hash ^= (uint8_t) name[i];
+        hash *= 16777619u;
+    }
+    index = hash % NJS_JSON_KEY_CACHE_SIZE;
+    entry = &jsContext->jsonKeyCache->entries[index];
+
+    // if the entry matches the name, use the cached key
+    if (entry->isValid && entry->hash == hash &&
+            entry->nameLength == nameLength &&
+            memcmp(entry->name, name, nameLength) == 0) {
+        NJS_CHECK_NAPI(env, napi_get_element(env, jsContext->jsJsonKeys,
+                index, key))
+        return true;
+    }
+
+    // otherwise, create the key and replace the entry
+    NJS_CHECK_NAPI(env, napi_create_string_utf8(env, name, nameLength, key))
+    NJS_CHECK_NAPI(env, napi_set_element(env, jsContext->jsJsonKeys, index,
+            *key))
+    entry->hash = hash;
+    entry->nameLength = nameLength;
+    memcpy(entry->name, name, nameLength);
+    entry->isValid = true;
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsJsContext_getJsonNodeValue()
 //   Return an appropriate JavaScript value for the JSON node.
@@ -134,8 +196,9 @@ bool njsJsContext_getJsonNodeValue(njsJsContext *jsContext, dpiJsonNode *node,
             obj = &node->value->asJsonObject;
             NJS_CHECK_NAPI(env, napi_create_object(env, value))
             for (i = 0; i< obj->numFields; i++) {
-                NJS_CHECK_NAPI(env, napi_create_string_utf8(env,
-                        obj->fieldNames[i], obj->fieldNameLengths[i], &key))
+                if (!njsJsContext_getJsonKey(jsContext, obj->fieldNames[i],
+                        obj->fieldNameLengths[i], env, &key))
+                    return false;
                 if (!njsJsContext_getJsonNodeValue(jsContext, &obj->fields[i],
                         env, &temp))
                     return false;
@@ -160,7 +223,8 @@ bool njsJsContext_getJsonNodeValue(njsJsContext *jsContext, dpiJsonNode *node,
         case DPI_ORACLE_TYPE_DATE:
         case DPI_ORACLE_TYPE_TIMESTAMP:
             return njsUtils_getDateValue(node->oracleTypeNum, env,
-                jsContext->jsMakeDateFn, &node->value->asTimestamp, value);
+                jsContext->dateCache, jsContext->jsMakeDateFn,
+                &node->value->asTimestamp, value);
             return true;
         case DPI_ORACLE_TYPE_BOOLEAN:
             NJS_CHECK_NAPI(env, napi_get_boolean(env, node->value->asBoolean,
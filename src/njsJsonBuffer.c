@@ -33,96 +33,29 @@
 #include "njsModule.h"
 
 // forward declarations for functions only used in this file
-static void njsJsonBuffer_freeNode(dpiJsonNode *node);
 static bool njsJsonBuffer_getString(njsJsonBuffer *buf, napi_env env,
         napi_value inValue, char **outValue, uint32_t *outValueLength);
 static bool njsJsonBuffer_populateNode(njsJsonBuffer *buf, dpiJsonNode *node,
         napi_env env, napi_value value, njsJsContext *jsContext);
 
 
-//-----------------------------------------------------------------------------
-// njsJsonBuffer_freeNode()
-//-----------------------------------------------------------------------------
-static void njsJsonBuffer_freeNode(dpiJsonNode *node)
-{
-    dpiJsonArray *array;
-    dpiJsonObject *obj;
-    uint32_t i;
-
-    switch (node->nativeTypeNum) {
-        case DPI_NATIVE_TYPE_JSON_ARRAY:
-            array = &node->value->asJsonArray;
-            if (array->elements) {
-                for (i = 0; i < array->numElements; i++) {
-                    if (array->elements[i].value)
-                        njsJsonBuffer_freeNode(&array->elements[i]);
-                }
-                free(array->elements);
-                array->elements = NULL;
-            }
-            if (array->elementValues) {
-                free(array->elementValues);
-                array->elementValues = NULL;
-            }
-            break;
-        case DPI_NATIVE_TYPE_JSON_OBJECT:
-            obj = &node->value->asJsonObject;
-            if (obj->fields) {
-                for (i = 0; i < obj->numFields; i++) {
-                    if (obj->fields[i].value)
-                        njsJsonBuffer_freeNode(&obj->fields[i]);
-                }
-                free(obj->fields);
-                obj->fields = NULL;
-            }
-            if (obj->fieldNames) {
-                free(obj->fieldNames);
-                obj->fieldNames = NULL;
-            }
-            if (obj->fieldNameLengths) {
-                free(obj->fieldNameLengths);
-                obj->fieldNameLengths = NULL;
-            }
-            if (obj->fieldValues) {
-                free(obj->fieldValues);
-                obj->fieldValues = NULL;
-            }
-            break;
-    }
-}
-
-
 //-----------------------------------------------------------------------------
 // njsJsonBuffer_getString()
-//   Acquire a new buffer from the array of buffers and then allocate the
-// requested space to store the string value. If an element in the array is not
-// available, more space for the array is allocated in chunks.
+//   Allocate space from the arena to store the string value.
 //-----------------------------------------------------------------------------
 static bool njsJsonBuffer_getString(njsJsonBuffer *buf, napi_env env,
         napi_value inValue, char **outValue, uint32_t *outValueLength)
 {
-    char **tempBuffers, *temp;
     size_t tempLength;
+    char *temp;
 
     *outValue = NULL;
     *outValueLength = 0;
-    if (buf->numBuffers == buf->allocatedBuffers) {
-        buf->allocatedBuffers += 16;
-        tempBuffers = malloc(buf->allocatedBuffers * sizeof(char*));
-        if (!tempBuffers)
-            return njsUtils_throwInsufficientMemory(env);
-        if (buf->numBuffers > 0) {
-            memcpy(tempBuffers, buf->buffers, buf->numBuffers * sizeof(char*));
-            free(buf->buffers);
-        }
-        buf->buffers = tempBuffers;
-    }
     NJS_CHECK_NAPI(env, napi_get_value_string_utf8(env, inValue, NULL, 0,
             &tempLength))
-    temp = malloc(tempLength + 1);
+    temp = njsArena_alloc(buf->arena, tempLength + 1);
     if (!temp)
         return njsUtils_throwInsufficientMemory(env);
-    buf->buffers[buf->numBuffers++] = temp;
     NJS_CHECK_NAPI(env, napi_get_value_string_utf8(env, inValue, temp,
             tempLength + 1, &tempLength))
     *outValue = temp;
@@ -200,9 +133,10 @@ static bool njsJsonBuffer_populateNode(njsJsonBuffer *buf, dpiJsonNode *node,
         array = &node->value->asJsonArray;
         NJS_CHECK_NAPI(env, napi_get_array_length(env, value,
                 &array->numElements))
-        array->elements = calloc(array->numElements, sizeof(dpiJsonNode));
-        array->elementValues = calloc(array->numElements,
-                sizeof(dpiDataBuffer));
+        array->elements = njsArena_alloc(buf->arena,
+                array->numElements * sizeof(dpiJsonNode));
+        array->elementValues = njsArena_alloc(buf->arena,
+                array->numElements * sizeof(dpiDataBuffer));
         if (!array->elements || !array->elementValues)
             return njsUtils_throwInsufficientMemory(env);
         for (i = 0; i < array->numElements; i++) {
@@ -221,7 +155,7 @@ static bool njsJsonBuffer_populateNode(njsJsonBuffer *buf, dpiJsonNode *node,
         node->oracleTypeNum = DPI_ORACLE_TYPE_TIMESTAMP;
         node->nativeTypeNum = DPI_NATIVE_TYPE_TIMESTAMP;
         return njsUtils_setDateValue(DPI_ORACLE_TYPE_TIMESTAMP, env, value,
-                jsContext->jsGetDateComponentsFn,
+                jsContext->dateCache, jsContext->jsGetDateComponentsFn,
                 &node->value->asTimestamp);
     }
 
@@ -316,10 +250,14 @@ static bool njsJsonBuffer_populateNode(njsJsonBuffer *buf, dpiJsonNode *node,
             &obj->numFields))
     NJS_CHECK_NAPI(env, napi_get_named_property(env, value, "values",
             &fieldValues))
-    obj->fieldNames = calloc(obj->numFields, sizeof(char*));
-    obj->fieldNameLengths = calloc(obj->numFields, sizeof(uint32_t));
-    obj->fields = calloc(obj->numFields, sizeof(dpiJsonNode));
-    obj->fieldValues = calloc(obj->numFields, sizeof(dpiDataBuffer));
+    obj->fieldNames = njsArena_alloc(buf->arena,
+            obj->numFields * sizeof(char*));
+    obj->fieldNameLengths = njsArena_alloc(buf->arena,
+            obj->numFields * sizeof(uint32_t));
+    obj->fields = njsArena_alloc(buf->arena,
+            obj->numFields * sizeof(dpiJsonNode));
+    obj->fieldValues = njsArena_alloc(buf->arena,
+            obj->numFields * sizeof(dpiDataBuffer));
     if (!obj->fieldNames || !obj->fieldNameLengths || !obj->fields ||
             !obj->fieldValues)
         return njsUtils_throwInsufficientMemory(env);
@@ -340,33 +278,34 @@ static bool njsJsonBuffer_populateNode(njsJsonBuffer *buf, dpiJsonNode *node,
 
 //-----------------------------------------------------------------------------
 // njsJsonBuffer_free()
-//   Frees any memory allocated for the JSON buffer.
+//   Releases the memory allocated for the JSON buffer. If the buffer was
+// populated using an arena supplied by the caller, the arena is reset so that
+// its memory can be reused for the next value; otherwise, the buffer's own
+// arena is freed.
 //-----------------------------------------------------------------------------
 void njsJsonBuffer_free(njsJsonBuffer *buf)
 {
-    uint32_t i;
-
-    if (buf->buffers) {
-        for (i = 0; i < buf->numBuffers; i++)
-            free(buf->buffers[i]);
-        free(buf->buffers);
-        buf->buffers = NULL;
+    if (buf->arena == &buf->localArena) {
+        njsArena_free(buf->arena);
+    } else {
+        njsArena_reset(buf->arena);
     }
-    njsJsonBuffer_freeNode(&buf->topNode);
 }
 
 //-----------------------------------------------------------------------------
 // njsJsonBuffer_fromValue()
-//   Populates a JSON buffer from the specified JavaScript value.
+//   Populates a JSON buffer from the specified JavaScript value. All memory
+// required for the nodes and strings is allocated from the given arena or, if
+// no arena is specified, from an arena owned by the buffer.
 //-----------------------------------------------------------------------------
 bool njsJsonBuffer_fromValue(njsJsonBuffer *buf, napi_env env,
-        napi_value value, njsJsContext *jsContext)
+        napi_value value, njsJsContext *jsContext, njsArena *arena)
 {
     // initialize JSON buffer structure
     buf->topNode.value = &buf->topNodeBuffer;
-    buf->allocatedBuffers = 0;
-    buf->numBuffers = 0;
-    buf->buffers = NULL;
+    buf->localArena.firstBlock = NULL;
+    buf->localArena.currentBlock = NULL;
+    buf->arena = (arena) ? arena : &buf->localArena;
 
     // populate the top level node
     return njsJsonBuffer_populateNode(buf, &buf->topNode, env, value, jsContext);
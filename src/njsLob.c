@@ -63,6 +63,10 @@ static NJS_ASYNC_POST_METHOD(njsLob_readPostAsync);
 // finalize
 static NJS_NAPI_FINALIZE(njsLob_finalize);
 
+// other methods
+static bool njsLob_getUint64(napi_env env, napi_value value,
+        uint64_t *result);
+
 // properties defined by the class
 static const napi_property_descriptor njsClassProperties[] = {
     { "close", NULL, njsLob_close, NULL, NULL, NULL, napi_default, NULL },
@@ -169,7 +173,8 @@ NJS_NAPI_METHOD_IMPL_SYNC(njsLob_getLength, 0, NULL)
 {
     njsLob *lob = (njsLob*) callingInstance;
 
-    NJS_CHECK_NAPI(env, napi_create_uint32(env, lob->length, returnValue))
+    NJS_CHECK_NAPI(env, napi_create_double(env, (double) lob->length,
+            returnValue))
     return true;
 }
 
@@ -212,10 +217,10 @@ NJS_NAPI_METHOD_IMPL_SYNC(njsLob_getType, 0, NULL)
 //-----------------------------------------------------------------------------
 NJS_NAPI_METHOD_IMPL_ASYNC(njsLob_getData, 2, NULL)
 {
-    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[0],
-            &baton->lobOffset))
-    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[1],
-            &baton->lobAmount))
+    if (!njsLob_getUint64(env, args[0], &baton->lobOffset))
+        return false;
+    if (!njsLob_getUint64(env, args[1], &baton->lobAmount))
+        return false;
     return njsBaton_queueWork(baton, env, "GetData", njsLob_getDataAsync,
             njsLob_getDataPostAsync, returnValue);
 }
@@ -228,7 +233,7 @@ NJS_NAPI_METHOD_IMPL_ASYNC(njsLob_getData, 2, NULL)
 static bool njsLob_getDataAsync(njsBaton *baton)
 {
     njsLob *lob = (njsLob*) baton->callingInstance;
-    uint32_t len;
+    uint64_t len;
 
     // if the length is marked dirty, acquire it at this time
     if (lob->dirtyLength) {
@@ -287,15 +292,32 @@ static bool njsLob_getDataPostAsync(njsBaton *baton, napi_env env,
             lob->dataType == DPI_ORACLE_TYPE_NCLOB) {
         NJS_CHECK_NAPI(env, napi_create_string_utf8(env, baton->bufferPtr,
                 baton->bufferSize, result))
-    } else {
-        NJS_CHECK_NAPI(env, napi_create_buffer_copy(env, baton->bufferSize,
-                baton->bufferPtr, NULL, result))
+    } else if (!njsUtils_createExternalBuffer(env, &baton->bufferPtr,
+            baton->bufferSize, result)) {
+        return false;
     }
 
     return true;
 }
 
 
+//-----------------------------------------------------------------------------
+// njsLob_getUint64()
+//   Returns the value of a JavaScript number as a 64-bit unsigned integer.
+// LOB offsets, amounts and sizes may exceed 4 GB. The value has already been
+// validated by the calling JavaScript code.
+//-----------------------------------------------------------------------------
+static bool njsLob_getUint64(napi_env env, napi_value value,
+        uint64_t *result)
+{
+    int64_t temp;
+
+    NJS_CHECK_NAPI(env, napi_get_value_int64(env, value, &temp))
+    *result = (uint64_t) temp;
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsLob_new()
 //   Creates a new LOB object.
@@ -359,7 +381,8 @@ bool njsLob_populateBuffer(njsBaton *baton, njsLobBuffer *buffer)
 //-----------------------------------------------------------------------------
 NJS_NAPI_METHOD_IMPL_ASYNC(njsLob_read, 1, NULL)
 {
-    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[0], &baton->lobOffset))
+    if (!njsLob_getUint64(env, args[0], &baton->lobOffset))
+        return false;
     return njsBaton_queueWork(baton, env, "Read", njsLob_readAsync,
             njsLob_readPostAsync, returnValue);
 }
@@ -374,13 +397,25 @@ static bool njsLob_readAsync(njsBaton *baton)
     njsLob *lob = (njsLob*) baton->callingInstance;
     bool ok = true;
 
+    // binary data is read into a new buffer for each piece which is then
+    // handed to JS without being copied
+    if (lob->dataType == NJS_DATATYPE_BLOB ||
+            lob->dataType == NJS_DATATYPE_BFILE) {
+        baton->bufferSize = lob->pieceSize;
+        baton->bufferPtr = malloc(baton->bufferSize);
+        if (!baton->bufferPtr)
+            return njsBaton_setErrorInsufficientMemory(baton);
+        if (dpiLob_readBytes(lob->handle, baton->lobOffset, lob->pieceSize,
+                baton->bufferPtr, &baton->bufferSize) < 0)
+            return njsBaton_setErrorDPI(baton);
+        return true;
+    }
+
     // if no LOB buffer exists, create one
     if (!lob->bufferPtr) {
 
         // determine the size in bytes of the buffer to create
-        if (lob->dataType == NJS_DATATYPE_BLOB) {
-            lob->bufferSize = lob->pieceSize;
-        } else if (dpiLob_getBufferSize(lob->handle, lob->pieceSize,
+        if (dpiLob_getBufferSize(lob->handle, lob->pieceSize,
                 &lob->bufferSize) < 0) {
             ok = njsBaton_setErrorDPI(baton);
         }
@@ -419,9 +454,9 @@ static bool njsLob_readPostAsync(njsBaton *baton, napi_env env,
             lob->dataType == DPI_ORACLE_TYPE_NCLOB) {
         NJS_CHECK_NAPI(env, napi_create_string_utf8(env, lob->bufferPtr,
                 baton->bufferSize, result))
-    } else {
-        NJS_CHECK_NAPI(env, napi_create_buffer_copy(env, baton->bufferSize,
-                lob->bufferPtr, NULL, result))
+    } else if (!njsUtils_createExternalBuffer(env, &baton->bufferPtr,
+            baton->bufferSize, result)) {
+        return false;
     }
 
     return true;
@@ -551,7 +586,8 @@ NJS_NAPI_METHOD_IMPL_ASYNC(njsLob_write, 2, NULL)
     bool isBuffer;
 
     // get the offset (characters for CLOBs, bytes for BLOBs)
-    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[0], &baton->lobOffset))
+    if (!njsLob_getUint64(env, args[0], &baton->lobOffset))
+        return false;
 
     // determine if a buffer was passed
     NJS_CHECK_NAPI(env, napi_is_buffer(env, args[1], &isBuffer))
@@ -605,8 +641,8 @@ static bool njsLob_writeAsync(njsBaton *baton)
 //-----------------------------------------------------------------------------
 NJS_NAPI_METHOD_IMPL_ASYNC(njsLob_trim, 1, NULL)
 {
-    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[0],
-            &baton->newLobSize))
+    if (!njsLob_getUint64(env, args[0], &baton->newLobSize))
+        return false;
     return njsBaton_queueWork(baton, env, "Trim", njsLob_trimAsync, NULL,
             returnValue);
 }
@@ -104,6 +104,10 @@ static void njsModule_finalizeGlobals(napi_env env, void *finalize_data,
 {
     njsModuleGlobals *globals = (njsModuleGlobals*) finalize_data;
 
+    if (globals->workerPool) {
+        njsWorkerPool_free(globals->workerPool);
+        globals->workerPool = NULL;
+    }
     if (globals->context) {
         dpiContext_destroy(globals->context);
         globals->context = NULL;
@@ -116,6 +120,7 @@ static void njsModule_finalizeGlobals(napi_env env, void *finalize_data,
     NJS_DELETE_REF_AND_CLEAR(globals->jsConnectionConstructor);
     NJS_DELETE_REF_AND_CLEAR(globals->jsLobConstructor);
     NJS_DELETE_REF_AND_CLEAR(globals->jsPoolConstructor);
+    NJS_DELETE_REF_AND_CLEAR(globals->jsPreparedStatementConstructor);
     NJS_DELETE_REF_AND_CLEAR(globals->jsResultSetConstructor);
     NJS_DELETE_REF_AND_CLEAR(globals->jsSodaCollectionConstructor);
     NJS_DELETE_REF_AND_CLEAR(globals->jsSodaDatabaseConstructor);
@@ -130,6 +135,8 @@ static void njsModule_finalizeGlobals(napi_env env, void *finalize_data,
     NJS_DELETE_REF_AND_CLEAR(globals->jsSparseVectorConstructor);
     NJS_DELETE_REF_AND_CLEAR(globals->jsIntervalYMConstructor);
     NJS_DELETE_REF_AND_CLEAR(globals->jsIntervalDSConstructor);
+    NJS_DELETE_REF_AND_CLEAR(globals->jsJsonKeys);
+    NJS_FREE_AND_CLEAR(globals->dateCache.tzName);
     free(globals);
 }
 
@@ -145,6 +152,7 @@ static void njsModule_finalizeGlobals(napi_env env, void *finalize_data,
 static bool njsModule_populateGlobals(napi_env env, napi_value module,
         napi_value settings, njsModuleGlobals *globals)
 {
+    uint32_t numWorkerThreads = 0;
     char versionString[40];
     napi_value temp;
 
@@ -173,6 +181,10 @@ static bool njsModule_populateGlobals(napi_env env, napi_value module,
     if (!njsModule_extendClass(env, module, globals, &njsClassDefPool,
             &globals->jsPoolConstructor))
         return false;
+    if (!njsModule_extendClass(env, module, globals,
+            &njsClassDefPreparedStatement,
+            &globals->jsPreparedStatementConstructor))
+        return false;
     if (!njsModule_extendClass(env, module, globals, &njsClassDefResultSet,
             &globals->jsResultSetConstructor))
         return false;
@@ -240,6 +252,20 @@ static bool njsModule_populateGlobals(napi_env env, napi_value module,
     NJS_CHECK_NAPI(env, napi_create_reference(env, temp, 1,
             &globals->jsEncodeVectorFn))
 
+    // create the array used to store the cached JSON field names
+    NJS_CHECK_NAPI(env, napi_create_array_with_length(env,
+            NJS_JSON_KEY_CACHE_SIZE, &temp))
+    NJS_CHECK_NAPI(env, napi_create_reference(env, temp, 1,
+            &globals->jsJsonKeys))
+
+    // create the native worker pool, if requested
+    if (!njsUtils_getNamedPropertyUnsignedInt(env, settings,
+            "nativeWorkerThreads", &numWorkerThreads))
+        return false;
+    if (numWorkerThreads > 0 && !njsWorkerPool_create(env, numWorkerThreads,
+            &globals->workerPool))
+        return false;
+
     // acquire Oracle client version and store this in the settings object
     if (dpiContext_getClientVersion(globals->context, &globals->clientVersionInfo) < 0)
         return njsUtils_throwErrorDPI(env, globals);
@@ -392,6 +418,13 @@ static bool njsModule_initHelper(napi_env env, napi_value exports)
     NJS_CHECK_NAPI(env, napi_set_named_property(env, exports,
             "initOracleClient", fn))
 
+    // define function for decoding rows in Thin mode; this does not require
+    // the Oracle Client library to be initialized
+    NJS_CHECK_NAPI(env, napi_create_function(env, "decodeRows",
+            NAPI_AUTO_LENGTH, njsThinDecode_decodeRows, globals, &fn))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, exports, "decodeRows",
+            fn))
+
     return true;
 }
 
@@ -144,6 +144,38 @@
 // fetchInfo
 #define NJS_MAX_FETCH_AS_STRING_SIZE    200
 
+// max number of digits in an integer that always fits in a 64-bit integer
+#define NJS_MAX_INT64_NUMBER_DIGITS     18
+
+// max number of bytes in the text representation of an Oracle number
+#define NJS_MAX_NUMBER_TEXT_SIZE        172
+
+// number of milliseconds in a day
+#define NJS_MS_PER_DAY                  86400000
+
+// number of entries in each of the tables of the cache of time zone offsets,
+// the maximum distance (in milliseconds) from a value that is searched for a
+// time zone transition when populating an entry and the step (in milliseconds)
+// used during that search; no two transitions are expected within one step
+#define NJS_DATE_CACHE_SIZE             64
+#define NJS_DATE_CACHE_MAX_SEARCH_MS    (366 * (int64_t) NJS_MS_PER_DAY)
+#define NJS_DATE_CACHE_STEP_MS          (7 * (int64_t) NJS_MS_PER_DAY)
+
+// range of the values (in milliseconds since the epoch) of JavaScript dates
+#define NJS_MAX_DATE_MS                 8640000000000000LL
+
+// size of the cache of JSON field names and the maximum length of a name that
+// will be stored in it
+#define NJS_JSON_KEY_CACHE_SIZE         256
+#define NJS_JSON_KEY_CACHE_MAX_LENGTH   64
+
+// number of entries initially allocated in the array of SODA documents
+// being fetched; the array is doubled in size as more documents are fetched
+#define NJS_SODA_DOCS_INITIAL_SIZE      16
+
+// minimum size of each block of memory allocated by an arena
+#define NJS_ARENA_BLOCK_SIZE            32768
+
 // encoding name to use for all strings
 #define NJS_ENCODING                    "UTF-8"
 
@@ -157,6 +189,41 @@
 #define NJS_BIND_INOUT                  3002
 #define NJS_BIND_OUT                    3003
 
+// output formats
+#define NJS_OUT_FORMAT_ARRAY            4001
+#define NJS_OUT_FORMAT_OBJECT           4002
+#define NJS_OUT_FORMAT_COLUMNS          4003
+
+// column array types used with output format NJS_OUT_FORMAT_COLUMNS
+#define NJS_COLUMN_ARRAY_TYPE_ARRAY     0
+#define NJS_COLUMN_ARRAY_TYPE_FLOAT64   1
+#define NJS_COLUMN_ARRAY_TYPE_INT32     2
+#define NJS_COLUMN_ARRAY_TYPE_BIGINT64  3
+#define NJS_COLUMN_ARRAY_TYPE_DATE      4
+#define NJS_COLUMN_ARRAY_TYPE_BOOLEAN   5
+#define NJS_COLUMN_ARRAY_TYPE_VECTOR    6
+
+// kinds of columns decoded by the thin mode row decoder
+#define NJS_THIN_DECODE_NULL            0
+#define NJS_THIN_DECODE_STRING          1
+#define NJS_THIN_DECODE_NSTRING         2
+#define NJS_THIN_DECODE_RAW             3
+#define NJS_THIN_DECODE_NUMBER          4
+#define NJS_THIN_DECODE_DATE_LOCAL      5
+#define NJS_THIN_DECODE_DATE_UTC        6
+#define NJS_THIN_DECODE_BINARY_DOUBLE   7
+#define NJS_THIN_DECODE_BINARY_FLOAT    8
+#define NJS_THIN_DECODE_BOOLEAN         9
+
+// flags for columns decoded by the thin mode row decoder
+#define NJS_THIN_DECODE_FLAG_INDICATORS 0x01
+
+// pipeline operation types
+#define NJS_PIPELINE_OP_SKIP            0
+#define NJS_PIPELINE_OP_COMMIT          1
+#define NJS_PIPELINE_OP_EXECUTE         2
+#define NJS_PIPELINE_OP_EXECUTE_MANY    3
+
 // data types (loosely based on Javascript types)
 #define NJS_DATATYPE_DEFAULT            0
 #define NJS_DATATYPE_STR                DPI_ORACLE_TYPE_VARCHAR
@@ -210,20 +277,29 @@ typedef struct njsAqDeqOptions njsAqDeqOptions;
 typedef struct njsAqEnqOptions njsAqEnqOptions;
 typedef struct njsAqMessage njsAqMessage;
 typedef struct njsAqQueue njsAqQueue;
+typedef struct njsArena njsArena;
+typedef struct njsArenaBlock njsArenaBlock;
 typedef struct njsBaton njsBaton;
 typedef struct njsClassDef njsClassDef;
 typedef struct njsConnection njsConnection;
 typedef struct njsDataTypeInfo njsDataTypeInfo;
+typedef struct njsDateCache njsDateCache;
+typedef struct njsDateCacheEntry njsDateCacheEntry;
+typedef struct njsDateCacheTable njsDateCacheTable;
 typedef struct njsDbObject njsDbObject;
 typedef struct njsDbObjectType njsDbObjectType;
 typedef struct njsDbObjectAttr njsDbObjectAttr;
 typedef struct njsImplicitResult njsImplicitResult;
 typedef struct njsJsonBuffer njsJsonBuffer;
 typedef struct njsJsContext njsJsContext;
+typedef struct njsJsonKeyCache njsJsonKeyCache;
+typedef struct njsJsonKeyCacheEntry njsJsonKeyCacheEntry;
 typedef struct njsLob njsLob;
 typedef struct njsLobBuffer njsLobBuffer;
 typedef struct njsModuleGlobals njsModuleGlobals;
+typedef struct njsPipelineOp njsPipelineOp;
 typedef struct njsPool njsPool;
+typedef struct njsPreparedStatement njsPreparedStatement;
 typedef struct njsResultSet njsResultSet;
 typedef struct njsSodaCollection njsSodaCollection;
 typedef struct njsSodaDatabase njsSodaDatabase;
@@ -234,6 +310,9 @@ typedef struct njsSubscription njsSubscription;
 typedef struct njsTokenCallback njsTokenCallback;
 typedef struct njsVariable njsVariable;
 typedef struct njsVariableBuffer njsVariableBuffer;
+typedef struct njsVectorMatrix njsVectorMatrix;
+typedef struct njsWorkerPool njsWorkerPool;
+typedef struct njsWorkerQueue njsWorkerQueue;
 
 
 //-----------------------------------------------------------------------------
@@ -249,6 +328,7 @@ extern const njsClassDef njsClassDefConnection;
 extern const njsClassDef njsClassDefLob;
 extern const njsClassDef njsClassDefOracleDb;
 extern const njsClassDef njsClassDefPool;
+extern const njsClassDef njsClassDefPreparedStatement;
 extern const njsClassDef njsClassDefResultSet;
 extern const njsClassDef njsClassDefSodaCollection;
 extern const njsClassDef njsClassDefSodaDatabase;
@@ -287,9 +367,32 @@ struct njsAqQueue {
     bool isJson;
 };
 
+// data for an arena; memory is allocated by advancing an offset within a
+// block and is released all at once by resetting or freeing the arena
+struct njsArena {
+    njsArenaBlock *firstBlock;
+    njsArenaBlock *currentBlock;
+};
+
+// header of each block of memory allocated by an arena; the memory handed
+// out by the arena immediately follows the header
+struct njsArenaBlock {
+    njsArenaBlock *next;
+    size_t size;
+    size_t used;
+};
+
 // data for cached napi_values of JS functions to be used across async and
 // sync APIs
 struct njsJsContext {
+    // cache of time zone offsets used when creating dates
+    njsDateCache *dateCache;
+
+    // cache of field names used when creating JSON objects; the JavaScript
+    // strings are stored in the array at the same index as the entry
+    njsJsonKeyCache *jsonKeyCache;
+    napi_value jsJsonKeys;
+
     // constructors and other functions that are called from inside C
     napi_value jsLobConstructor;
     napi_value jsResultSetConstructor;
@@ -400,6 +503,18 @@ struct njsBaton {
     uint32_t numBindVars;
     njsVariable *bindVars;
 
+    // prepared statement being executed, if applicable (reference is held
+    // in jsPreparedStatementRef)
+    njsPreparedStatement *preparedStmt;
+
+    // arena used for encoding JSON bind values (requires free)
+    njsArena jsonArena;
+
+    // pipeline operations (requires free)
+    uint32_t numPipelineOps;
+    njsPipelineOp *pipelineOps;
+    bool continueOnError;
+
     // batch errors (requires free)
     uint32_t numBatchErrorInfos;
     dpiErrorInfo *batchErrorInfos;
@@ -436,9 +551,10 @@ struct njsBaton {
     uint32_t createCollectionMode;
     uint64_t docCount;
     uint32_t lobType;
-    uint32_t lobOffset;
-    uint32_t lobAmount;
-    uint32_t newLobSize;
+    uint32_t numLobs;
+    uint64_t lobOffset;
+    uint64_t lobAmount;
+    uint64_t newLobSize;
     uint32_t timeout;
     uint32_t qos;
     uint32_t operations;
@@ -509,6 +625,7 @@ struct njsBaton {
     napi_ref jsCallingObjRef;
     napi_ref jsSubscriptionRef;
     napi_ref jsExecuteOptionsRef;
+    napi_ref jsPreparedStatementRef;
 
     // njsContext structure for JavaScript methods that are called from
     // inside C
@@ -522,6 +639,10 @@ struct njsBaton {
     bool (*workCallback)(njsBaton*);
     bool (*afterWorkCallback)(njsBaton*, napi_env, napi_value*);
     napi_deferred deferred;
+
+    // native worker pool parameters (queue to use and next baton in queue)
+    njsWorkerQueue *workerQueue;
+    njsBaton *nextWork;
 };
 
 // data for class definitions exposed to JS
@@ -555,9 +676,8 @@ struct njsImplicitResult {
 struct njsJsonBuffer {
     dpiJsonNode topNode;
     dpiDataBuffer topNodeBuffer;
-    uint32_t allocatedBuffers;
-    uint32_t numBuffers;
-    char **buffers;
+    njsArena *arena;
+    njsArena localArena;
 };
 
 // data for class Lob exposed to JS.
@@ -580,7 +700,51 @@ struct njsLobBuffer {
     uint64_t length;
 };
 
+// data for an entry in the cache of time zone offsets; the offset applies to
+// all values in the interval [start, end)
+struct njsDateCacheEntry {
+    int64_t start;
+    int64_t end;
+    int64_t offset;
+    bool isValid;
+};
+
+// data for a table in the cache of time zone offsets; the most recently used
+// entry is checked first and entries are replaced in round robin fashion
+struct njsDateCacheTable {
+    njsDateCacheEntry entries[NJS_DATE_CACHE_SIZE];
+    uint32_t lastIndex;
+    uint32_t nextIndex;
+};
+
+// data for the cache of time zone offsets; local times are converted to UTC
+// using one table and UTC times are converted to local times using the other;
+// the cache is cleared whenever the value of the TZ environment variable
+// changes
+struct njsDateCache {
+    bool isInitialized;
+    char *tzName;
+    njsDateCacheTable localTable;
+    njsDateCacheTable utcTable;
+};
+
+// data for an entry in the cache of JSON field names
+struct njsJsonKeyCacheEntry {
+    uint32_t hash;
+    uint32_t nameLength;
+    char name[NJS_JSON_KEY_CACHE_MAX_LENGTH];
+    bool isValid;
+};
+
+// data for the cache of JSON field names; documents fetched from the same
+// table usually share a small set of field names so each name is only
+// created as a JavaScript string once instead of once per object
+struct njsJsonKeyCache {
+    njsJsonKeyCacheEntry entries[NJS_JSON_KEY_CACHE_SIZE];
+};
+
 // data for module globals
+
 struct njsModuleGlobals {
     dpiContext *context;
     dpiVersionInfo clientVersionInfo;
@@ -593,6 +757,7 @@ struct njsModuleGlobals {
     napi_ref jsConnectionConstructor;
     napi_ref jsLobConstructor;
     napi_ref jsPoolConstructor;
+    napi_ref jsPreparedStatementConstructor;
     napi_ref jsResultSetConstructor;
     napi_ref jsSodaCollectionConstructor;
     napi_ref jsSodaDatabaseConstructor;
@@ -607,6 +772,29 @@ struct njsModuleGlobals {
     napi_ref jsSparseVectorConstructor;
     napi_ref jsIntervalYMConstructor;
     napi_ref jsIntervalDSConstructor;
+    napi_ref jsJsonKeys;
+    njsDateCache dateCache;
+    njsJsonKeyCache jsonKeyCache;
+    njsWorkerPool *workerPool;
+};
+
+// data for a queue of work waiting for a thread in the native worker pool;
+// queues with work are linked together and serviced in turn so that no
+// single queue can occupy all of the threads
+struct njsWorkerQueue {
+    njsBaton *head;
+    njsBaton *tail;
+    njsWorkerQueue *nextReady;
+    uint32_t length;
+    bool isReady;
+};
+
+// data for an operation of a pipeline; each operation uses its own baton to
+// hold its statement, variables, results and errors
+struct njsPipelineOp {
+    uint32_t opType;
+    njsBaton *baton;
+    char warning[NJS_MAX_ERROR_MSG_LEN + 1];
 };
 
 // data for class Pool exposed to JS.
@@ -625,6 +813,15 @@ struct njsPool {
     bool externalAuth;
     njsTokenCallback *accessTokenCallback;
     dpiErrorInfo warningInfo;
+    njsWorkerQueue workerQueue;
+};
+
+// data for class PreparedStatement exposed to JS.
+struct njsPreparedStatement {
+    dpiStmt *handle;
+    dpiStmtInfo stmtInfo;
+    uint32_t numBindVars;
+    njsVariable *bindVars;
 };
 
 // data for class ResultSet exposed to JS.
@@ -634,8 +831,13 @@ struct njsResultSet {
     uint32_t numQueryVars;
     njsVariable *queryVars;
     uint32_t fetchArraySize;
+    uint32_t outFormat;
+    napi_ref jsColumnNames;
+    napi_property_descriptor *rowDescriptors;
     bool isNested;
+    bool isPrepared;
     bool varsDefined;
+    bool fetchVectorsAsMatrix;
 };
 
 // data for class SodaCollection exposed to JS.
@@ -679,6 +881,18 @@ struct njsSubscription {
     bool notifications;
 };
 
+// data for the array buffers shared by the vectors fetched in a batch; the
+// values of each vector (and the indices of sparse vectors) are stored
+// consecutively, aligned to the size of their elements
+struct njsVectorMatrix {
+    napi_value values;
+    napi_value indices;
+    char *valuesPtr;
+    char *indicesPtr;
+    size_t valuesOffset;
+    size_t indicesOffset;
+};
+
 // data for keeping track of variables used for binding/fetching data
 struct njsVariable {
     char *name;
@@ -710,6 +924,8 @@ struct njsVariable {
     uint32_t vectorDimensions;
     uint8_t vectorFormat;
     uint8_t vectorFlags;
+    uint32_t columnArrayType;
+    njsVectorMatrix vectorMatrix;
     njsVariableBuffer *buffer;
     uint32_t numDmlReturningBuffers;
     njsVariableBuffer *dmlReturningBuffers;
@@ -764,6 +980,27 @@ struct njsDbObjectAttr {
 };
 
 
+// data for the native worker pool used instead of the libuv thread pool when
+// oracledb.nativeWorkerThreads is set
+struct njsWorkerPool {
+    uv_mutex_t mutex;
+    uv_cond_t cond;
+    uv_thread_t *threads;
+    uint32_t numThreads;
+    uint32_t numRunningThreads;
+    uint32_t numBusyThreads;
+    uint32_t numPoolBusyThreads;
+    uint32_t maxPoolBusyThreads;
+    uint32_t numQueued;
+    uint32_t numPending;
+    njsWorkerQueue defaultQueue;
+    njsWorkerQueue *readyHead;
+    njsWorkerQueue *readyTail;
+    napi_threadsafe_function completeFn;
+    bool shutdown;
+    bool detached;
+};
+
 // data for managing callback
 struct njsTokenCallback {
     dpiAccessToken *accessToken;
@@ -780,12 +1017,20 @@ struct njsTokenCallback {
 };
 
 
+//-----------------------------------------------------------------------------
+// definition of arena functions
+//-----------------------------------------------------------------------------
+void *njsArena_alloc(njsArena *arena, size_t size);
+void njsArena_free(njsArena *arena);
+void njsArena_reset(njsArena *arena);
+
+
 //-----------------------------------------------------------------------------
 // definition of JSON buffer functions
 //-----------------------------------------------------------------------------
 void njsJsonBuffer_free(njsJsonBuffer *buf);
 bool njsJsonBuffer_fromValue(njsJsonBuffer *buf, napi_env env,
-        napi_value value, njsJsContext *jsContext);
+        napi_value value, njsJsContext *jsContext, njsArena *arena);
 
 
 //-----------------------------------------------------------------------------
@@ -793,9 +1038,12 @@ bool njsJsonBuffer_fromValue(njsJsonBuffer *buf, napi_env env,
 //-----------------------------------------------------------------------------
 bool njsBaton_commonConnectProcessArgs(njsBaton *baton, napi_env env,
         napi_value *args);
+void njsBaton_completeAsync(napi_env env, napi_status ignoreStatus,
+        void *data);
 bool njsBaton_create(njsBaton *baton, napi_env env, napi_callback_info info,
         size_t numArgs, napi_value *args, const njsClassDef *classDef);
 void njsBaton_free(njsBaton *baton, napi_env env);
+bool njsBaton_getErrorInfo(njsBaton *baton, napi_env env, napi_value *error);
 uint32_t njsBaton_getNumOutBinds(njsBaton *baton);
 bool njsBaton_getSodaDocument(njsBaton *baton, njsSodaDatabase *db,
         napi_env env, napi_value obj, dpiSodaDoc **handle);
@@ -810,8 +1058,10 @@ bool njsBaton_setErrorInsufficientBufferForBinds(njsBaton *baton);
 bool njsBaton_setErrorInsufficientMemory(njsBaton *baton);
 bool njsBaton_setErrorDPI(njsBaton *baton);
 bool njsBaton_setJsContext(njsBaton *baton, napi_env env);
+size_t njsBaton_getVectorElementLength(uint8_t format,
+        napi_typedarray_type *type);
 bool njsBaton_getVectorValue(njsBaton *baton, dpiVector *vector,
-        napi_env env, napi_value *value);
+        njsVectorMatrix *matrix, napi_env env, napi_value *value);
 bool njsBaton_setErrorUnsupportedVectorFormat(njsBaton *baton,
         uint8_t format);
 
@@ -871,6 +1121,15 @@ bool njsLob_new(njsModuleGlobals *globals, njsLobBuffer *buffer, napi_env env,
         napi_value parentObj, napi_value *lobObj);
 
 
+//-----------------------------------------------------------------------------
+// definition of functions for njsPreparedStatement class
+//-----------------------------------------------------------------------------
+bool njsPreparedStatement_newFromBaton(njsBaton *baton, napi_env env,
+        napi_value *stmtObj);
+void njsPreparedStatement_retainBindVars(njsPreparedStatement *stmt,
+        njsBaton *baton);
+
+
 //-----------------------------------------------------------------------------
 // definition of functions for njsResultSet class
 //-----------------------------------------------------------------------------
@@ -926,6 +1185,12 @@ bool njsSubscription_startNotifications(njsSubscription *subscr,
 bool njsSubscription_stopNotifications(njsSubscription *subscr);
 
 
+//-----------------------------------------------------------------------------
+// definition of thin mode row decoding functions
+//-----------------------------------------------------------------------------
+napi_value njsThinDecode_decodeRows(napi_env env, napi_callback_info info);
+
+
 //-----------------------------------------------------------------------------
 // definition of utility functions
 //-----------------------------------------------------------------------------
@@ -941,12 +1206,18 @@ bool njsUtils_copyStringFromJS(napi_env env, napi_value value, char **result,
 bool njsUtils_createBaton(napi_env env, napi_callback_info info,
         size_t numArgs, napi_value *args, const njsClassDef *classDef,
         njsBaton **baton);
+bool njsUtils_createExternalBuffer(napi_env env, char **data, size_t length,
+        napi_value *result);
 bool njsUtils_genericNew(napi_env env, const njsClassDef *classDef,
         napi_ref constructorRef, napi_value *instanceObj, void **instance);
 bool njsUtils_genericThrowError(napi_env env, const char *fileName,
         int lineNum);
+bool njsUtils_getDateMs(uint32_t varTypeNum, napi_env env,
+        njsDateCache *cache, napi_value makeDateFn, dpiTimestamp *timestamp,
+        double *value);
 bool njsUtils_getDateValue(uint32_t varTypeNum, napi_env env,
-        napi_value makeDateFn, dpiTimestamp *timestamp, napi_value *value);
+        njsDateCache *cache, napi_value makeDateFn, dpiTimestamp *timestamp,
+        napi_value *value);
 bool njsUtils_getError(napi_env env, dpiErrorInfo *errorInfo,
         const char *buffer, napi_value *error);
 bool njsUtils_getNamedProperty(napi_env env, napi_value value,
@@ -961,6 +1232,8 @@ bool njsUtils_getNamedPropertyShardingKey(napi_env env, napi_value value,
 bool njsUtils_getNamedPropertyAppContext(napi_env env, napi_value value,
         const char *name, uint32_t *numAppContextEntries,
         dpiAppContext **appContextEntries);
+bool njsUtils_parseNumber(const char *text, uint32_t textLength,
+        double *value);
 bool njsUtils_parseKeyValueEntries(napi_env env, napi_value value,
         const char *namespaceName, uint32_t namespaceNameLength,
         uint32_t *numEntries, dpiAppContext **entries);
@@ -975,7 +1248,8 @@ bool njsUtils_getNamedPropertyUnsignedInt(napi_env env, napi_value value,
         const char *name, uint32_t *outValue);
 bool njsUtils_getXid(napi_env env, napi_value xidObj, dpiXid **xid);
 bool njsUtils_setDateValue(uint32_t varTypeNum, napi_env env, napi_value value,
-        napi_value getComponentsFn, dpiTimestamp *timestamp);
+        njsDateCache *cache, napi_value getComponentsFn,
+        dpiTimestamp *timestamp);
 bool njsUtils_throwErrorDPI(napi_env env, njsModuleGlobals *globals);
 bool njsUtils_throwInsufficientMemory(napi_env env);
 bool njsUtils_throwUnsupportedDataType(napi_env env, uint32_t oracleTypeNum,
@@ -1017,8 +1291,13 @@ bool njsVariable_process(njsVariable *vars, uint32_t numVars, uint32_t numRows,
         njsBaton *baton);
 bool njsVariable_processJS(njsVariable *vars, uint32_t numVars, napi_env env,
         njsBaton *baton);
+bool njsVariable_setColumnValues(njsVariable *var, napi_env env,
+        napi_value values, napi_value nulls, njsBaton *baton);
 bool njsVariable_setScalarValue(njsVariable *var, uint32_t pos, napi_env env,
         napi_value value, njsBaton *baton);
+bool njsVariable_setVectorColumnValues(njsVariable *var, napi_env env,
+        napi_value values, napi_value nulls, uint32_t numDimensions,
+        njsBaton *baton);
 
 
 //-----------------------------------------------------------------------------
@@ -1034,4 +1313,16 @@ bool njsTokenCallback_startNotifications(njsTokenCallback *callback,
 bool njsTokenCallback_returnAccessToken(njsTokenCallback *callback,
         napi_env env, napi_value accessToken);
 bool njsTokenCallback_stopNotifications(njsTokenCallback *callback);
+
+
+//-----------------------------------------------------------------------------
+// definition of functions for njsWorkerPool class
+//-----------------------------------------------------------------------------
+bool njsWorkerPool_create(napi_env env, uint32_t numThreads,
+        njsWorkerPool **pool);
+void njsWorkerPool_free(njsWorkerPool *pool);
+bool njsWorkerPool_getStatistics(njsWorkerPool *pool, napi_env env,
+        njsWorkerQueue *queue, napi_value *stats);
+bool njsWorkerPool_queueWork(njsWorkerPool *pool, napi_env env,
+        njsBaton *baton);
 #endif                                               /* __NJSMODULE_H__ */
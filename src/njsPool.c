@@ -48,6 +48,7 @@ NJS_NAPI_METHOD_DECL_SYNC(njsPool_getPoolTimeout);
 NJS_NAPI_METHOD_DECL_SYNC(njsPool_getMaxLifetimeSession);
 NJS_NAPI_METHOD_DECL_SYNC(njsPool_getStmtCacheSize);
 NJS_NAPI_METHOD_DECL_SYNC(njsPool_getSodaMetaDataCache);
+NJS_NAPI_METHOD_DECL_SYNC(njsPool_getWorkerStatistics);
 NJS_NAPI_METHOD_DECL_ASYNC(njsPool_reconfigure);
 NJS_NAPI_METHOD_DECL_SYNC(njsPool_returnAccessToken);
 NJS_NAPI_METHOD_DECL_ASYNC(njsPool_setAccessToken);
@@ -97,6 +98,8 @@ static const napi_property_descriptor njsClassProperties[] = {
             napi_default, NULL },
     { "getSodaMetaDataCache", NULL, njsPool_getSodaMetaDataCache, NULL, NULL,
             NULL, napi_default, NULL },
+    { "getWorkerStatistics", NULL, njsPool_getWorkerStatistics, NULL, NULL,
+            NULL, napi_default, NULL },
     { "reconfigure", NULL, njsPool_reconfigure, NULL, NULL, NULL,
             napi_default, NULL },
     { "returnAccessToken", NULL, njsPool_returnAccessToken, NULL, NULL, NULL,
@@ -411,6 +414,11 @@ NJS_NAPI_METHOD_IMPL_ASYNC(njsPool_getConnection, 1, NULL)
             &baton->numSuperShardingKeyColumns,
             &baton->superShardingKeyColumns))
         return false;
+
+    // connections are acquired using the queue belonging to the pool so that
+    // waiting for a connection does not occupy all of the native worker
+    // threads
+    baton->workerQueue = &((njsPool*) baton->callingInstance)->workerQueue;
     return njsBaton_queueWork(baton, env, "GetConnection",
             njsPool_getConnectionAsync, njsPool_getConnectionPostAsync,
             returnValue);
@@ -808,6 +816,23 @@ NJS_NAPI_METHOD_IMPL_SYNC(njsPool_getStmtCacheSize, 0, NULL)
 }
 
 
+//-----------------------------------------------------------------------------
+// njsPool_getWorkerStatistics()
+//   Returns the statistics of the native worker pool, including the number of
+// requests of this pool that are waiting for a thread. Nothing is returned if
+// the native worker pool is not being used.
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_SYNC(njsPool_getWorkerStatistics, 0, NULL)
+{
+    njsPool *pool = (njsPool*) callingInstance;
+
+    if (!globals->workerPool)
+        return true;
+    return njsWorkerPool_getStatistics(globals->workerPool, env,
+            &pool->workerQueue, returnValue);
+}
+
+
 //-----------------------------------------------------------------------------
 // njsPool_returnAccessToken()
 //   Returns the access token through to the callback. This needs to be done
@@ -0,0 +1,194 @@
+// Copyright (c) 2026, Oracle and/or its affiliates.
+
+//-----------------------------------------------------------------------------
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// NAME
+//   njsPreparedStatement.c
+//
+// DESCRIPTION
+//   PreparedStatement class implementation.
+//
+//-----------------------------------------------------------------------------
+
+#include "njsModule.h"
+
+// class methods
+NJS_NAPI_METHOD_DECL_ASYNC(njsPreparedStatement_close);
+
+// asynchronous methods
+static NJS_ASYNC_METHOD(njsPreparedStatement_closeAsync);
+
+// finalize
+static NJS_NAPI_FINALIZE(njsPreparedStatement_finalize);
+
+// properties defined by the class
+static const napi_property_descriptor njsClassProperties[] = {
+    { "close", NULL, njsPreparedStatement_close, NULL, NULL, NULL,
+            napi_default, NULL },
+    { NULL, NULL, NULL, NULL, NULL, NULL, napi_default, NULL }
+};
+
+// class definition
+const njsClassDef njsClassDefPreparedStatement = {
+    "PreparedStatementImpl", sizeof(njsPreparedStatement),
+    njsPreparedStatement_finalize, njsClassProperties, false
+};
+
+// other methods used internally
+static void njsPreparedStatement_freeBindVars(njsPreparedStatement *stmt);
+
+
+//-----------------------------------------------------------------------------
+// njsPreparedStatement_close()
+//   Close the prepared statement. The bind variables retained by the
+// statement are transferred to the baton so that they are freed once the
+// close has completed.
+//
+// PARAMETERS - NONE
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsPreparedStatement_close, 0, NULL)
+{
+    njsPreparedStatement *stmt =
+            (njsPreparedStatement*) baton->callingInstance;
+
+    baton->dpiStmtHandle = stmt->handle;
+    stmt->handle = NULL;
+    baton->bindVars = stmt->bindVars;
+    baton->numBindVars = stmt->numBindVars;
+    stmt->bindVars = NULL;
+    stmt->numBindVars = 0;
+    return njsBaton_queueWork(baton, env, "Close",
+            njsPreparedStatement_closeAsync, NULL, returnValue);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsPreparedStatement_closeAsync()
+//   Worker function for njsPreparedStatement_close().
+//-----------------------------------------------------------------------------
+static bool njsPreparedStatement_closeAsync(njsBaton *baton)
+{
+    njsPreparedStatement *stmt =
+            (njsPreparedStatement*) baton->callingInstance;
+
+    if (dpiStmt_close(baton->dpiStmtHandle, NULL, 0) < 0) {
+        njsBaton_setErrorDPI(baton);
+        stmt->handle = baton->dpiStmtHandle;
+        baton->dpiStmtHandle = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsPreparedStatement_finalize()
+//   Invoked when the njsPreparedStatement object is garbage collected.
+//-----------------------------------------------------------------------------
+static void njsPreparedStatement_finalize(napi_env env, void *finalizeData,
+        void *finalizeHint)
+{
+    njsPreparedStatement *stmt = (njsPreparedStatement*) finalizeData;
+
+    njsPreparedStatement_freeBindVars(stmt);
+    if (stmt->handle) {
+        dpiStmt_release(stmt->handle);
+        stmt->handle = NULL;
+    }
+    free(stmt);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsPreparedStatement_freeBindVars()
+//   Frees the bind variables retained by the prepared statement.
+//-----------------------------------------------------------------------------
+static void njsPreparedStatement_freeBindVars(njsPreparedStatement *stmt)
+{
+    uint32_t i;
+
+    if (stmt->bindVars) {
+        for (i = 0; i < stmt->numBindVars; i++)
+            njsVariable_free(&stmt->bindVars[i]);
+        free(stmt->bindVars);
+        stmt->bindVars = NULL;
+    }
+    stmt->numBindVars = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsPreparedStatement_newFromBaton()
+//   Called when a prepared statement is being created from the baton. It is
+// assumed that the calling instance is a connection.
+//-----------------------------------------------------------------------------
+bool njsPreparedStatement_newFromBaton(njsBaton *baton, napi_env env,
+        napi_value *stmtObj)
+{
+    napi_value fn, temp, args[2];
+    njsPreparedStatement *stmt;
+
+    // create new instance
+    if (!njsUtils_genericNew(env, &njsClassDefPreparedStatement,
+            baton->globals->jsPreparedStatementConstructor, stmtObj,
+            (void**) &stmt))
+        return false;
+
+    // perform some initializations
+    stmt->handle = baton->dpiStmtHandle;
+    baton->dpiStmtHandle = NULL;
+    memcpy(&stmt->stmtInfo, &baton->stmtInfo, sizeof(dpiStmtInfo));
+
+    // setup the prepared statement (calls into JavaScript); a reference to
+    // the connection is retained in order to serialize execution
+    NJS_CHECK_NAPI(env, napi_get_reference_value(env, baton->jsCallingObjRef,
+            &args[0]))
+    NJS_CHECK_NAPI(env, napi_create_string_utf8(env, baton->sql,
+            baton->sqlLength, &args[1]))
+    NJS_CHECK_NAPI(env, napi_get_named_property(env, *stmtObj, "_setup", &fn))
+    NJS_CHECK_NAPI(env, napi_call_function(env, *stmtObj, fn, 2, args, &temp))
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsPreparedStatement_retainBindVars()
+//   Called when the baton used to execute the prepared statement is freed.
+// The bind variables are transferred from the baton to the prepared statement
+// (replacing any that were retained previously) so that they can be reused by
+// the next execution. If the statement has since been closed, the variables
+// are left with the baton to be freed.
+//-----------------------------------------------------------------------------
+void njsPreparedStatement_retainBindVars(njsPreparedStatement *stmt,
+        njsBaton *baton)
+{
+    if (!stmt->handle)
+        return;
+    njsPreparedStatement_freeBindVars(stmt);
+    stmt->bindVars = baton->bindVars;
+    stmt->numBindVars = baton->numBindVars;
+    baton->bindVars = NULL;
+    baton->numBindVars = 0;
+}
@@ -62,8 +62,18 @@ const njsClassDef njsClassDefResultSet = {
 };
 
 // other methods used internally
+static bool njsResultSet_getColumn(njsResultSet *rs, njsVariable *var,
+        njsBaton *baton, napi_env env, napi_value *column);
+static bool njsResultSet_getColumns(njsResultSet *rs, njsBaton *baton,
+        napi_env env, napi_value *result);
+static bool njsResultSet_getObjectRows(njsResultSet *rs, njsBaton *baton,
+        napi_env env, napi_value *result);
+static bool njsResultSet_initVectorMatrices(njsResultSet *rs,
+        njsBaton *baton, napi_env env);
 static bool njsResultSet_setFetchTypes(napi_env env, njsResultSet *rs,
         napi_value allMetadata);
+static bool njsResultSet_setOutFormat(napi_env env, njsResultSet *rs,
+        napi_value rsObj, napi_value allMetadata);
 
 //-----------------------------------------------------------------------------
 // njsResultSet_close()
@@ -90,7 +100,9 @@ static bool njsResultSet_closeAsync(njsBaton *baton)
 {
     njsResultSet *rs = (njsResultSet*) baton->callingInstance;
 
-    if (dpiStmt_close(baton->dpiStmtHandle, NULL, 0) < 0) {
+    // the statement of a prepared statement remains open until the prepared
+    // statement itself is closed; the reference is released by the baton
+    if (!rs->isPrepared && dpiStmt_close(baton->dpiStmtHandle, NULL, 0) < 0) {
         njsBaton_setErrorDPI(baton);
         rs->handle = baton->dpiStmtHandle;
         baton->dpiStmtHandle = NULL;
@@ -131,10 +143,227 @@ static void njsResultSet_finalize(napi_env env, void *finalizeData,
         rs->queryVars = NULL;
         rs->numQueryVars = 0;
     }
+    NJS_DELETE_REF_AND_CLEAR(rs->jsColumnNames);
+    NJS_FREE_AND_CLEAR(rs->rowDescriptors);
     free(rs);
 }
 
 
+//-----------------------------------------------------------------------------
+// njsResultSet_getColumn()
+//   Returns the values fetched for a single column as an object containing
+// the values and a bitmap identifying which of the values are null. Numeric,
+// date and boolean values are written directly into the memory of a typed
+// array; all other values are stored in a regular JavaScript array.
+//-----------------------------------------------------------------------------
+static bool njsResultSet_getColumn(njsResultSet *rs, njsVariable *var,
+        njsBaton *baton, napi_env env, napi_value *column)
+{
+    uint32_t row, numRows = baton->rowsFetched, numNullBytes;
+    napi_value values, nulls, buffer, temp;
+    napi_typedarray_type arrayType;
+    size_t elementSize = 0;
+    void *valuesPtr = NULL;
+    uint8_t *nullsPtr;
+    dpiBytes *bytes;
+    dpiData *data;
+
+    // determine the type of array to use
+    switch (var->columnArrayType) {
+        case NJS_COLUMN_ARRAY_TYPE_FLOAT64:
+        case NJS_COLUMN_ARRAY_TYPE_DATE:
+            arrayType = napi_float64_array;
+            elementSize = sizeof(double);
+            break;
+        case NJS_COLUMN_ARRAY_TYPE_INT32:
+            arrayType = napi_int32_array;
+            elementSize = sizeof(int32_t);
+            break;
+        case NJS_COLUMN_ARRAY_TYPE_BIGINT64:
+            arrayType = napi_bigint64_array;
+            elementSize = sizeof(int64_t);
+            break;
+        case NJS_COLUMN_ARRAY_TYPE_BOOLEAN:
+            arrayType = napi_uint8_array;
+            elementSize = sizeof(uint8_t);
+            break;
+        default:
+            arrayType = napi_uint8_array;
+            break;
+    }
+
+    // create the null bitmap; array buffers are zero-initialized
+    numNullBytes = (numRows + 7) / 8;
+    NJS_CHECK_NAPI(env, napi_create_arraybuffer(env, numNullBytes,
+            (void**) &nullsPtr, &buffer))
+    NJS_CHECK_NAPI(env, napi_create_typedarray(env, napi_uint8_array,
+            numNullBytes, buffer, 0, &nulls))
+
+    // create the array for the values
+    if (elementSize > 0) {
+        NJS_CHECK_NAPI(env, napi_create_arraybuffer(env,
+                numRows * elementSize, &valuesPtr, &buffer))
+        NJS_CHECK_NAPI(env, napi_create_typedarray(env, arrayType, numRows,
+                buffer, 0, &values))
+    } else {
+        NJS_CHECK_NAPI(env, napi_create_array_with_length(env, numRows,
+                &values))
+    }
+
+    // process each row
+    for (row = 0; row < numRows; row++) {
+        data = &var->buffer->dpiVarData[baton->bufferRowIndex + row];
+        if (data->isNull)
+            nullsPtr[row / 8] |= (uint8_t) (1 << (row % 8));
+
+        // values that are not stored in typed arrays are acquired in the same
+        // way as rows are
+        if (elementSize == 0) {
+            if (!njsVariable_getScalarValue(var, rs->conn, var->buffer, row,
+                    baton, env, &temp))
+                return false;
+            NJS_CHECK_NAPI(env, napi_set_element(env, values, row, temp))
+            continue;
+        }
+
+        // null values in typed arrays are left as zero
+        if (data->isNull)
+            continue;
+
+        switch (var->columnArrayType) {
+            case NJS_COLUMN_ARRAY_TYPE_FLOAT64:
+                if (var->nativeTypeNum == DPI_NATIVE_TYPE_DOUBLE) {
+                    ((double*) valuesPtr)[row] = data->value.asDouble;
+                } else if (var->nativeTypeNum == DPI_NATIVE_TYPE_FLOAT) {
+                    ((double*) valuesPtr)[row] = data->value.asFloat;
+                } else if (var->nativeTypeNum == DPI_NATIVE_TYPE_INT64) {
+                    ((double*) valuesPtr)[row] =
+                            (double) data->value.asInt64;
+                } else {
+                    bytes = &data->value.asBytes;
+                    if (njsUtils_parseNumber(bytes->ptr, bytes->length,
+                            &((double*) valuesPtr)[row]))
+                        break;
+                    NJS_CHECK_NAPI(env, napi_create_string_utf8(env,
+                            bytes->ptr, bytes->length, &temp))
+                    NJS_CHECK_NAPI(env, napi_coerce_to_number(env, temp,
+                            &temp))
+                    NJS_CHECK_NAPI(env, napi_get_value_double(env, temp,
+                            &((double*) valuesPtr)[row]))
+                }
+                break;
+            case NJS_COLUMN_ARRAY_TYPE_INT32:
+                ((int32_t*) valuesPtr)[row] = (int32_t) data->value.asInt64;
+                break;
+            case NJS_COLUMN_ARRAY_TYPE_BIGINT64:
+                ((int64_t*) valuesPtr)[row] = data->value.asInt64;
+                break;
+            case NJS_COLUMN_ARRAY_TYPE_DATE:
+                if (!njsUtils_getDateMs(var->varTypeNum, env,
+                        baton->jsContext.dateCache,
+                        baton->jsContext.jsMakeDateFn,
+                        &data->value.asTimestamp,
+                        &((double*) valuesPtr)[row]))
+                    return false;
+                break;
+            case NJS_COLUMN_ARRAY_TYPE_BOOLEAN:
+                ((uint8_t*) valuesPtr)[row] = (data->value.asBoolean) ? 1 : 0;
+                break;
+        }
+
+    }
+
+    // create the column object
+    NJS_CHECK_NAPI(env, napi_create_object(env, column))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, *column, "values",
+            values))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, *column, "nulls", nulls))
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsResultSet_getColumns()
+//   Returns the rows fetched in column format, as an object containing the
+// number of rows fetched and an array of columns.
+//-----------------------------------------------------------------------------
+static bool njsResultSet_getColumns(njsResultSet *rs, njsBaton *baton,
+        napi_env env, napi_value *result)
+{
+    napi_value columns, column, temp;
+    uint32_t col;
+
+    NJS_CHECK_NAPI(env, napi_create_array_with_length(env, rs->numQueryVars,
+            &columns))
+    for (col = 0; col < rs->numQueryVars; col++) {
+        if (!njsResultSet_getColumn(rs, &rs->queryVars[col], baton, env,
+                &column))
+            return false;
+        NJS_CHECK_NAPI(env, napi_set_element(env, columns, col, column))
+    }
+    NJS_CHECK_NAPI(env, napi_create_object(env, result))
+    NJS_CHECK_NAPI(env, napi_create_uint32(env, baton->rowsFetched, &temp))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, *result, "numRows",
+            temp))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, *result, "columns",
+            columns))
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsResultSet_getObjectRows()
+//   Returns the rows fetched as JavaScript objects. The property keys for the
+// columns are created once when the result set is created and all of the
+// properties of each row are defined at the same time and in the same order,
+// so that all rows share the same shape.
+//-----------------------------------------------------------------------------
+static bool njsResultSet_getObjectRows(njsResultSet *rs, njsBaton *baton,
+        napi_env env, napi_value *result)
+{
+    napi_property_descriptor *descriptor;
+    napi_value names, rowObj;
+    uint32_t row, col;
+    njsVariable *var;
+
+    // acquire the property keys for each of the columns
+    NJS_CHECK_NAPI(env, napi_get_reference_value(env, rs->jsColumnNames,
+            &names))
+    for (col = 0; col < rs->numQueryVars; col++) {
+        NJS_CHECK_NAPI(env, napi_get_element(env, names, col,
+                &rs->rowDescriptors[col].name))
+    }
+
+    // create array
+    NJS_CHECK_NAPI(env, napi_create_array_with_length(env, baton->rowsFetched,
+            result))
+
+    // process each row
+    for (row = 0; row < baton->rowsFetched; row++) {
+
+        // acquire the value of each column
+        for (col = 0; col < rs->numQueryVars; col++) {
+            var = &rs->queryVars[col];
+            descriptor = &rs->rowDescriptors[col];
+            if (!njsVariable_getScalarValue(var, rs->conn, var->buffer, row,
+                    baton, env, &descriptor->value))
+                return false;
+        }
+
+        // create row
+        NJS_CHECK_NAPI(env, napi_create_object(env, &rowObj))
+        NJS_CHECK_NAPI(env, napi_define_properties(env, rowObj,
+                rs->numQueryVars, rs->rowDescriptors))
+        NJS_CHECK_NAPI(env, napi_set_element(env, *result, row, rowObj))
+
+    }
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsResultSet_getRows()
 //   Get a number of rows from the result set.
@@ -220,27 +449,50 @@ static bool njsResultSet_getRowsPostAsync(njsBaton *baton, napi_env env,
     if (!njsBaton_setJsContext(baton, env))
         return false;
 
-    // create array
-    NJS_CHECK_NAPI(env, napi_create_array_with_length(env, baton->rowsFetched,
-            result))
+    // if vectors are being fetched as a matrix, allocate the shared buffers
+    if (rs->fetchVectorsAsMatrix &&
+            !njsResultSet_initVectorMatrices(rs, baton, env))
+        return false;
 
-    // process each row
-    for (row = 0; row < baton->rowsFetched; row++) {
+    // if columns are desired, return them instead of rows
+    if (rs->outFormat == NJS_OUT_FORMAT_COLUMNS) {
+        if (!njsResultSet_getColumns(rs, baton, env, result))
+            return false;
 
-        // create row
+    // if objects are desired, create them directly
+    } else if (rs->outFormat == NJS_OUT_FORMAT_OBJECT) {
+        if (!njsResultSet_getObjectRows(rs, baton, env, result))
+            return false;
+
+    // otherwise, create array and process each row
+    } else {
         NJS_CHECK_NAPI(env, napi_create_array_with_length(env,
-                rs->numQueryVars, &rowObj))
+                baton->rowsFetched, result))
+        for (row = 0; row < baton->rowsFetched; row++) {
+
+            // create row
+            NJS_CHECK_NAPI(env, napi_create_array_with_length(env,
+                    rs->numQueryVars, &rowObj))
+
+            // process each column
+            for (col = 0; col < rs->numQueryVars; col++) {
+                var = &rs->queryVars[col];
+                if (!njsVariable_getScalarValue(var, rs->conn, var->buffer,
+                        row, baton, env, &colObj))
+                    return false;
+                NJS_CHECK_NAPI(env, napi_set_element(env, rowObj, col,
+                        colObj))
+            }
+            NJS_CHECK_NAPI(env, napi_set_element(env, *result, row, rowObj))
 
-        // process each column
-        for (col = 0; col < rs->numQueryVars; col++) {
-            var = &rs->queryVars[col];
-            if (!njsVariable_getScalarValue(var, rs->conn, var->buffer, row,
-                    baton, env, &colObj))
-                return false;
-            NJS_CHECK_NAPI(env, napi_set_element(env, rowObj, col, colObj))
         }
-        NJS_CHECK_NAPI(env, napi_set_element(env, *result, row, rowObj))
+    }
 
+    // the shared vector buffers are only used for a single batch of rows
+    if (rs->fetchVectorsAsMatrix) {
+        for (i = 0; i < rs->numQueryVars; i++)
+            memset(&rs->queryVars[i].vectorMatrix, 0,
+                    sizeof(njsVectorMatrix));
     }
 
     // clear variables if result set was closed
@@ -256,6 +508,71 @@ static bool njsResultSet_getRowsPostAsync(njsBaton *baton, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsResultSet_initVectorMatrices()
+//   Creates the array buffers shared by all of the vectors fetched in a batch
+// of rows for each vector column. The values of dense and sparse vectors are
+// placed consecutively in one buffer (aligned to the element size) and the
+// indices of sparse vectors in another, so that each vector returned to JS is
+// a view of one of these buffers instead of owning its own memory.
+//-----------------------------------------------------------------------------
+static bool njsResultSet_initVectorMatrices(njsResultSet *rs,
+        njsBaton *baton, napi_env env)
+{
+    size_t valuesLength, indicesLength, elementLength, numElem;
+    napi_typedarray_type arrayType;
+    dpiVectorInfo vectorInfo;
+    njsVectorMatrix *matrix;
+    uint32_t row, col;
+    njsVariable *var;
+    dpiData *data;
+
+    for (col = 0; col < rs->numQueryVars; col++) {
+        var = &rs->queryVars[col];
+        matrix = &var->vectorMatrix;
+        memset(matrix, 0, sizeof(njsVectorMatrix));
+        if (var->varTypeNum != DPI_ORACLE_TYPE_VECTOR)
+            continue;
+
+        // determine the size of the buffers required
+        valuesLength = indicesLength = 0;
+        for (row = 0; row < baton->rowsFetched; row++) {
+            data = &var->buffer->dpiVarData[baton->bufferRowIndex + row];
+            if (data->isNull)
+                continue;
+            if (dpiVector_getValue(data->value.asVector, &vectorInfo) < 0)
+                return njsBaton_setErrorDPI(baton);
+            elementLength = njsBaton_getVectorElementLength(vectorInfo.format,
+                    &arrayType);
+            if (elementLength == 0)
+                continue;
+            numElem = (vectorInfo.isSparse) ? vectorInfo.numSparseValues :
+                    vectorInfo.numDimensions;
+            if (vectorInfo.format == DPI_VECTOR_FORMAT_BINARY)
+                numElem = numElem / 8;
+            valuesLength = (valuesLength + elementLength - 1) /
+                    elementLength * elementLength + numElem * elementLength;
+            if (vectorInfo.isSparse)
+                indicesLength += numElem * sizeof(uint32_t);
+        }
+
+        // create the buffers; the vectors are copied into them as each row
+        // is processed
+        if (valuesLength > 0) {
+            NJS_CHECK_NAPI(env, napi_create_arraybuffer(env, valuesLength,
+                    (void**) &matrix->valuesPtr, &matrix->values))
+        }
+        if (indicesLength > 0) {
+            NJS_CHECK_NAPI(env, napi_create_arraybuffer(env, indicesLength,
+                    (void**) &matrix->indicesPtr, &matrix->indices))
+        }
+
+    }
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsResultSet_new()
 //   Creates a new ResultSet object given the handle and variables that have
@@ -289,11 +606,22 @@ bool njsResultSet_new(njsBaton *baton, napi_env env, njsConnection *conn,
     rs->queryVars = vars;
     rs->fetchArraySize = baton->fetchArraySize;
     rs->isNested = (baton->callingInstance != (void*) conn);
+    rs->isPrepared = (baton->preparedStmt &&
+            baton->preparedStmt->handle == handle);
 
     // set fetch types
     if (!njsResultSet_setFetchTypes(env, rs, args[1]))
         return false;
 
+    // set output format
+    if (!njsResultSet_setOutFormat(env, rs, *rsObj, args[1]))
+        return false;
+
+    // determine if vectors are fetched into shared buffers
+    if (!njsUtils_getNamedPropertyBool(env, *rsObj, "fetchVectorsAsMatrix",
+            &rs->fetchVectorsAsMatrix))
+        return false;
+
     return true;
 }
 
@@ -377,3 +705,61 @@ static bool njsResultSet_setFetchTypes(napi_env env, njsResultSet *rs,
 
     return true;
 }
+
+
+//-----------------------------------------------------------------------------
+// njsResultSet_setOutFormat()
+//   Sets the output format determined when the result set was setup. If rows
+// are being returned as objects, the unique column names determined by the
+// setup are retained as property keys so they are only created once. If rows
+// are being returned in column format, the type of array to use for each
+// column is retained instead.
+//-----------------------------------------------------------------------------
+static bool njsResultSet_setOutFormat(napi_env env, njsResultSet *rs,
+        napi_value rsObj, napi_value allMetadata)
+{
+    napi_value arrayTypes, metadata, names, temp;
+    njsVariable *var;
+    uint32_t i;
+
+    rs->outFormat = NJS_OUT_FORMAT_ARRAY;
+    if (!njsUtils_getNamedPropertyUnsignedInt(env, rsObj, "outFormat",
+            &rs->outFormat))
+        return false;
+
+    // retain the column names used as property keys for object rows
+    if (rs->outFormat == NJS_OUT_FORMAT_OBJECT) {
+        rs->rowDescriptors = calloc(rs->numQueryVars,
+                sizeof(napi_property_descriptor));
+        if (!rs->rowDescriptors)
+            return njsUtils_throwInsufficientMemory(env);
+        NJS_CHECK_NAPI(env, napi_create_array_with_length(env,
+                rs->numQueryVars, &names))
+        for (i = 0; i < rs->numQueryVars; i++) {
+            NJS_CHECK_NAPI(env, napi_get_element(env, allMetadata, i,
+                    &metadata))
+            NJS_CHECK_NAPI(env, napi_get_named_property(env, metadata, "name",
+                    &temp))
+            NJS_CHECK_NAPI(env, napi_set_element(env, names, i, temp))
+            rs->rowDescriptors[i].attributes = napi_writable |
+                    napi_enumerable | napi_configurable;
+        }
+        NJS_CHECK_NAPI(env, napi_create_reference(env, names, 1,
+                &rs->jsColumnNames))
+        return true;
+    }
+
+    if (rs->outFormat != NJS_OUT_FORMAT_COLUMNS)
+        return true;
+
+    NJS_CHECK_NAPI(env, napi_get_named_property(env, rsObj,
+            "columnArrayTypes", &arrayTypes))
+    for (i = 0; i < rs->numQueryVars; i++) {
+        var = &rs->queryVars[i];
+        NJS_CHECK_NAPI(env, napi_get_element(env, arrayTypes, i, &temp))
+        NJS_CHECK_NAPI(env, napi_get_value_uint32(env, temp,
+                &var->columnArrayType))
+    }
+
+    return true;
+}
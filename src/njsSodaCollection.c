@@ -47,6 +47,8 @@ NJS_NAPI_METHOD_DECL_ASYNC(njsSodaCollection_insertOneAndGet);
 NJS_NAPI_METHOD_DECL_ASYNC(njsSodaCollection_listIndexes);
 NJS_NAPI_METHOD_DECL_ASYNC(njsSodaCollection_save);
 NJS_NAPI_METHOD_DECL_ASYNC(njsSodaCollection_saveAndGet);
+NJS_NAPI_METHOD_DECL_ASYNC(njsSodaCollection_saveMany);
+NJS_NAPI_METHOD_DECL_ASYNC(njsSodaCollection_saveManyAndGet);
 NJS_NAPI_METHOD_DECL_ASYNC(njsSodaCollection_truncate);
 
 // asynchronous methods
@@ -61,6 +63,8 @@ static NJS_ASYNC_METHOD(njsSodaCollection_insertOneAndGetAsync);
 static NJS_ASYNC_METHOD(njsSodaCollection_listIndexesAsync);
 static NJS_ASYNC_METHOD(njsSodaCollection_saveAsync);
 static NJS_ASYNC_METHOD(njsSodaCollection_saveAndGetAsync);
+static NJS_ASYNC_METHOD(njsSodaCollection_saveManyAsync);
+static NJS_ASYNC_METHOD(njsSodaCollection_saveManyAndGetAsync);
 static NJS_ASYNC_METHOD(njsSodaCollection_truncateAsync);
 
 // post asynchronous methods
@@ -108,6 +112,10 @@ static const napi_property_descriptor njsClassProperties[] = {
             NULL },
     { "saveAndGet", NULL, njsSodaCollection_saveAndGet, NULL, NULL, NULL,
             napi_default, NULL },
+    { "saveMany", NULL, njsSodaCollection_saveMany, NULL, NULL, NULL,
+            napi_default, NULL },
+    { "saveManyAndGet", NULL, njsSodaCollection_saveManyAndGet, NULL, NULL,
+            NULL, napi_default, NULL },
     { "truncate", NULL, njsSodaCollection_truncate, NULL, NULL, NULL,
             napi_default, NULL },
     { NULL, NULL, NULL, NULL, NULL, NULL, napi_default, NULL }
@@ -122,6 +130,8 @@ const njsClassDef njsClassDefSodaCollection = {
 // other methods used internally
 static bool njsSodaCollection_processHintOption(njsBaton *baton,
         napi_env env, napi_value *args);
+static bool njsSodaCollection_saveManyHelper(njsBaton *baton,
+        bool getResultDocs);
 
 //-----------------------------------------------------------------------------
 // njsSodaCollection_createIndex()
@@ -858,6 +868,97 @@ static bool njsSodaCollection_saveAndGetPostAsync(njsBaton *baton,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsSodaCollection_saveMany()
+//   Saves multiple documents into the collection in a single call to the
+// worker thread pool.
+//
+// PARAMETERS
+//   - array of SODA documents
+//   - options
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsSodaCollection_saveMany, 2, NULL)
+{
+    if (!njsSodaCollection_insertManyProcessArgs(baton, env, args))
+        return false;
+    return njsBaton_queueWork(baton, env, "SaveMany",
+            njsSodaCollection_saveManyAsync, NULL, returnValue);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsSodaCollection_saveManyAsync()
+//   Worker function for njsSodaCollection_saveMany().
+//-----------------------------------------------------------------------------
+static bool njsSodaCollection_saveManyAsync(njsBaton *baton)
+{
+    return njsSodaCollection_saveManyHelper(baton, false);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsSodaCollection_saveManyAndGet()
+//   Saves multiple documents into the collection in a single call to the
+// worker thread pool and returns result documents containing metadata.
+//
+// PARAMETERS
+//   - array of SODA documents
+//   - options
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsSodaCollection_saveManyAndGet, 2, NULL)
+{
+    if (!njsSodaCollection_insertManyProcessArgs(baton, env, args))
+        return false;
+    if (!njsSodaCollection_processHintOption(baton, env, args))
+        return false;
+    return njsBaton_queueWork(baton, env, "SaveManyAndGet",
+            njsSodaCollection_saveManyAndGetAsync,
+            njsSodaCollection_insertManyAndGetPostAsync, returnValue);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsSodaCollection_saveManyAndGetAsync()
+//   Worker function for njsSodaCollection_saveManyAndGet().
+//-----------------------------------------------------------------------------
+static bool njsSodaCollection_saveManyAndGetAsync(njsBaton *baton)
+{
+    return njsSodaCollection_saveManyHelper(baton, true);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsSodaCollection_saveManyHelper()
+//   Saves each of the documents on the baton in turn. ODPI-C has no bulk save
+// so each document is saved separately, but the commit (if requested) is only
+// performed with the last document. If result documents are requested, they
+// replace the documents on the baton.
+//-----------------------------------------------------------------------------
+static bool njsSodaCollection_saveManyHelper(njsBaton *baton,
+        bool getResultDocs)
+{
+    njsSodaCollection *coll = (njsSodaCollection*) baton->callingInstance;
+    dpiSodaDoc *resultDoc = NULL;
+    uint32_t i, flags;
+
+    for (i = 0; i < baton->numSodaDocs; i++) {
+        flags = DPI_SODA_FLAGS_DEFAULT;
+        if (baton->autoCommit && i == baton->numSodaDocs - 1)
+            flags |= DPI_SODA_FLAGS_ATOMIC_COMMIT;
+        if (dpiSodaColl_saveWithOptions(coll->handle, baton->sodaDocs[i],
+                baton->sodaOperOptions, flags,
+                (getResultDocs) ? &resultDoc : NULL) < 0)
+            return njsBaton_setErrorDPI(baton);
+        if (getResultDocs) {
+            dpiSodaDoc_release(baton->sodaDocs[i]);
+            baton->sodaDocs[i] = resultDoc;
+        }
+    }
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsSodaCollection_truncate()
 //   Removes all of the documents from a collection.
@@ -35,13 +35,16 @@
 // class methods
 NJS_NAPI_METHOD_DECL_ASYNC(njsSodaDocCursor_close);
 NJS_NAPI_METHOD_DECL_ASYNC(njsSodaDocCursor_getNext);
+NJS_NAPI_METHOD_DECL_ASYNC(njsSodaDocCursor_getNextBatch);
 
 // asynchronous methods
 static NJS_ASYNC_METHOD(njsSodaDocCursor_closeAsync);
 static NJS_ASYNC_METHOD(njsSodaDocCursor_getNextAsync);
+static NJS_ASYNC_METHOD(njsSodaDocCursor_getNextBatchAsync);
 
 // post asynchronous methods
 static NJS_ASYNC_POST_METHOD(njsSodaDocCursor_getNextPostAsync);
+static NJS_ASYNC_POST_METHOD(njsSodaDocCursor_getNextBatchPostAsync);
 
 // finalize
 static NJS_NAPI_FINALIZE(njsSodaDocCursor_finalize);
@@ -52,6 +55,8 @@ static const napi_property_descriptor njsClassProperties[] = {
             napi_default, NULL },
     { "getNext", NULL, njsSodaDocCursor_getNext, NULL, NULL, NULL,
             napi_default, NULL },
+    { "getNextBatch", NULL, njsSodaDocCursor_getNextBatch, NULL, NULL, NULL,
+            napi_default, NULL },
     { NULL, NULL, NULL, NULL, NULL, NULL, napi_default, NULL }
 };
 
@@ -159,6 +164,104 @@ static bool njsSodaDocCursor_getNextPostAsync(njsBaton *baton, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsSodaDocCursor_getNextBatch()
+//   Gets up to the specified number of documents from the cursor in a single
+// call to the worker thread pool.
+//
+// PARAMETERS
+//   - maximum number of documents to return
+//-----------------------------------------------------------------------------
+NJS_NAPI_METHOD_IMPL_ASYNC(njsSodaDocCursor_getNextBatch, 1, NULL)
+{
+    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[0],
+            &baton->fetchArraySize))
+    return njsBaton_queueWork(baton, env, "GetNextBatch",
+            njsSodaDocCursor_getNextBatchAsync,
+            njsSodaDocCursor_getNextBatchPostAsync, returnValue);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsSodaDocCursor_getNextBatchAsync()
+//   Worker function for njsSodaDocCursor_getNextBatch(). The array of
+// documents starts small and is doubled in size as needed, up to the
+// requested number of documents, so that a large request for a cursor with
+// few remaining documents does not allocate memory that is never used.
+//-----------------------------------------------------------------------------
+static bool njsSodaDocCursor_getNextBatchAsync(njsBaton *baton)
+{
+    njsSodaDocCursor *cursor = (njsSodaDocCursor*) baton->callingInstance;
+    uint32_t numAllocated = 0;
+    dpiSodaDoc **tempArray;
+    dpiSodaDoc *doc;
+
+    while (baton->numSodaDocs < baton->fetchArraySize) {
+
+        // acquire the next document from the cursor
+        if (dpiSodaDocCursor_getNext(cursor->handle, DPI_SODA_FLAGS_DEFAULT,
+                &doc) < 0)
+            return njsBaton_setErrorDPI(baton);
+        if (!doc)
+            break;
+
+        // allocate more space in the array, if needed
+        if (baton->numSodaDocs == numAllocated) {
+            if (numAllocated == 0) {
+                numAllocated = NJS_SODA_DOCS_INITIAL_SIZE;
+            } else if (numAllocated > baton->fetchArraySize / 2) {
+                numAllocated = baton->fetchArraySize;
+            } else {
+                numAllocated *= 2;
+            }
+            if (numAllocated > baton->fetchArraySize)
+                numAllocated = baton->fetchArraySize;
+            tempArray = malloc(numAllocated * sizeof(dpiSodaDoc*));
+            if (!tempArray) {
+                dpiSodaDoc_release(doc);
+                return njsBaton_setErrorInsufficientMemory(baton);
+            }
+            if (baton->sodaDocs) {
+                memcpy(tempArray, baton->sodaDocs,
+                        baton->numSodaDocs * sizeof(dpiSodaDoc*));
+                free(baton->sodaDocs);
+            }
+            baton->sodaDocs = tempArray;
+        }
+
+        // store element in the array
+        baton->sodaDocs[baton->numSodaDocs++] = doc;
+
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsSodaDocCursor_getNextBatchPostAsync()
+//   Defines the value returned to JS.
+//-----------------------------------------------------------------------------
+static bool njsSodaDocCursor_getNextBatchPostAsync(njsBaton *baton,
+        napi_env env, napi_value *result)
+{
+    napi_value element;
+    uint32_t i;
+
+    NJS_CHECK_NAPI(env, napi_create_array_with_length(env, baton->numSodaDocs,
+            result))
+    for (i = 0; i < baton->numSodaDocs; i++) {
+        if (!njsSodaDocument_createFromHandle(env, baton->sodaDocs[i],
+                baton->globals, &element))
+            return false;
+        baton->sodaDocs[i] = NULL;
+        NJS_CHECK_NAPI(env, napi_set_element(env, *result, i, element))
+    }
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsSodaDocCursor_newFromBaton()
 //   Called when a SODA document cursor is being created from the baton.
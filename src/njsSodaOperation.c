@@ -275,12 +275,25 @@ static bool njsSodaOperation_getDocumentsAsync(njsBaton *baton)
         if (!doc)
             break;
 
-        // allocate more space in the aray, if needed
+        // allocate more space in the array, if needed; the array starts
+        // small and is doubled in size each time so that small results do
+        // not allocate more than they need and the number of copies made
+        // remains linear in the number of documents; the document is
+        // released if it cannot be stored in the array
         if (baton->numSodaDocs == numAllocated) {
-            numAllocated += 16;
+            if (numAllocated == 0) {
+                numAllocated = NJS_SODA_DOCS_INITIAL_SIZE;
+            } else if (numAllocated > UINT32_MAX / 2) {
+                dpiSodaDoc_release(doc);
+                return njsBaton_setErrorInsufficientMemory(baton);
+            } else {
+                numAllocated *= 2;
+            }
             tempArray = malloc(numAllocated * sizeof(dpiSodaDoc*));
-            if (!tempArray)
+            if (!tempArray) {
+                dpiSodaDoc_release(doc);
                 return njsBaton_setErrorInsufficientMemory(baton);
+            }
             if (baton->sodaDocs) {
                 memcpy(tempArray, baton->sodaDocs,
                         baton->numSodaDocs * sizeof(dpiSodaDoc*));
@@ -0,0 +1,522 @@
+// Copyright (c) 2026, Oracle and/or its affiliates.
+
+//-----------------------------------------------------------------------------
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// NAME
+//   njsThinDecode.c
+//
+// DESCRIPTION
+//   Optional decoder for the row data sent to node-oracledb Thin mode. The
+// rows contained in a packet are decoded into JavaScript values in a single
+// call instead of decoding each column of each row in JavaScript. Only
+// complete rows are decoded; whenever a row cannot be decoded (because it is
+// split across packets or contains a value that requires special handling)
+// decoding stops and the remaining data is processed by JavaScript. No calls
+// to the Oracle Client libraries are made by this code.
+//
+//-----------------------------------------------------------------------------
+
+#include "njsModule.h"
+
+// TTC message types and length indicators
+#define NJS_TNS_MSG_TYPE_ROW_DATA       7
+#define NJS_TNS_MSG_TYPE_BIT_VECTOR     21
+#define NJS_TNS_LONG_LENGTH_INDICATOR   254
+#define NJS_TNS_NULL_LENGTH_INDICATOR   255
+
+// maximum number of bytes in an Oracle number and in its text representation
+#define NJS_THIN_DECODE_MAX_NUMBER_BYTES    21
+#define NJS_THIN_DECODE_MAX_NUMBER_CHARS    300
+
+// data for the state of decoding
+typedef struct {
+    napi_env env;
+    njsModuleGlobals *globals;
+    const uint8_t *buf;
+    size_t pos;
+    size_t end;
+    uint32_t numColumns;
+    const uint8_t *columns;
+    napi_value *values;
+    napi_value makeDateFn;
+} njsThinDecodeState;
+
+// forward declarations of functions only used in this file
+static bool njsThinDecode_decodeRow(njsThinDecodeState *state,
+        uint32_t rowIndex, const uint8_t *bitVector, bool *ok);
+static bool njsThinDecode_decodeRowsHelper(napi_env env,
+        njsModuleGlobals *globals, napi_value *args, napi_value *result);
+static bool njsThinDecode_decodeValue(njsThinDecodeState *state,
+        uint8_t kind, const uint8_t *ptr, uint8_t numBytes, napi_value *value,
+        bool *ok);
+static bool njsThinDecode_numberToString(const uint8_t *ptr,
+        uint8_t numBytes, char *text, size_t *textLength);
+static bool njsThinDecode_skipInteger(njsThinDecodeState *state,
+        uint8_t maxSize);
+
+
+//-----------------------------------------------------------------------------
+// njsThinDecode_decodeRow()
+//   Decodes a single row starting at the current position and stores the
+// values in the arrays at the given row index. If the row cannot be decoded
+// completely, ok is set to false and the position is undefined; the caller is
+// expected to restore it. False is only returned when a JavaScript exception
+// has been raised.
+//-----------------------------------------------------------------------------
+static bool njsThinDecode_decodeRow(njsThinDecodeState *state,
+        uint32_t rowIndex, const uint8_t *bitVector, bool *ok)
+{
+    uint8_t kind, flags, numBytes;
+    napi_env env = state->env;
+    napi_value value;
+    uint32_t col;
+
+    *ok = false;
+    for (col = 0; col < state->numColumns; col++) {
+        kind = state->columns[col * 2];
+        flags = state->columns[col * 2 + 1];
+
+        // duplicate data is copied from the previous row; the first row of a
+        // batch is left to JavaScript as it may need the last raw value
+        if (bitVector && (bitVector[col / 8] & (1 << (col % 8))) == 0) {
+            if (rowIndex == 0)
+                return true;
+            NJS_CHECK_NAPI(env, napi_get_element(env, state->values[col],
+                    rowIndex - 1, &value))
+            NJS_CHECK_NAPI(env, napi_set_element(env, state->values[col],
+                    rowIndex, value))
+            continue;
+        }
+
+        // columns with a maximum size of zero are always null and no data is
+        // sent for them
+        if (kind == NJS_THIN_DECODE_NULL) {
+            NJS_CHECK_NAPI(env, napi_get_null(env, &value))
+            NJS_CHECK_NAPI(env, napi_set_element(env, state->values[col],
+                    rowIndex, value))
+            continue;
+        }
+
+        // acquire the length; values sent in chunks are left to JavaScript
+        if (state->pos >= state->end)
+            return true;
+        numBytes = state->buf[state->pos++];
+        if (numBytes == NJS_TNS_LONG_LENGTH_INDICATOR)
+            return true;
+        if (numBytes == 0 || numBytes == NJS_TNS_NULL_LENGTH_INDICATOR) {
+            NJS_CHECK_NAPI(env, napi_get_null(env, &value))
+        } else {
+            if (numBytes > state->end - state->pos)
+                return true;
+            if (!njsThinDecode_decodeValue(state, kind,
+                    state->buf + state->pos, numBytes, &value, ok))
+                return false;
+            if (!*ok)
+                return true;
+            *ok = false;
+            state->pos += numBytes;
+        }
+        NJS_CHECK_NAPI(env, napi_set_element(env, state->values[col],
+                rowIndex, value))
+
+        // skip the null indicator and return code, if applicable
+        if (flags & NJS_THIN_DECODE_FLAG_INDICATORS) {
+            if (!njsThinDecode_skipInteger(state, 4) ||
+                    !njsThinDecode_skipInteger(state, 4))
+                return true;
+        }
+
+    }
+
+    *ok = true;
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsThinDecode_decodeRowsHelper()
+//   Decodes the rows found in the packet, starting at the given position
+// (which is immediately after the message type of the first row). Further
+// rows (and the bit vectors that precede them) are decoded as long as they
+// are complete within the packet. An array containing the number of rows
+// decoded and the position following the last row decoded is returned.
+//
+// PARAMETERS
+//   - packet buffer
+//   - position of the first row
+//   - size of the packet
+//   - column kinds and flags (Uint8Array, two bytes per column)
+//   - array of the value arrays of each column
+//   - index of the first row
+//   - bit vector of the first row (or null)
+//   - function used for creating dates in JavaScript
+//-----------------------------------------------------------------------------
+static bool njsThinDecode_decodeRowsHelper(napi_env env,
+        njsModuleGlobals *globals, napi_value *args, napi_value *result)
+{
+    size_t bufLength, columnsLength, bitVectorLength, numBitVectorBytes;
+    const uint8_t *bitVector = NULL, *nextBitVector;
+    uint32_t rowIndex, numRows, col, temp32;
+    napi_value rowsValue, posValue;
+    njsThinDecodeState state;
+    size_t committedPos;
+    napi_valuetype type;
+    bool ok;
+
+    // acquire arguments
+    memset(&state, 0, sizeof(state));
+    state.env = env;
+    state.globals = globals;
+    NJS_CHECK_NAPI(env, napi_get_buffer_info(env, args[0], (void**) &state.buf,
+            &bufLength))
+    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[1], &temp32))
+    state.pos = temp32;
+    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[2], &temp32))
+    state.end = (temp32 < bufLength) ? temp32 : bufLength;
+    NJS_CHECK_NAPI(env, napi_get_typedarray_info(env, args[3], NULL,
+            &columnsLength, (void**) &state.columns, NULL, NULL))
+    state.numColumns = (uint32_t) (columnsLength / 2);
+    NJS_CHECK_NAPI(env, napi_get_value_uint32(env, args[5], &rowIndex))
+    NJS_CHECK_NAPI(env, napi_typeof(env, args[6], &type))
+    if (type != napi_null) {
+        NJS_CHECK_NAPI(env, napi_get_buffer_info(env, args[6],
+                (void**) &bitVector, &bitVectorLength))
+        if (bitVectorLength * 8 < state.numColumns)
+            bitVector = NULL;
+    }
+    state.makeDateFn = args[7];
+    numBitVectorBytes = (state.numColumns + 7) / 8;
+
+    // acquire the value arrays for each of the columns
+    state.values = calloc(state.numColumns, sizeof(napi_value));
+    if (!state.values && state.numColumns > 0)
+        return njsUtils_throwInsufficientMemory(env);
+    for (col = 0; col < state.numColumns; col++) {
+        if (napi_get_element(env, args[4], col, &state.values[col]) !=
+                napi_ok) {
+            free(state.values);
+            return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+        }
+    }
+
+    // decode as many rows as possible; the position is only advanced past a
+    // row (and any bit vector preceding it) once it has been fully decoded
+    committedPos = state.pos;
+    numRows = 0;
+    while (1) {
+        if (!njsThinDecode_decodeRow(&state, rowIndex + numRows, bitVector,
+                &ok)) {
+            free(state.values);
+            return false;
+        }
+        if (!ok)
+            break;
+        numRows++;
+        committedPos = state.pos;
+
+        // a bit vector message may precede the next row
+        bitVector = NULL;
+        if (state.pos < state.end &&
+                state.buf[state.pos] == NJS_TNS_MSG_TYPE_BIT_VECTOR) {
+            state.pos++;
+            if (!njsThinDecode_skipInteger(&state, 2) ||
+                    numBitVectorBytes > state.end - state.pos)
+                break;
+            nextBitVector = state.buf + state.pos;
+            state.pos += numBitVectorBytes;
+            bitVector = nextBitVector;
+        }
+
+        // the next message must be another row
+        if (state.pos >= state.end ||
+                state.buf[state.pos] != NJS_TNS_MSG_TYPE_ROW_DATA)
+            break;
+        state.pos++;
+    }
+    free(state.values);
+
+    // return the number of rows decoded and the position following them
+    NJS_CHECK_NAPI(env, napi_create_uint32(env, numRows, &rowsValue))
+    NJS_CHECK_NAPI(env, napi_create_uint32(env, (uint32_t) committedPos,
+            &posValue))
+    NJS_CHECK_NAPI(env, napi_create_array_with_length(env, 2, result))
+    NJS_CHECK_NAPI(env, napi_set_element(env, *result, 0, rowsValue))
+    NJS_CHECK_NAPI(env, napi_set_element(env, *result, 1, posValue))
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsThinDecode_decodeRows()
+//   Entry point for decoding rows. See njsThinDecode_decodeRowsHelper() for
+// the parameters and return value.
+//-----------------------------------------------------------------------------
+napi_value njsThinDecode_decodeRows(napi_env env, napi_callback_info info)
+{
+    njsModuleGlobals *globals;
+    napi_value args[8], result;
+
+    if (!njsUtils_validateArgs(env, info, 8, args, &globals, NULL, NULL, NULL))
+        return NULL;
+    if (!njsThinDecode_decodeRowsHelper(env, globals, args, &result))
+        return NULL;
+    return result;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsThinDecode_decodeValue()
+//   Decodes a single non-null value of the given kind. The value is
+// calculated in the same way as the JavaScript code in Thin mode. If the
+// value cannot be decoded, ok is set to false.
+//-----------------------------------------------------------------------------
+static bool njsThinDecode_decodeValue(njsThinDecodeState *state,
+        uint8_t kind, const uint8_t *ptr, uint8_t numBytes, napi_value *value,
+        bool *ok)
+{
+    char numberText[NJS_THIN_DECODE_MAX_NUMBER_CHARS];
+    char16_t nstring[NJS_TNS_LONG_LENGTH_INDICATOR / 2];
+    napi_env env = state->env;
+    dpiTimestamp timestamp;
+    size_t textLength;
+    uint8_t bytes[8];
+    uint64_t temp64;
+    uint32_t temp32;
+    double dvalue;
+    float fvalue;
+    uint8_t i;
+
+    *ok = false;
+    switch (kind) {
+        case NJS_THIN_DECODE_STRING:
+            NJS_CHECK_NAPI(env, napi_create_string_utf8(env,
+                    (const char*) ptr, numBytes, value))
+            break;
+        case NJS_THIN_DECODE_NSTRING:
+            if (numBytes % 2 != 0)
+                return true;
+            for (i = 0; i < numBytes / 2; i++)
+                nstring[i] = (char16_t) ((ptr[i * 2] << 8) | ptr[i * 2 + 1]);
+            NJS_CHECK_NAPI(env, napi_create_string_utf16(env, nstring,
+                    numBytes / 2, value))
+            break;
+        case NJS_THIN_DECODE_RAW:
+            NJS_CHECK_NAPI(env, napi_create_buffer_copy(env, numBytes, ptr,
+                    NULL, value))
+            break;
+        case NJS_THIN_DECODE_NUMBER:
+            if (!njsThinDecode_numberToString(ptr, numBytes, numberText,
+                    &textLength))
+                return true;
+            NJS_CHECK_NAPI(env, napi_create_string_latin1(env, numberText,
+                    textLength, value))
+            break;
+        case NJS_THIN_DECODE_DATE_LOCAL:
+        case NJS_THIN_DECODE_DATE_UTC:
+            if (numBytes < 7)
+                return true;
+            memset(&timestamp, 0, sizeof(timestamp));
+            timestamp.year = (int16_t) ((ptr[0] - 100) * 100 + ptr[1] - 100);
+            timestamp.month = ptr[2];
+            timestamp.day = ptr[3];
+            timestamp.hour = ptr[4] - 1;
+            timestamp.minute = ptr[5] - 1;
+            timestamp.second = ptr[6] - 1;
+            if (numBytes >= 11)
+                timestamp.fsecond = ((uint32_t) ptr[7] << 24) |
+                        ((uint32_t) ptr[8] << 16) | ((uint32_t) ptr[9] << 8) |
+                        ptr[10];
+
+            // the server returns values with time zones in UTC so the time
+            // zone offset is always zero
+            if (!njsUtils_getDateValue((kind == NJS_THIN_DECODE_DATE_LOCAL) ?
+                    DPI_ORACLE_TYPE_DATE : DPI_ORACLE_TYPE_TIMESTAMP_TZ, env,
+                    &state->globals->dateCache, state->makeDateFn,
+                    &timestamp, value))
+                return false;
+            break;
+        case NJS_THIN_DECODE_BINARY_DOUBLE:
+            if (numBytes != 8)
+                return true;
+            memcpy(bytes, ptr, 8);
+            if (bytes[0] & 0x80) {
+                bytes[0] &= 0x7f;
+            } else {
+                for (i = 0; i < 8; i++)
+                    bytes[i] ^= 0xff;
+            }
+            temp64 = 0;
+            for (i = 0; i < 8; i++)
+                temp64 = (temp64 << 8) | bytes[i];
+            memcpy(&dvalue, &temp64, sizeof(dvalue));
+            NJS_CHECK_NAPI(env, napi_create_double(env, dvalue, value))
+            break;
+        case NJS_THIN_DECODE_BINARY_FLOAT:
+            if (numBytes != 4)
+                return true;
+            memcpy(bytes, ptr, 4);
+            if (bytes[0] & 0x80) {
+                bytes[0] &= 0x7f;
+            } else {
+                for (i = 0; i < 4; i++)
+                    bytes[i] ^= 0xff;
+            }
+            temp32 = ((uint32_t) bytes[0] << 24) | ((uint32_t) bytes[1] << 16) |
+                    ((uint32_t) bytes[2] << 8) | bytes[3];
+            memcpy(&fvalue, &temp32, sizeof(fvalue));
+            NJS_CHECK_NAPI(env, napi_create_double(env, (double) fvalue,
+                    value))
+            break;
+        case NJS_THIN_DECODE_BOOLEAN:
+            NJS_CHECK_NAPI(env, napi_get_boolean(env, (ptr[0] == 1), value))
+            break;
+        default:
+            return true;
+    }
+
+    *ok = true;
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsThinDecode_numberToString()
+//   Converts an Oracle number to its text representation, which is identical
+// to the one generated by BaseBuffer.parseOracleNumber() in JavaScript. False
+// is returned if the number cannot be converted.
+//-----------------------------------------------------------------------------
+static bool njsThinDecode_numberToString(const uint8_t *ptr,
+        uint8_t numBytes, char *text, size_t *textLength)
+{
+    char digits[NJS_THIN_DECODE_MAX_NUMBER_BYTES * 2 + 1];
+    int exponent, decimalPointIndex, base100Digit, digit;
+    uint32_t numDigits = 0, i;
+    size_t pos = 0;
+    bool isPositive;
+
+    if (numBytes > NJS_THIN_DECODE_MAX_NUMBER_BYTES)
+        return false;
+
+    // the first byte is the exponent; positive numbers have the highest
+    // order bit set, whereas negative numbers have the highest order bit
+    // cleared and the bits inverted
+    exponent = ptr[0];
+    isPositive = (exponent & 0x80);
+    if (!isPositive)
+        exponent ^= 0xFF;
+    exponent -= 193;
+    decimalPointIndex = exponent * 2 + 2;
+
+    // a mantissa length of 0 implies a value of 0 (if positive) or a value
+    // of -1e126 (if negative)
+    if (numBytes == 1) {
+        if (isPositive) {
+            memcpy(text, "0", 1);
+            *textLength = 1;
+        } else {
+            memcpy(text, "-1e126", 6);
+            *textLength = 6;
+        }
+        return true;
+    }
+
+    // check for the trailing 102 byte for negative numbers and, if present,
+    // reduce the number of mantissa digits
+    if (!isPositive && ptr[numBytes - 1] == 102)
+        numBytes--;
+
+    // process the mantissa bytes; each is a base-100 digit and anything else
+    // is invalid data which is rejected so that each byte produces no more
+    // than two digits
+    for (i = 1; i < numBytes; i++) {
+        base100Digit = (isPositive) ? ptr[i] - 1 : 101 - ptr[i];
+        if (base100Digit < 0 || base100Digit > 99)
+            return false;
+
+        // process the first digit; leading zeroes are ignored
+        digit = base100Digit / 10;
+        if (digit == 0 && i == 1) {
+            decimalPointIndex--;
+        } else if (digit != 0 || i > 1) {
+            digits[numDigits++] = (char) ('0' + digit);
+        }
+
+        // process the second digit; trailing zeroes are ignored
+        digit = base100Digit % 10;
+        if (digit != 0 || i < (uint32_t) numBytes - 1)
+            digits[numDigits++] = (char) ('0' + digit);
+    }
+
+    // if negative, include the sign
+    if (!isPositive)
+        text[pos++] = '-';
+
+    // if the decimal point index is 0 or less, add the decimal point and
+    // any leading zeroes that are needed
+    if (decimalPointIndex <= 0) {
+        text[pos++] = '.';
+        while (decimalPointIndex < 0) {
+            text[pos++] = '0';
+            decimalPointIndex++;
+        }
+    }
+
+    // add each of the digits
+    for (i = 0; i < numDigits; i++) {
+        if (i > 0 && (int) i == decimalPointIndex)
+            text[pos++] = '.';
+        text[pos++] = digits[i];
+    }
+
+    // if the decimal point index exceeds the number of digits, add any
+    // trailing zeroes that are needed
+    while (decimalPointIndex > (int) numDigits) {
+        text[pos++] = '0';
+        decimalPointIndex--;
+    }
+
+    *textLength = pos;
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsThinDecode_skipInteger()
+//   Skips a variable length integer of up to the specified number of bytes.
+// False is returned if the integer is not contained within the packet or is
+// larger than expected.
+//-----------------------------------------------------------------------------
+static bool njsThinDecode_skipInteger(njsThinDecodeState *state,
+        uint8_t maxSize)
+{
+    uint8_t size;
+
+    if (state->pos >= state->end)
+        return false;
+    size = state->buf[state->pos++] & 0x7f;
+    if (size > maxSize || size > state->end - state->pos)
+        return false;
+    state->pos += size;
+    return true;
+}
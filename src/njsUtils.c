@@ -36,6 +36,8 @@
 static bool njsUtils_createJsonDocumentInSoda(dpiSodaDb *db, napi_env env,
     napi_value value, njsModuleGlobals *globals, const char *key,
     uint32_t keyLength, uint32_t flags, dpiSodaDoc **doc);
+static void njsUtils_finalizeExternalBuffer(napi_env env, void *data,
+        void *hint);
 
 //-----------------------------------------------------------------------------
 // njsUtils_addTypeProperties()
@@ -206,6 +208,36 @@ bool njsUtils_createBaton(napi_env env, napi_callback_info info,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsUtils_createExternalBuffer()
+//   Creates a JS buffer that takes ownership of the memory allocated with
+// malloc() that is passed in, avoiding a copy of the data. On success the
+// pointer is cleared so that the caller does not free the memory; it is freed
+// instead when the buffer is garbage collected. If the runtime does not
+// permit external buffers, the data is copied and ownership is retained by the
+// caller.
+//-----------------------------------------------------------------------------
+bool njsUtils_createExternalBuffer(napi_env env, char **data, size_t length,
+        napi_value *result)
+{
+    int64_t externalMemory;
+
+    if (napi_create_external_buffer(env, length, *data,
+            njsUtils_finalizeExternalBuffer, (void*) (uintptr_t) length,
+            result) != napi_ok) {
+        NJS_CHECK_NAPI(env, napi_create_buffer_copy(env, length, *data, NULL,
+                result))
+        return true;
+    }
+    *data = NULL;
+
+    // let the garbage collector know about the memory now held by the buffer
+    NJS_CHECK_NAPI(env, napi_adjust_external_memory(env, (int64_t) length,
+            &externalMemory))
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsUtils_createJsonDocumentInSoda
 //   Create the JSON Document for SODA. Usable only from Oracle Database 23ai
@@ -221,7 +253,8 @@ static bool njsUtils_createJsonDocumentInSoda(dpiSodaDb *db, napi_env env,
     if (!njsJsContext_populate(env, globals, &jsContext)) {
         return false;
     }
-    if (!njsJsonBuffer_fromValue(&jsonBuffer, env, value, &jsContext)) {
+    if (!njsJsonBuffer_fromValue(&jsonBuffer, env, value, &jsContext,
+            NULL)) {
         njsJsonBuffer_free(&jsonBuffer);
         return false;
     }
@@ -235,6 +268,22 @@ static bool njsUtils_createJsonDocumentInSoda(dpiSodaDb *db, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsUtils_finalizeExternalBuffer()
+//   Frees the memory owned by a buffer created by
+// njsUtils_createExternalBuffer() when it is garbage collected.
+//-----------------------------------------------------------------------------
+static void njsUtils_finalizeExternalBuffer(napi_env env, void *data,
+        void *hint)
+{
+    int64_t externalMemory;
+
+    free(data);
+    napi_adjust_external_memory(env, -(int64_t) (uintptr_t) hint,
+            &externalMemory);
+}
+
+
 //-----------------------------------------------------------------------------
 // njsUtils_genericNew()
 //   Generic method for creating a JS instance with the specified structure
@@ -896,21 +945,125 @@ bool njsUtils_getXid(napi_env env, napi_value value, dpiXid **xid)
 
 
 //-----------------------------------------------------------------------------
-// njsUtils_getDateValue()
-//   Return the value of the timestamp as a JavaScript date. The _makeDate()
-// function is called to use the local JS time zone for DATE and TIMESTAMP and
-// an absolute JS date for TIMESTAMP WITH TIME ZONE and TIMESTAMP WITH LOCAL
-// TIME ZONE.
+// njsUtils_checkDateCache()
+//   Checks that the cache of time zone offsets was populated using the current
+// value of the TZ environment variable. Node.js propagates changes made to
+// process.env.TZ to the environment, so if the value has changed since the
+// cache was populated, all of the entries in the cache are discarded.
 //-----------------------------------------------------------------------------
-bool njsUtils_getDateValue(uint32_t varTypeNum, napi_env env,
+static void njsUtils_checkDateCache(njsDateCache *cache)
+{
+    const char *tzName;
+    size_t tzNameLength;
+
+    tzName = getenv("TZ");
+    if (cache->isInitialized) {
+        if (!tzName && !cache->tzName)
+            return;
+        if (tzName && cache->tzName && strcmp(tzName, cache->tzName) == 0)
+            return;
+    }
+    memset(&cache->localTable, 0, sizeof(cache->localTable));
+    memset(&cache->utcTable, 0, sizeof(cache->utcTable));
+    NJS_FREE_AND_CLEAR(cache->tzName);
+    cache->isInitialized = true;
+    if (tzName) {
+        tzNameLength = strlen(tzName);
+        cache->tzName = malloc(tzNameLength + 1);
+        if (cache->tzName) {
+            memcpy(cache->tzName, tzName, tzNameLength + 1);
+        } else {
+            cache->isInitialized = false;
+        }
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_daysFromCivil()
+//   Returns the number of days since the epoch (1970-01-01) for the given
+// date in the proleptic Gregorian calendar, as used by JavaScript.
+//-----------------------------------------------------------------------------
+static int64_t njsUtils_daysFromCivil(int64_t year, uint32_t month,
+        uint32_t day)
+{
+    uint32_t yearOfEra, dayOfYear, dayOfEra;
+    int64_t era;
+
+    if (month <= 2)
+        year--;
+    era = ((year >= 0) ? year : year - 399) / 400;
+    yearOfEra = (uint32_t) (year - era * 400);
+    dayOfYear = (153 * ((month > 2) ? month - 3 : month + 9) + 2) / 5 +
+            day - 1;
+    dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int64_t) dayOfEra - 719468;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_civilFromMs()
+//   Populates the date and time components of the timestamp from the given
+// number of milliseconds since the epoch; this is the inverse of
+// njsUtils_msFromCivil().
+//-----------------------------------------------------------------------------
+static void njsUtils_civilFromMs(int64_t ms, dpiTimestamp *timestamp)
+{
+    uint32_t dayOfEra, yearOfEra, dayOfYear, monthIndex, msOfDay;
+    int64_t days, era;
+
+    days = ms / NJS_MS_PER_DAY;
+    if (ms % NJS_MS_PER_DAY < 0)
+        days--;
+    msOfDay = (uint32_t) (ms - days * NJS_MS_PER_DAY);
+    days += 719468;
+    era = ((days >= 0) ? days : days - 146096) / 146097;
+    dayOfEra = (uint32_t) (days - era * 146097);
+    yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 -
+            dayOfEra / 146096) / 365;
+    dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 -
+            yearOfEra / 100);
+    monthIndex = (5 * dayOfYear + 2) / 153;
+    timestamp->day = (uint8_t) (dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    timestamp->month = (uint8_t) ((monthIndex < 10) ? monthIndex + 3 :
+            monthIndex - 9);
+    timestamp->year = (int16_t) (yearOfEra + era * 400 +
+            ((timestamp->month <= 2) ? 1 : 0));
+    timestamp->hour = (uint8_t) (msOfDay / 3600000);
+    timestamp->minute = (uint8_t) ((msOfDay / 60000) % 60);
+    timestamp->second = (uint8_t) ((msOfDay / 1000) % 60);
+    timestamp->fsecond = (msOfDay % 1000) * 1000 * 1000;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_msFromCivil()
+//   Returns the number of milliseconds since the epoch for the date and time
+// components of the timestamp, treating them as though they were in UTC. Any
+// fractional milliseconds are truncated, as is done by _makeDate().
+//-----------------------------------------------------------------------------
+static int64_t njsUtils_msFromCivil(dpiTimestamp *timestamp)
+{
+    return njsUtils_daysFromCivil(timestamp->year, timestamp->month,
+            timestamp->day) * NJS_MS_PER_DAY +
+            (int64_t) timestamp->hour * 3600000 +
+            (int64_t) timestamp->minute * 60000 +
+            (int64_t) timestamp->second * 1000 +
+            timestamp->fsecond / (1000 * 1000);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_makeDateJS()
+//   Return the value of the timestamp as a JavaScript date by calling the
+// _makeDate() function.
+//-----------------------------------------------------------------------------
+static bool njsUtils_makeDateJS(bool useLocal, napi_env env,
         napi_value makeDateFn, dpiTimestamp *timestamp, napi_value *value)
 {
     napi_value global, args[9];
     int32_t tzOffset = 0;
-    bool useLocal;
 
-    useLocal = (varTypeNum == DPI_ORACLE_TYPE_DATE ||
-            varTypeNum == DPI_ORACLE_TYPE_TIMESTAMP);
     NJS_CHECK_NAPI(env, napi_get_global(env, &global))
     NJS_CHECK_NAPI(env, napi_get_boolean(env, useLocal, &args[0]))
     NJS_CHECK_NAPI(env, napi_create_int32(env, timestamp->year, &args[1]))
@@ -935,27 +1088,20 @@ bool njsUtils_getDateValue(uint32_t varTypeNum, napi_env env,
 
 
 //-----------------------------------------------------------------------------
-// njsUtils_setDateValue()
-//   Set the value of the timestamp from a JavaScript date. The value sent to
-// the database will depend on the Oracle data type. DATE and TIMESTAMP contain
-// no time zone information so they are sent in the JavaScript time zone.
-// TIMESTAMP WITH TIME ZONE and TIMESTAMP WITH LOCAL TIME ZONE contain time
-// zone information so they are sent to the database in UTC (JavaScript's
-// native format).
+// njsUtils_getDateComponentsJS()
+//   Populates the timestamp with the components of the JavaScript date by
+// calling the _getDateComponents() function.
 //-----------------------------------------------------------------------------
-bool njsUtils_setDateValue(uint32_t varTypeNum, napi_env env, napi_value value,
-        napi_value getComponentsFn, dpiTimestamp *timestamp)
+static bool njsUtils_getDateComponentsJS(bool useLocal, napi_env env,
+        napi_value value, napi_value getComponentsFn, dpiTimestamp *timestamp)
 {
     napi_value args[2], global, array, temp;
     uint32_t temp_unsigned;
     int32_t temp_signed;
-    bool useLocalTime;
 
     // call the JS function to get the individual components as an Array
-    useLocalTime = (varTypeNum == DPI_ORACLE_TYPE_DATE ||
-            varTypeNum == DPI_ORACLE_TYPE_TIMESTAMP);
     NJS_CHECK_NAPI(env, napi_get_global(env, &global))
-    NJS_CHECK_NAPI(env, napi_get_boolean(env, useLocalTime, &args[0]))
+    NJS_CHECK_NAPI(env, napi_get_boolean(env, useLocal, &args[0]))
     args[1] = value;
     NJS_CHECK_NAPI(env, napi_call_function(env, global, getComponentsFn, 2,
             args, &array))
@@ -994,6 +1140,297 @@ bool njsUtils_setDateValue(uint32_t varTypeNum, napi_env env, napi_value value,
     NJS_CHECK_NAPI(env, napi_get_element(env, array, 6, &temp))
     NJS_CHECK_NAPI(env, napi_get_value_uint32(env, temp, &timestamp->fsecond))
 
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_getOffsetJS()
+//   Returns the offset (in milliseconds) between local time and UTC at the
+// given value, as determined by JavaScript. If isLocal is true, the value is a
+// local time (expressed as though it were in UTC) and the offset is acquired
+// by calling _makeDate(); otherwise, the value is a UTC time and the offset is
+// acquired by calling _getDateComponents().
+//-----------------------------------------------------------------------------
+static bool njsUtils_getOffsetJS(bool isLocal, int64_t ms, napi_env env,
+        napi_value jsFn, int64_t *offset)
+{
+    dpiTimestamp timestamp;
+    napi_value temp;
+    double dateMs;
+
+    if (isLocal) {
+        njsUtils_civilFromMs(ms, &timestamp);
+        if (!njsUtils_makeDateJS(true, env, jsFn, &timestamp, &temp))
+            return false;
+        NJS_CHECK_NAPI(env, napi_get_date_value(env, temp, &dateMs))
+        *offset = ms - (int64_t) dateMs;
+    } else {
+        NJS_CHECK_NAPI(env, napi_create_date(env, (double) ms, &temp))
+        if (!njsUtils_getDateComponentsJS(true, env, temp, jsFn, &timestamp))
+            return false;
+        *offset = njsUtils_msFromCivil(&timestamp) - ms;
+    }
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_findOffsetChange()
+//   Searches from the given value towards the given limit (which may be lower
+// or higher than the value) for the first time zone transition. The offset is
+// checked at steps of NJS_DATE_CACHE_STEP_MS; once a step with a different
+// offset is found, the transition is located exactly by bisection. The last
+// value (closest to the limit) that still has the given offset is returned.
+//-----------------------------------------------------------------------------
+static bool njsUtils_findOffsetChange(bool isLocal, napi_env env,
+        napi_value jsFn, int64_t offset, int64_t ms, int64_t limit,
+        int64_t *lastMs)
+{
+    int64_t step, probeMs, midMs, probeOffset;
+
+    step = (limit < ms) ? -NJS_DATE_CACHE_STEP_MS : NJS_DATE_CACHE_STEP_MS;
+    while (ms != limit) {
+        probeMs = (llabs(limit - ms) > NJS_DATE_CACHE_STEP_MS) ? ms + step :
+                limit;
+        if (!njsUtils_getOffsetJS(isLocal, probeMs, env, jsFn, &probeOffset))
+            return false;
+        if (probeOffset == offset) {
+            ms = probeMs;
+            continue;
+        }
+        while (llabs(probeMs - ms) > 1) {
+            midMs = ms + (probeMs - ms) / 2;
+            if (!njsUtils_getOffsetJS(isLocal, midMs, env, jsFn,
+                    &probeOffset))
+                return false;
+            if (probeOffset == offset) {
+                ms = midMs;
+            } else {
+                probeMs = midMs;
+            }
+        }
+        break;
+    }
+    *lastMs = ms;
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_getLocalOffset()
+//   Returns the offset (in milliseconds) between local time and UTC, as
+// determined by JavaScript, for the given value. See njsUtils_getOffsetJS()
+// for the meaning of isLocal. Each entry in the cache holds the offset for the
+// whole interval between two time zone transitions, so values spanning days or
+// years are served by a handful of entries. When no entry contains the value,
+// the offset is acquired once and the transitions on either side are searched
+// for, up to NJS_DATE_CACHE_MAX_SEARCH_MS away or up to the neighbouring
+// cached interval, whichever is closer. Values in sorted order therefore only
+// need a single extra probe to extend the cache backwards.
+//-----------------------------------------------------------------------------
+static bool njsUtils_getLocalOffset(njsDateCache *cache, bool isLocal,
+        int64_t ms, napi_env env, napi_value jsFn, int64_t *offset)
+{
+    int64_t lowerLimit, upperLimit, yearMs, startMs, endMs;
+    njsDateCacheEntry *entry;
+    njsDateCacheTable *table;
+    uint32_t i;
+
+    // check the most recently used entry first, then the remaining entries
+    table = (isLocal) ? &cache->localTable : &cache->utcTable;
+    entry = &table->entries[table->lastIndex];
+    if (entry->isValid && ms >= entry->start && ms < entry->end) {
+        *offset = entry->offset;
+        return true;
+    }
+    for (i = 0; i < NJS_DATE_CACHE_SIZE; i++) {
+        entry = &table->entries[i];
+        if (entry->isValid && ms >= entry->start && ms < entry->end) {
+            table->lastIndex = i;
+            *offset = entry->offset;
+            return true;
+        }
+    }
+
+    // determine the limits of the search; the search does not extend into
+    // any cached interval or beyond the range of JavaScript dates; local
+    // times in the years 0 to 99 are not searched either as JavaScript treats
+    // those years as 1900 to 1999
+    lowerLimit = ms - NJS_DATE_CACHE_MAX_SEARCH_MS;
+    upperLimit = ms + NJS_DATE_CACHE_MAX_SEARCH_MS;
+    for (i = 0; i < NJS_DATE_CACHE_SIZE; i++) {
+        entry = &table->entries[i];
+        if (!entry->isValid)
+            continue;
+        if (entry->end <= ms && entry->end > lowerLimit)
+            lowerLimit = entry->end;
+        if (entry->start > ms && entry->start - 1 < upperLimit)
+            upperLimit = entry->start - 1;
+    }
+    if (lowerLimit < -NJS_MAX_DATE_MS)
+        lowerLimit = -NJS_MAX_DATE_MS;
+    if (upperLimit > NJS_MAX_DATE_MS)
+        upperLimit = NJS_MAX_DATE_MS;
+    if (isLocal) {
+        yearMs = njsUtils_daysFromCivil(100, 1, 1) * NJS_MS_PER_DAY;
+        if (ms >= yearMs && lowerLimit < yearMs)
+            lowerLimit = yearMs;
+        yearMs = njsUtils_daysFromCivil(0, 1, 1) * NJS_MS_PER_DAY;
+        if (ms < yearMs && upperLimit >= yearMs)
+            upperLimit = yearMs - 1;
+    }
+
+    // acquire the offset at the value and search for the transitions on
+    // either side of it
+    if (!njsUtils_getOffsetJS(isLocal, ms, env, jsFn, offset))
+        return false;
+    if (!njsUtils_findOffsetChange(isLocal, env, jsFn, *offset, ms,
+            lowerLimit, &startMs))
+        return false;
+    if (!njsUtils_findOffsetChange(isLocal, env, jsFn, *offset, ms,
+            upperLimit, &endMs))
+        return false;
+
+    // store the interval in the cache, replacing the oldest entry
+    table->lastIndex = table->nextIndex;
+    table->nextIndex = (table->nextIndex + 1) % NJS_DATE_CACHE_SIZE;
+    entry = &table->entries[table->lastIndex];
+    entry->start = startMs;
+    entry->end = endMs + 1;
+    entry->offset = *offset;
+    entry->isValid = true;
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_getDateMs()
+//   Return the value of the timestamp as the number of milliseconds since the
+// epoch, which is the value stored in a JavaScript date. DATE and TIMESTAMP
+// use the local JS time zone and TIMESTAMP WITH TIME ZONE and TIMESTAMP WITH
+// LOCAL TIME ZONE are converted to an absolute value. The value is calculated
+// directly; the offset used for local times is acquired from the cache. The
+// _makeDate() function is only called to populate the cache or when the year
+// is between 0 and 99 (which JavaScript treats as 1900 to 1999).
+//-----------------------------------------------------------------------------
+bool njsUtils_getDateMs(uint32_t varTypeNum, napi_env env,
+        njsDateCache *cache, napi_value makeDateFn, dpiTimestamp *timestamp,
+        double *value)
+{
+    bool useLocal, isCacheable = true;
+    int64_t ms, offset;
+    napi_value date;
+
+    useLocal = (varTypeNum == DPI_ORACLE_TYPE_DATE ||
+            varTypeNum == DPI_ORACLE_TYPE_TIMESTAMP);
+    ms = njsUtils_msFromCivil(timestamp);
+    if (timestamp->year >= 0 && timestamp->year <= 99) {
+        isCacheable = false;
+    } else if (useLocal) {
+        njsUtils_checkDateCache(cache);
+        if (!njsUtils_getLocalOffset(cache, true, ms, env, makeDateFn,
+                &offset))
+            return false;
+        ms -= offset;
+    } else {
+        // tzMinuteOffset carries the same sign as tzHourOffset (e.g. for
+        // -03:30, tzHourOffset is -3 and tzMinuteOffset is -30)
+        ms -= (timestamp->tzHourOffset * 60 + timestamp->tzMinuteOffset) *
+                60000;
+    }
+    if (isCacheable) {
+        *value = (double) ms;
+        return true;
+    }
+    if (!njsUtils_makeDateJS(useLocal, env, makeDateFn, timestamp, &date))
+        return false;
+    NJS_CHECK_NAPI(env, napi_get_date_value(env, date, value))
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_getDateValue()
+//   Return the value of the timestamp as a JavaScript date. See
+// njsUtils_getDateMs() for how the value is calculated.
+//-----------------------------------------------------------------------------
+bool njsUtils_getDateValue(uint32_t varTypeNum, napi_env env,
+        njsDateCache *cache, napi_value makeDateFn, dpiTimestamp *timestamp,
+        napi_value *value)
+{
+    double ms;
+
+    if (!njsUtils_getDateMs(varTypeNum, env, cache, makeDateFn, timestamp,
+            &ms))
+        return false;
+    NJS_CHECK_NAPI(env, napi_create_date(env, ms, value))
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_parseNumber()
+//   Parses the text representation of an Oracle number and returns it as a
+// double, without the need to create a JavaScript string. The value returned
+// by strtod() is correctly rounded, just like the value that JavaScript would
+// calculate. If the text cannot be parsed completely, false is returned and
+// the caller is expected to fall back to having JavaScript do the conversion.
+//-----------------------------------------------------------------------------
+bool njsUtils_parseNumber(const char *text, uint32_t textLength,
+        double *value)
+{
+    char buffer[NJS_MAX_NUMBER_TEXT_SIZE + 1], *end;
+
+    if (textLength == 0 || textLength > NJS_MAX_NUMBER_TEXT_SIZE)
+        return false;
+    memcpy(buffer, text, textLength);
+    buffer[textLength] = '\0';
+    *value = strtod(buffer, &end);
+    return (end == buffer + textLength);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsUtils_setDateValue()
+//   Set the value of the timestamp from a JavaScript date. The value sent to
+// the database will depend on the Oracle data type. DATE and TIMESTAMP contain
+// no time zone information so they are sent in the JavaScript time zone.
+// TIMESTAMP WITH TIME ZONE and TIMESTAMP WITH LOCAL TIME ZONE contain time
+// zone information so they are sent to the database in UTC (JavaScript's
+// native format). The components are calculated directly from the number of
+// milliseconds since the epoch; the _getDateComponents() function is only
+// called to populate the cache of time zone offsets or when the date is
+// invalid.
+//-----------------------------------------------------------------------------
+bool njsUtils_setDateValue(uint32_t varTypeNum, napi_env env, napi_value value,
+        njsDateCache *cache, napi_value getComponentsFn,
+        dpiTimestamp *timestamp)
+{
+    bool useLocalTime, isCacheable = false;
+    int64_t ms, offset = 0;
+    double dateMs;
+
+    useLocalTime = (varTypeNum == DPI_ORACLE_TYPE_DATE ||
+            varTypeNum == DPI_ORACLE_TYPE_TIMESTAMP);
+    NJS_CHECK_NAPI(env, napi_get_date_value(env, value, &dateMs))
+    if (!isnan(dateMs)) {
+        ms = (int64_t) dateMs;
+        isCacheable = true;
+        if (useLocalTime) {
+            njsUtils_checkDateCache(cache);
+            if (!njsUtils_getLocalOffset(cache, false, ms, env,
+                    getComponentsFn, &offset))
+                return false;
+        }
+    }
+    if (isCacheable) {
+        njsUtils_civilFromMs(ms + offset, timestamp);
+    } else if (!njsUtils_getDateComponentsJS(useLocalTime, env, value,
+            getComponentsFn, timestamp)) {
+        return false;
+    }
+
     // always use UTC when time zones are used (JavaScript native format)
     timestamp->tzHourOffset = 0;
     timestamp->tzMinuteOffset = 0;
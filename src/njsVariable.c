@@ -33,6 +33,9 @@
 #include "njsModule.h"
 
 // forward declarations for functions only used in this file
+static uint32_t njsVariable_formatDouble(double value, char *buffer,
+        size_t bufferSize);
+static uint32_t njsVariable_formatInt64(int64_t value, char *buffer);
 static void njsVariable_freeBuffer(njsVariableBuffer *buffer);
 static bool njsVariable_processBuffer(njsVariable *var,
         njsVariableBuffer *buffer, njsBaton *baton);
@@ -40,6 +43,9 @@ static bool njsVariable_processBufferJS(njsVariable *var,
         njsVariableBuffer *buffer, napi_env env, njsBaton *baton);
 static bool njsVariable_setFromString(njsVariable *var, uint32_t pos,
         napi_env env, napi_value value, njsBaton *baton);
+static bool njsVariable_setNumber(njsVariable *var, uint32_t pos,
+        napi_env env, napi_value value, napi_valuetype valueType,
+        njsBaton *baton);
 static bool njsVariable_updateVectorInfoFromTypeInfo(napi_env env,
         napi_value value, bool isIndices, njsBaton *baton,
                 dpiVectorInfo *vectorInfo);
@@ -118,6 +124,23 @@ bool njsVariable_createBuffer(njsVariable *var, njsConnection *conn,
             break;
     }
 
+    // numbers that are known to be integers with no more than 18 digits
+    // always fit in a 64-bit integer, so they are fetched natively instead of
+    // as text; this includes all numbers returned in integer typed arrays when
+    // fetching in column format
+    if (var->varTypeNum == DPI_ORACLE_TYPE_NUMBER &&
+            var->dbTypeNum == DPI_ORACLE_TYPE_NUMBER && var->precision > 0 &&
+            var->scale <= 0 && var->scale != -127 &&
+            var->precision - var->scale <= NJS_MAX_INT64_NUMBER_DIGITS)
+        var->nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+
+    // integers bound from typed arrays supplied to executeMany() are also
+    // bound natively
+    if (var->varTypeNum == DPI_ORACLE_TYPE_NUMBER &&
+            (var->columnArrayType == NJS_COLUMN_ARRAY_TYPE_INT32 ||
+            var->columnArrayType == NJS_COLUMN_ARRAY_TYPE_BIGINT64))
+        var->nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+
     // allocate buffer
     var->buffer = calloc(1, sizeof(njsVariableBuffer));
     if (!var->buffer)
@@ -148,6 +171,55 @@ bool njsVariable_createBuffer(njsVariable *var, njsConnection *conn,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsVariable_formatDouble()
+//   Formats a double as the shortest text that converts back to the same
+// value. This is used to bind doubles to Oracle numbers without introducing
+// the extra digits that a binary to decimal conversion would produce.
+// Integral values (by far the most common) have their digits generated
+// directly; otherwise, the fewest significant digits (of 15, 16 or 17) that
+// round trip are used.
+//-----------------------------------------------------------------------------
+static uint32_t njsVariable_formatDouble(double value, char *buffer,
+        size_t bufferSize)
+{
+    int precision, length = 0;
+
+    if (value == floor(value) && fabs(value) < 1e18)
+        return njsVariable_formatInt64((int64_t) value, buffer);
+    for (precision = 15; precision <= 17; precision++) {
+        length = snprintf(buffer, bufferSize, "%.*g", precision, value);
+        if (strtod(buffer, NULL) == value)
+            break;
+    }
+    return (uint32_t) length;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsVariable_formatInt64()
+//   Formats a 64-bit integer as decimal text. The buffer must have room for at
+// least 20 characters. The length of the text is returned.
+//-----------------------------------------------------------------------------
+static uint32_t njsVariable_formatInt64(int64_t value, char *buffer)
+{
+    uint32_t numDigits = 0, length = 0;
+    uint64_t absValue;
+    char digits[20];
+
+    absValue = (value < 0) ? 0 - (uint64_t) value : (uint64_t) value;
+    do {
+        digits[numDigits++] = (char) ('0' + absValue % 10);
+        absValue /= 10;
+    } while (absValue > 0);
+    if (value < 0)
+        buffer[length++] = '-';
+    while (numDigits > 0)
+        buffer[length++] = digits[--numDigits];
+    return length;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsVariable_free()
 //   Frees the contents of the variable.
@@ -402,8 +474,9 @@ bool njsVariable_getScalarValue(njsVariable *var, njsConnection *conn,
     uint32_t bufferRowIndex, rowidValueLength;
     const char *rowidValue;
     dpiJsonNode *topNode;
-    dpiData *data;
     napi_value numStr;
+    double numValue;
+    dpiData *data;
 
     // get the value from ODPI-C
     bufferRowIndex = baton->bufferRowIndex + pos;
@@ -427,8 +500,8 @@ bool njsVariable_getScalarValue(njsVariable *var, njsConnection *conn,
             break;
         case DPI_NATIVE_TYPE_TIMESTAMP:
             if (!njsUtils_getDateValue(var->varTypeNum, env,
-                    baton->jsContext.jsMakeDateFn, &data->value.asTimestamp,
-                    value))
+                    baton->jsContext.dateCache, baton->jsContext.jsMakeDateFn,
+                    &data->value.asTimestamp, value))
                 return false;
             break;
         case DPI_NATIVE_TYPE_DOUBLE:
@@ -437,10 +510,17 @@ bool njsVariable_getScalarValue(njsVariable *var, njsConnection *conn,
             break;
         case DPI_NATIVE_TYPE_BYTES:
             if (var->varTypeNum == DPI_ORACLE_TYPE_NUMBER) {
-                NJS_CHECK_NAPI(env, napi_create_string_utf8(env,
-                        data->value.asBytes.ptr, data->value.asBytes.length,
-                        &numStr))
-                NJS_CHECK_NAPI(env, napi_coerce_to_number(env, numStr, value))
+                if (njsUtils_parseNumber(data->value.asBytes.ptr,
+                        data->value.asBytes.length, &numValue)) {
+                    NJS_CHECK_NAPI(env, napi_create_double(env, numValue,
+                            value))
+                } else {
+                    NJS_CHECK_NAPI(env, napi_create_string_utf8(env,
+                            data->value.asBytes.ptr,
+                            data->value.asBytes.length, &numStr))
+                    NJS_CHECK_NAPI(env, napi_coerce_to_number(env, numStr,
+                            value))
+                }
             } else {
                 if (data->value.asBytes.length > var->maxSize)
                     return njsBaton_setErrorInsufficientBufferForBinds(baton);
@@ -501,6 +581,7 @@ bool njsVariable_getScalarValue(njsVariable *var, njsConnection *conn,
                 env, value);
         case DPI_NATIVE_TYPE_VECTOR:
             return njsBaton_getVectorValue(baton, data->value.asVector,
+                    (var->vectorMatrix.values) ? &var->vectorMatrix : NULL,
                     env, value);
         case DPI_NATIVE_TYPE_INTERVAL_YM:
             return njsJsContext_getIntervalYM(&baton->jsContext,
@@ -872,6 +953,163 @@ static bool njsVariable_getVectorInfo(napi_env env, napi_value value,
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// njsVariable_setColumnValues()
+//   Set the values of the variable from a Float64Array, Int32Array or
+// BigInt64Array supplied as a column of values to executeMany(), along with
+// an optional bitmap identifying which of the values are null. The values are
+// written directly into the ODPI-C buffers without acquiring each value from
+// JavaScript.
+//-----------------------------------------------------------------------------
+bool njsVariable_setColumnValues(njsVariable *var, napi_env env,
+        napi_value values, napi_value nulls, njsBaton *baton)
+{
+    napi_typedarray_type arrayType;
+    size_t numValues, numNullBytes;
+    uint8_t *nullsPtr = NULL;
+    napi_valuetype valueType;
+    char numBuffer[32];
+    void *valuesPtr;
+    int64_t intValue;
+    double dblValue;
+    uint32_t i, len;
+    dpiData *data;
+
+    // acquire the values and the null bitmap (if one was supplied)
+    NJS_CHECK_NAPI(env, napi_get_typedarray_info(env, values, &arrayType,
+            &numValues, &valuesPtr, NULL, NULL))
+    if (numValues < var->maxArraySize)
+        return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+    NJS_CHECK_NAPI(env, napi_typeof(env, nulls, &valueType))
+    if (valueType != napi_undefined) {
+        NJS_CHECK_NAPI(env, napi_get_typedarray_info(env, nulls, &arrayType,
+                &numNullBytes, (void**) &nullsPtr, NULL, NULL))
+        if (numNullBytes < (var->maxArraySize + 7) / 8)
+            return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+    }
+
+    // transfer each of the values to the variable
+    for (i = 0; i < var->maxArraySize; i++) {
+        data = &var->buffer->dpiVarData[i];
+        if (nullsPtr && (nullsPtr[i / 8] & (1 << (i % 8)))) {
+            data->isNull = 1;
+            continue;
+        }
+        data->isNull = 0;
+        intValue = 0;
+        dblValue = 0;
+        switch (var->columnArrayType) {
+            case NJS_COLUMN_ARRAY_TYPE_INT32:
+                intValue = ((int32_t*) valuesPtr)[i];
+                dblValue = (double) intValue;
+                break;
+            case NJS_COLUMN_ARRAY_TYPE_BIGINT64:
+                intValue = ((int64_t*) valuesPtr)[i];
+                dblValue = (double) intValue;
+                break;
+            default:
+                dblValue = ((double*) valuesPtr)[i];
+                if (var->nativeTypeNum == DPI_NATIVE_TYPE_INT64)
+                    intValue = (int64_t) dblValue;
+                break;
+        }
+        switch (var->nativeTypeNum) {
+            case DPI_NATIVE_TYPE_INT64:
+                data->value.asInt64 = intValue;
+                break;
+            case DPI_NATIVE_TYPE_DOUBLE:
+                data->value.asDouble = dblValue;
+                break;
+            case DPI_NATIVE_TYPE_FLOAT:
+                data->value.asFloat = (float) dblValue;
+                break;
+            default:
+                len = njsVariable_formatDouble(dblValue, numBuffer,
+                        sizeof(numBuffer));
+                if (dpiVar_setFromBytes(var->dpiVarHandle, i, numBuffer,
+                        len) < 0)
+                    return njsBaton_setErrorDPI(baton);
+                break;
+        }
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsVariable_setVectorColumnValues()
+//   Set the values of the variable from a Float32Array, Float64Array or
+// Int8Array supplied to executeMany() as a matrix containing the dimensions of
+// each row consecutively, along with an optional bitmap identifying which of
+// the rows are null. Each row is passed to ODPI-C directly from the matrix
+// without acquiring a separate JavaScript value for each vector.
+//-----------------------------------------------------------------------------
+bool njsVariable_setVectorColumnValues(njsVariable *var, napi_env env,
+        napi_value values, napi_value nulls, uint32_t numDimensions,
+        njsBaton *baton)
+{
+    napi_typedarray_type arrayType;
+    size_t numValues, numNullBytes;
+    dpiVectorInfo vectorInfo;
+    uint8_t *nullsPtr = NULL;
+    napi_valuetype valueType;
+    size_t rowSize;
+    char *valuesPtr;
+    dpiData *data;
+    uint32_t i;
+
+    // acquire the matrix and determine the format of the vectors
+    NJS_CHECK_NAPI(env, napi_get_typedarray_info(env, values, &arrayType,
+            &numValues, (void**) &valuesPtr, NULL, NULL))
+    memset(&vectorInfo, 0, sizeof(vectorInfo));
+    switch (arrayType) {
+        case napi_float32_array:
+            vectorInfo.format = DPI_VECTOR_FORMAT_FLOAT32;
+            rowSize = numDimensions * sizeof(float);
+            break;
+        case napi_float64_array:
+            vectorInfo.format = DPI_VECTOR_FORMAT_FLOAT64;
+            rowSize = numDimensions * sizeof(double);
+            break;
+        case napi_int8_array:
+            vectorInfo.format = DPI_VECTOR_FORMAT_INT8;
+            rowSize = numDimensions;
+            break;
+        default:
+            return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+    }
+    if (numDimensions == 0 ||
+            numValues < (size_t) var->maxArraySize * numDimensions)
+        return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+    vectorInfo.numDimensions = numDimensions;
+
+    // acquire the null bitmap (if one was supplied)
+    NJS_CHECK_NAPI(env, napi_typeof(env, nulls, &valueType))
+    if (valueType != napi_undefined) {
+        NJS_CHECK_NAPI(env, napi_get_typedarray_info(env, nulls, &arrayType,
+                &numNullBytes, (void**) &nullsPtr, NULL, NULL))
+        if (numNullBytes < (var->maxArraySize + 7) / 8)
+            return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+    }
+
+    // transfer each of the rows to the variable
+    for (i = 0; i < var->maxArraySize; i++) {
+        data = &var->buffer->dpiVarData[i];
+        if (nullsPtr && (nullsPtr[i / 8] & (1 << (i % 8)))) {
+            data->isNull = 1;
+            continue;
+        }
+        data->isNull = 0;
+        vectorInfo.dimensions.asPtr = valuesPtr + i * rowSize;
+        if (dpiVector_setValue(data->value.asVector, &vectorInfo) < 0)
+            return njsBaton_setErrorDPI(baton);
+    }
+
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsVariable_setScalarValue()
 //   Set the value of the variable from the specified Javascript object at the
@@ -892,7 +1130,6 @@ bool njsVariable_setScalarValue(njsVariable *var, uint32_t pos, napi_env env,
     void *buffer;
     njsLob *lob;
     bool check;
-    napi_value numStr;
 
     // initialization
     data = &var->buffer->dpiVarData[pos];
@@ -901,7 +1138,8 @@ bool njsVariable_setScalarValue(njsVariable *var, uint32_t pos, napi_env env,
     // handle binding to JSON values; the types of values that can be stored in
     // a JSON value are managed independently
     if (var->varTypeNum == DPI_ORACLE_TYPE_JSON) {
-        if (!njsJsonBuffer_fromValue(&jsonBuffer, env, value, &baton->jsContext)) {
+        if (!njsJsonBuffer_fromValue(&jsonBuffer, env, value,
+                &baton->jsContext, &baton->jsonArena)) {
             njsJsonBuffer_free(&jsonBuffer);
             return false;
         }
@@ -945,10 +1183,9 @@ bool njsVariable_setScalarValue(njsVariable *var, uint32_t pos, napi_env env,
 
     // handle binding numbers
     if (valueType == napi_number || valueType == napi_bigint) {
-        if (var->varTypeNum == DPI_ORACLE_TYPE_NUMBER) {
-            NJS_CHECK_NAPI(env, napi_coerce_to_string(env, value, &numStr));
-            return njsVariable_setFromString(var, pos, env, numStr, baton);
-        }
+        if (var->varTypeNum == DPI_ORACLE_TYPE_NUMBER)
+            return njsVariable_setNumber(var, pos, env, value, valueType,
+                    baton);
 
         NJS_CHECK_NAPI(env, napi_get_value_double(env, value, &tempDouble))
         if (var->varTypeNum == DPI_ORACLE_TYPE_NATIVE_FLOAT) {
@@ -987,6 +1224,7 @@ bool njsVariable_setScalarValue(njsVariable *var, uint32_t pos, napi_env env,
     NJS_CHECK_NAPI(env, napi_is_date(env, value, &check))
     if (check) {
         return njsUtils_setDateValue(var->varTypeNum, env, value,
+                baton->jsContext.dateCache,
                 baton->jsContext.jsGetDateComponentsFn,
                 &data->value.asTimestamp);
     }
@@ -1050,6 +1288,47 @@ bool njsVariable_setScalarValue(njsVariable *var, uint32_t pos, napi_env env,
 }
 
 
+//-----------------------------------------------------------------------------
+// njsVariable_setNumber()
+//   Set the value of a NUMBER variable from a JavaScript number or BigInt.
+// The text passed to ODPI-C is generated directly from the numeric value
+// instead of creating an intermediate JavaScript string; only BigInt values
+// that do not fit in 64 bits and non-finite numbers are converted to strings
+// by JavaScript.
+//-----------------------------------------------------------------------------
+static bool njsVariable_setNumber(njsVariable *var, uint32_t pos,
+        napi_env env, napi_value value, napi_valuetype valueType,
+        njsBaton *baton)
+{
+    char numBuffer[32];
+    napi_value numStr;
+    int64_t intValue;
+    double dblValue;
+    uint32_t len = 0;
+    bool converted;
+
+    if (valueType == napi_bigint) {
+        NJS_CHECK_NAPI(env, napi_get_value_bigint_int64(env, value, &intValue,
+                &converted))
+        if (converted)
+            len = njsVariable_formatInt64(intValue, numBuffer);
+    } else {
+        NJS_CHECK_NAPI(env, napi_get_value_double(env, value, &dblValue))
+        converted = isfinite(dblValue);
+        if (converted)
+            len = njsVariable_formatDouble(dblValue, numBuffer,
+                    sizeof(numBuffer));
+    }
+    if (!converted) {
+        NJS_CHECK_NAPI(env, napi_coerce_to_string(env, value, &numStr))
+        return njsVariable_setFromString(var, pos, env, numStr, baton);
+    }
+    if (dpiVar_setFromBytes(var->dpiVarHandle, pos, numBuffer, len) < 0)
+        return njsBaton_setErrorDPI(baton);
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // njsVariable_setFromString()
 //   Set the value of the variable from the specified Javascript string. At
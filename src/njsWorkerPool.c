@@ -0,0 +1,375 @@
+// Copyright (c) 2026, Oracle and/or its affiliates.
+
+//-----------------------------------------------------------------------------
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// NAME
+//   njsWorkerPool.c
+//
+// DESCRIPTION
+//   Implementation of the native worker pool. When the setting
+// oracledb.nativeWorkerThreads is set, the blocking calls made by
+// asynchronous methods are performed by threads owned by the driver instead
+// of by the libuv thread pool, which is shared with fs, dns.lookup() and
+// zlib. Completed work is handed back to the main thread using a thread-safe
+// function.
+//
+//-----------------------------------------------------------------------------
+
+#include "njsModule.h"
+
+// minimum number of threads in the pool; one thread is always reserved for
+// work that is not waiting for a connection to be acquired from a pool
+#define NJS_WORKER_POOL_MIN_THREADS         2
+
+// methods used internally
+static void njsWorkerPool_completeWork(napi_env env, napi_value jsCallback,
+        void *context, void *data);
+static void njsWorkerPool_destroy(njsWorkerPool *pool);
+static njsWorkerQueue *njsWorkerPool_getNextQueue(njsWorkerPool *pool);
+static void njsWorkerPool_markReady(njsWorkerPool *pool,
+        njsWorkerQueue *queue);
+static void njsWorkerPool_run(void *arg);
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_completeWork()
+//   Called on the main thread by the thread-safe function when work has been
+// completed by one of the threads of the pool. When no more work is pending,
+// the thread-safe function no longer keeps the event loop alive.
+//-----------------------------------------------------------------------------
+static void njsWorkerPool_completeWork(napi_env env, napi_value jsCallback,
+        void *context, void *data)
+{
+    njsWorkerPool *pool = (njsWorkerPool*) context;
+
+    // if the environment is being torn down, nothing can be done
+    if (!env)
+        return;
+
+    if (--pool->numPending == 0)
+        napi_unref_threadsafe_function(env, pool->completeFn);
+    njsBaton_completeAsync(env, napi_ok, data);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_create()
+//   Creates the pool and starts its threads. The thread-safe function used to
+// report completed work does not keep the event loop alive until work is
+// queued. Each thread holds its own reference to the thread-safe function so
+// that it remains valid until the thread has stopped.
+//-----------------------------------------------------------------------------
+bool njsWorkerPool_create(napi_env env, uint32_t numThreads,
+        njsWorkerPool **pool)
+{
+    napi_value name;
+    njsWorkerPool *p;
+    uint32_t i;
+
+    if (numThreads < NJS_WORKER_POOL_MIN_THREADS)
+        numThreads = NJS_WORKER_POOL_MIN_THREADS;
+    p = calloc(1, sizeof(njsWorkerPool));
+    if (!p)
+        return njsUtils_throwInsufficientMemory(env);
+    p->threads = calloc(numThreads, sizeof(uv_thread_t));
+    if (!p->threads) {
+        free(p);
+        return njsUtils_throwInsufficientMemory(env);
+    }
+    p->maxPoolBusyThreads = numThreads - 1;
+    uv_mutex_init(&p->mutex);
+    uv_cond_init(&p->cond);
+    *pool = p;
+
+    // create the thread-safe function used to report completed work
+    NJS_CHECK_NAPI(env, napi_create_string_utf8(env, "NativeWorkerPool",
+            NAPI_AUTO_LENGTH, &name))
+    NJS_CHECK_NAPI(env, napi_create_threadsafe_function(env, NULL, NULL, name,
+            0, 1, NULL, NULL, p, njsWorkerPool_completeWork, &p->completeFn))
+    NJS_CHECK_NAPI(env, napi_unref_threadsafe_function(env, p->completeFn))
+
+    // start the threads
+    for (i = 0; i < numThreads; i++) {
+        NJS_CHECK_NAPI(env, napi_acquire_threadsafe_function(p->completeFn))
+        uv_mutex_lock(&p->mutex);
+        p->numRunningThreads++;
+        uv_mutex_unlock(&p->mutex);
+        if (uv_thread_create(&p->threads[i], njsWorkerPool_run, p) != 0) {
+            uv_mutex_lock(&p->mutex);
+            p->numRunningThreads--;
+            uv_mutex_unlock(&p->mutex);
+            napi_release_threadsafe_function(p->completeFn,
+                    napi_tsfn_release);
+            return njsUtils_genericThrowError(env, __FILE__, __LINE__);
+        }
+        p->numThreads++;
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_destroy()
+//   Frees the memory associated with the pool once all of its threads have
+// stopped.
+//-----------------------------------------------------------------------------
+static void njsWorkerPool_destroy(njsWorkerPool *pool)
+{
+    uv_cond_destroy(&pool->cond);
+    uv_mutex_destroy(&pool->mutex);
+    free(pool->threads);
+    free(pool);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_free()
+//   Stops the threads of the pool and frees the memory associated with it.
+// This is only called when the module globals are finalized. Any work that
+// has not yet been reported is discarded by aborting the thread-safe
+// function. If no thread is busy, the threads are joined and the pool is
+// freed immediately; otherwise, threads that may still be blocked in calls to
+// the Oracle Client libraries are not waited for and the last thread to stop
+// frees the pool instead.
+//-----------------------------------------------------------------------------
+void njsWorkerPool_free(njsWorkerPool *pool)
+{
+    bool joinThreads, destroyPool;
+    uint32_t i;
+
+    if (pool->completeFn)
+        napi_release_threadsafe_function(pool->completeFn, napi_tsfn_abort);
+    uv_mutex_lock(&pool->mutex);
+    pool->shutdown = true;
+    joinThreads = (pool->numBusyThreads == 0);
+    pool->detached = !joinThreads;
+    destroyPool = (pool->numRunningThreads == 0);
+    uv_cond_broadcast(&pool->cond);
+    uv_mutex_unlock(&pool->mutex);
+    if (joinThreads) {
+        for (i = 0; i < pool->numThreads; i++)
+            uv_thread_join(&pool->threads[i]);
+        destroyPool = true;
+    }
+    if (destroyPool)
+        njsWorkerPool_destroy(pool);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_getNextQueue()
+//   Removes and returns the first queue in the list of ready queues that is
+// permitted to start work, or NULL if there is no such queue. Work waiting
+// for a connection to be acquired from a pool is only started if the total
+// number of threads used for such work is below the maximum, so that at least
+// one thread always remains for the default queue. The lock is expected to be
+// held when this is called.
+//-----------------------------------------------------------------------------
+static njsWorkerQueue *njsWorkerPool_getNextQueue(njsWorkerPool *pool)
+{
+    njsWorkerQueue *queue, *prevQueue = NULL;
+
+    for (queue = pool->readyHead; queue; queue = queue->nextReady) {
+        if (queue == &pool->defaultQueue ||
+                pool->numPoolBusyThreads < pool->maxPoolBusyThreads) {
+            if (prevQueue)
+                prevQueue->nextReady = queue->nextReady;
+            else pool->readyHead = queue->nextReady;
+            if (pool->readyTail == queue)
+                pool->readyTail = prevQueue;
+            queue->isReady = false;
+            return queue;
+        }
+        prevQueue = queue;
+    }
+
+    return NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_getStatistics()
+//   Returns an object containing the number of threads in the pool, the
+// number of those threads that are busy and the number of requests waiting
+// for a thread. If a queue is specified, the number of requests waiting in
+// that queue is also returned.
+//-----------------------------------------------------------------------------
+bool njsWorkerPool_getStatistics(njsWorkerPool *pool, napi_env env,
+        njsWorkerQueue *queue, napi_value *stats)
+{
+    uint32_t numBusyThreads, queueLength, poolQueueLength = 0;
+    napi_value temp;
+
+    // acquire the values while holding the lock
+    uv_mutex_lock(&pool->mutex);
+    numBusyThreads = pool->numBusyThreads;
+    queueLength = pool->numQueued;
+    if (queue)
+        poolQueueLength = queue->length;
+    uv_mutex_unlock(&pool->mutex);
+
+    // create the object
+    NJS_CHECK_NAPI(env, napi_create_object(env, stats))
+    NJS_CHECK_NAPI(env, napi_create_uint32(env, pool->numThreads, &temp))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, *stats, "threads", temp))
+    NJS_CHECK_NAPI(env, napi_create_uint32(env, numBusyThreads, &temp))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, *stats, "busyThreads",
+            temp))
+    NJS_CHECK_NAPI(env, napi_create_uint32(env, queueLength, &temp))
+    NJS_CHECK_NAPI(env, napi_set_named_property(env, *stats, "queueLength",
+            temp))
+    if (queue) {
+        NJS_CHECK_NAPI(env, napi_create_uint32(env, poolQueueLength, &temp))
+        NJS_CHECK_NAPI(env, napi_set_named_property(env, *stats,
+                "poolQueueLength", temp))
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_markReady()
+//   Adds the queue to the end of the list of queues with work waiting, if it
+// is not already in that list. The lock is expected to be held when this is
+// called.
+//-----------------------------------------------------------------------------
+static void njsWorkerPool_markReady(njsWorkerPool *pool,
+        njsWorkerQueue *queue)
+{
+    if (queue->isReady || queue->length == 0)
+        return;
+    queue->isReady = true;
+    queue->nextReady = NULL;
+    if (pool->readyTail)
+        pool->readyTail->nextReady = queue;
+    else pool->readyHead = queue;
+    pool->readyTail = queue;
+    uv_cond_signal(&pool->cond);
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_queueWork()
+//   Queues the work for the baton. Work is added to the queue specified on the
+// baton (a pool supplies its own queue when acquiring connections) or to the
+// default queue.
+//-----------------------------------------------------------------------------
+bool njsWorkerPool_queueWork(njsWorkerPool *pool, napi_env env,
+        njsBaton *baton)
+{
+    njsWorkerQueue *queue;
+
+    // keep the event loop alive while work is pending
+    if (pool->numPending++ == 0)
+        NJS_CHECK_NAPI(env, napi_ref_threadsafe_function(env,
+                pool->completeFn))
+
+    // add the baton to the end of the queue
+    uv_mutex_lock(&pool->mutex);
+    queue = (baton->workerQueue) ? baton->workerQueue : &pool->defaultQueue;
+    baton->nextWork = NULL;
+    if (queue->tail)
+        queue->tail->nextWork = baton;
+    else queue->head = baton;
+    queue->tail = baton;
+    queue->length++;
+    pool->numQueued++;
+    njsWorkerPool_markReady(pool, queue);
+    uv_mutex_unlock(&pool->mutex);
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// njsWorkerPool_run()
+//   Main routine for each of the threads of the pool. The first queue in the
+// list of ready queues that is permitted to start work is serviced and then
+// moved to the end of the list (if it still has work) so that each queue gets
+// its turn. When the pool is shut down, the thread releases its reference to
+// the thread-safe function and, if the pool was detached from its owner, the
+// last thread to stop frees the pool.
+//-----------------------------------------------------------------------------
+static void njsWorkerPool_run(void *arg)
+{
+    njsWorkerPool *pool = (njsWorkerPool*) arg;
+    napi_threadsafe_function completeFn;
+    njsWorkerQueue *queue;
+    bool isPoolQueue;
+    bool destroyPool;
+    njsBaton *baton;
+
+    completeFn = pool->completeFn;
+    uv_mutex_lock(&pool->mutex);
+    while (1) {
+
+        // wait for work that can be started to become available
+        while (!pool->shutdown &&
+                !(queue = njsWorkerPool_getNextQueue(pool)))
+            uv_cond_wait(&pool->cond, &pool->mutex);
+        if (pool->shutdown)
+            break;
+
+        // take the first baton from the queue
+        isPoolQueue = (queue != &pool->defaultQueue);
+        baton = queue->head;
+        queue->head = baton->nextWork;
+        if (!queue->head)
+            queue->tail = NULL;
+        queue->length--;
+        pool->numQueued--;
+        pool->numBusyThreads++;
+        if (isPoolQueue)
+            pool->numPoolBusyThreads++;
+        njsWorkerPool_markReady(pool, queue);
+        uv_mutex_unlock(&pool->mutex);
+
+        // perform the work
+        if (!baton->workCallback(baton))
+            baton->hasError = true;
+
+        // mark the thread as no longer busy; if the thread was acquiring a
+        // connection, queues waiting for the limit on such work can proceed
+        uv_mutex_lock(&pool->mutex);
+        pool->numBusyThreads--;
+        if (isPoolQueue) {
+            pool->numPoolBusyThreads--;
+            uv_cond_broadcast(&pool->cond);
+        }
+        uv_mutex_unlock(&pool->mutex);
+
+        // report completion; if the pool is being shut down the thread-safe
+        // function has been aborted and the baton is discarded
+        napi_call_threadsafe_function(completeFn, baton, napi_tsfn_blocking);
+        uv_mutex_lock(&pool->mutex);
+
+    }
+    pool->numRunningThreads--;
+    destroyPool = (pool->detached && pool->numRunningThreads == 0);
+    uv_mutex_unlock(&pool->mutex);
+    napi_release_threadsafe_function(completeFn, napi_tsfn_release);
+    if (destroyPool)
+        njsWorkerPool_destroy(pool);
+}
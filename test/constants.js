@@ -39,6 +39,7 @@ describe('18. constants.js', function() {
   it('18.1 Query outFormat Constants', () => {
     assert.strictEqual(4001, oracledb.OUT_FORMAT_ARRAY);
     assert.strictEqual(4002, oracledb.OUT_FORMAT_OBJECT);
+    assert.strictEqual(4003, oracledb.OUT_FORMAT_COLUMNS);
   });
 
   it('18.2 Node-oracledb Type Constants', () => {
@@ -217,4 +217,70 @@ describe('32. dataTypeDate.js', function() {
       );
     });
   }); // end of 32.4 suite
+
+  describe('32.5 Dates in different JavaScript time zones', function() {
+    const origTZ = process.env.TZ;
+
+    afterEach(function() {
+      if (origTZ === undefined) {
+        delete process.env.TZ;
+      } else {
+        process.env.TZ = origTZ;
+      }
+    });
+
+    it('32.5.1 fetches dates correctly after process.env.TZ changes', async function() {
+      const sql = `SELECT TO_DATE('2024-07-01 12:30:45', 'YYYY-MM-DD HH24:MI:SS')
+                   FROM DUAL`;
+      for (const tz of ['UTC', 'America/New_York', 'Asia/Kolkata', 'UTC']) {
+        process.env.TZ = tz;
+        const result = await connection.execute(sql);
+        assert.deepStrictEqual(result.rows[0][0],
+          new Date(2024, 6, 1, 12, 30, 45));
+      }
+    });
+
+    it('32.5.2 round trips dates near daylight saving transitions', async function() {
+      process.env.TZ = 'America/New_York';
+      const dates = [
+        new Date(2024, 2, 10, 1, 59, 59),
+        new Date(2024, 2, 10, 3, 0, 0),
+        new Date(2024, 10, 3, 0, 59, 59),
+        new Date(2024, 10, 3, 2, 0, 0),
+        new Date(1850, 0, 1, 12, 0, 0)
+      ];
+      for (const date of dates) {
+        const result = await connection.execute(`SELECT :1 FROM DUAL`,
+          [{ val: date, type: oracledb.DB_TYPE_DATE }]);
+        assert.strictEqual(result.rows[0][0].getTime(), date.getTime());
+      }
+    });
+
+    it('32.5.3 fetches and binds dates spanning several years', async function() {
+      process.env.TZ = 'America/New_York';
+      const sql = `SELECT TO_CHAR(d, 'YYYY-MM-DD-HH24-MI-SS'), d
+                   FROM (
+                     SELECT DATE '1995-01-01' + (LEVEL - 1) * 3 +
+                            MOD(LEVEL, 24) / 24 d
+                     FROM DUAL
+                     CONNECT BY LEVEL <= 4000
+                   )
+                   ORDER BY DBMS_RANDOM.VALUE`;
+      const result = await connection.execute(sql);
+      assert.strictEqual(result.rows.length, 4000);
+      for (const [text, date] of result.rows) {
+        const [year, month, day, hour, minute, second] =
+          text.split('-').map(Number);
+        assert.strictEqual(date.getTime(),
+          new Date(year, month - 1, day, hour, minute, second).getTime());
+      }
+      for (let i = 0; i < result.rows.length; i += 40) {
+        const [text, date] = result.rows[i];
+        const bindResult = await connection.execute(
+          `SELECT TO_CHAR(:1, 'YYYY-MM-DD-HH24-MI-SS') FROM DUAL`,
+          [{ val: date, type: oracledb.DB_TYPE_DATE }]);
+        assert.strictEqual(bindResult.rows[0][0], text);
+      }
+    });
+  }); // end of 32.5 suite
 });
@@ -1180,4 +1180,88 @@ describe('244.dataTypeJson.js', function() {
 
   }); // 244.13
 
+  describe('244.14 Fetch JSON documents sharing field names', function() {
+
+    const tableNameJSON = 'nodb_myjson_fieldnames';
+    const sqlCreate = " CREATE TABLE " + tableNameJSON + " ( \n" +
+    " id         NUMBER, \n" +
+    " content    JSON \n" +
+    " )";
+
+    before('create table', async function() {
+      if (!isRunnable) {
+        this.skip();
+      }
+      await testsUtil.createTable(connection, tableNameJSON, sqlCreate);
+    }); // before()
+
+    after(async function() {
+      if (!isRunnable) {
+        this.skip();
+      }
+      await testsUtil.dropTable(connection, tableNameJSON);
+    }); // after()
+
+    it('244.14.1 many documents with many distinct and repeated field names', async function() {
+      // more distinct names than are cached, including multibyte names and
+      // names longer than those that are cached
+      const binds = [];
+      for (let i = 0; i < 20; i++) {
+        const doc = {};
+        for (let j = 0; j < 400; j++) {
+          let name = `field_${(i * 37 + j) % 500}`;
+          if (j % 25 === 0)
+            name += 'é€';
+          if (j % 90 === 0)
+            name += 'x'.repeat(100);
+          doc[name] = { id: j, values: [{ id: i }] };
+        }
+        binds.push([i, doc]);
+      }
+      const options = {
+        bindDefs: [
+          { type: oracledb.NUMBER },
+          { type: oracledb.DB_TYPE_JSON }
+        ]
+      };
+      await connection.executeMany(`INSERT INTO ${tableNameJSON}
+        VALUES (:1, :2)`, binds, options);
+      const result = await connection.execute(`SELECT id, content
+        FROM ${tableNameJSON} ORDER BY id`);
+      assert.deepStrictEqual(result.rows, binds);
+    }); // 244.14.1
+
+    it('244.14.2 documents with the same and differing field names', async function() {
+      // consecutive documents with the same field names are interleaved with
+      // documents containing other field names and with scalar values
+      await connection.execute(`DELETE FROM ${tableNameJSON}`);
+      const binds = [];
+      for (let i = 0; i < 100; i++) {
+        let doc;
+        if (i % 17 === 0) {
+          doc = `scalar ${i}`;
+        } else if (i % 10 === 0) {
+          doc = { other: i, ['name_' + i]: [i, { sub: 'x'.repeat(i) }] };
+        } else if (i % 13 === 0) {
+          doc = [{ ['long_' + 'y'.repeat(300)]: i, id: i }];
+        } else {
+          doc = { id: i, name: `Name ${i}`, tags: [{ tag: i % 3 }] };
+        }
+        binds.push([i, doc]);
+      }
+      const options = {
+        bindDefs: [
+          { type: oracledb.NUMBER },
+          { type: oracledb.DB_TYPE_JSON }
+        ]
+      };
+      await connection.executeMany(`INSERT INTO ${tableNameJSON}
+        VALUES (:1, :2)`, binds, options);
+      const result = await connection.execute(`SELECT id, content
+        FROM ${tableNameJSON} ORDER BY id`);
+      assert.deepStrictEqual(result.rows, binds);
+    }); // 244.14.2
+
+  }); // 244.14
+
 });
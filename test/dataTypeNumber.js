@@ -198,4 +198,37 @@ describe('26. dataTypeNumber.js', function() {
 
   }); // 26.4
 
+  describe('26.5 binding numbers', function() {
+
+    // the bound value must be exactly equal to the number represented by the
+    // shortest string which converts back to the same JavaScript number
+    async function checkBind(value) {
+      const sql = `select :num,
+                     case when :num = to_number(:str) then 1 else 0 end
+                   from dual`;
+      const result = await connection.execute(sql, {
+        num: { val: value, type: oracledb.NUMBER },
+        str: value.toString()
+      });
+      assert.strictEqual(result.rows[0][1], 1);
+      return result.rows[0][0];
+    }
+
+    it('26.5.1 binds integers and decimals exactly', async function() {
+      const values = [0, 1, -1, 100, -12345, 0.1, -0.5, 123.45, 1.005,
+        0.000123, 3.14159, 1 / 3, 0.30000000000000004, 1.5e-7, 1e20,
+        9007199254740991, -9007199254740991];
+      for (const value of values) {
+        assert.strictEqual(await checkBind(value), value);
+      }
+    });
+
+    it('26.5.2 binds BigInts exactly', async function() {
+      assert.strictEqual(await checkBind(42n), 42);
+      await checkBind(1234567890123456789n);
+      await checkBind(-1234567890123456789012345n);
+    });
+
+  }); // 26.5
+
 });
@@ -0,0 +1,334 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   331. executeManyColumns.js
+ *
+ * DESCRIPTION
+ *   Testing executeMany() with columns of bind values.
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('331. executeManyColumns.js', function() {
+
+  let conn;
+  const tableName = "nodb_executemany_columns";
+  const numRows = 253;
+  const insertSql = `insert into ${tableName}
+      values (:intCol, :bigIntCol, :numCol, :strCol)`;
+  const querySql = `select IntCol, BigIntCol, NumCol, StrCol
+                    from ${tableName} order by IntCol`;
+
+  function setNull(nulls, i) {
+    nulls[i >> 3] |= 1 << (i & 7);
+  }
+
+  before(async function() {
+    conn = await oracledb.getConnection(dbConfig);
+    const createSql = `create table ${tableName} (
+        IntCol number(9) not null,
+        BigIntCol number(18),
+        NumCol number,
+        StrCol varchar2(20)
+      )`;
+    await testsUtil.createTable(conn, tableName, createSql);
+  });
+
+  after(async function() {
+    await testsUtil.dropTable(conn, tableName);
+    await conn.close();
+  });
+
+  afterEach(async function() {
+    await conn.execute(`truncate table ${tableName}`);
+  });
+
+  it('331.1 inserts typed array columns with null bitmaps', async function() {
+    const intCol = new Int32Array(numRows);
+    const bigIntCol = new BigInt64Array(numRows);
+    const numCol = new Float64Array(numRows);
+    const bigIntNulls = new Uint8Array((numRows + 7) >> 3);
+    const numNulls = new Uint8Array((numRows + 7) >> 3);
+    const strCol = new Array(numRows);
+    for (let i = 0; i < numRows; i++) {
+      intCol[i] = i + 1;
+      bigIntCol[i] = BigInt(1234567890123 + i);
+      if (i % 7 === 0)
+        setNull(bigIntNulls, i);
+      numCol[i] = i + 0.1;
+      if (i % 5 === 0)
+        setNull(numNulls, i);
+      strCol[i] = (i % 2 === 0) ? null : `String ${i}`;
+    }
+    const columns = {
+      intCol: intCol,
+      bigIntCol: {values: bigIntCol, nulls: bigIntNulls},
+      numCol: {values: numCol, nulls: numNulls},
+      strCol: strCol
+    };
+    const result = await conn.executeMany(insertSql, columns);
+    assert.strictEqual(result.rowsAffected, numRows);
+
+    const rows = (await conn.execute(querySql, [],
+      {fetchTypeHandler: () => ({type: oracledb.STRING})})).rows;
+    assert.strictEqual(rows.length, numRows);
+    for (let i = 0; i < numRows; i++) {
+      assert.strictEqual(rows[i][0], String(i + 1));
+      assert.strictEqual(rows[i][1],
+        (i % 7 === 0) ? null : String(1234567890123 + i));
+      assert.strictEqual(rows[i][2], (i % 5 === 0) ? null : String(i + 0.1));
+      assert.strictEqual(rows[i][3], (i % 2 === 0) ? null : `String ${i}`);
+    }
+  });
+
+  it('331.2 inserts columns of values with bindDefs', async function() {
+    const columns = {
+      intCol: [1, 2, 3],
+      bigIntCol: new Float64Array([10, 20, 30]),
+      numCol: [1.5, null, 3.5],
+      strCol: ['One', 'Two', null]
+    };
+    const options = {
+      bindDefs: {
+        intCol: {type: oracledb.NUMBER},
+        bigIntCol: {type: oracledb.NUMBER},
+        numCol: {type: oracledb.NUMBER},
+        strCol: {type: oracledb.STRING, maxSize: 20}
+      }
+    };
+    const result = await conn.executeMany(insertSql, columns, options);
+    assert.strictEqual(result.rowsAffected, 3);
+    const rows = (await conn.execute(querySql)).rows;
+    assert.deepStrictEqual(rows, [
+      [1, 10, 1.5, 'One'],
+      [2, 20, null, 'Two'],
+      [3, 30, 3.5, null]
+    ]);
+  });
+
+  it('331.3 supports OUT binds without a column', async function() {
+    const sql = `insert into ${tableName} (IntCol) values (:intCol)
+                 returning IntCol * 2 into :outVal`;
+    const options = {
+      bindDefs: {
+        intCol: {type: oracledb.NUMBER},
+        outVal: {type: oracledb.NUMBER, dir: oracledb.BIND_OUT}
+      }
+    };
+    const result = await conn.executeMany(sql,
+      {intCol: new Int32Array([4, 5, 6])}, options);
+    assert.deepStrictEqual(result.outBinds.map(b => b.outVal),
+      [[8], [10], [12]]);
+  });
+
+  it('331.4 Negative - columns of differing lengths', async function() {
+    const columns = {
+      intCol: new Int32Array([1, 2, 3]),
+      bigIntCol: [1, 2],
+      numCol: [1, 2, 3],
+      strCol: ['a', 'b', 'c']
+    };
+    await assert.rejects(
+      async () => await conn.executeMany(insertSql, columns),
+      /NJS-197:/
+    );
+  });
+
+  it('331.5 Negative - NaN in a Float64Array column', async function() {
+    const columns = {
+      intCol: new Int32Array([1, 2]),
+      bigIntCol: [1, 2],
+      numCol: new Float64Array([1, NaN]),
+      strCol: ['a', 'b']
+    };
+    await assert.rejects(
+      async () => await conn.executeMany(insertSql, columns),
+      /NJS-105:/
+    );
+  });
+
+  it('331.6 Negative - array bindDefs with columns', async function() {
+    const options = {bindDefs: [{type: oracledb.NUMBER}]};
+    await assert.rejects(
+      async () => await conn.executeMany(insertSql,
+        {intCol: new Int32Array([1])}, options),
+      /NJS-055:/
+    );
+  });
+
+  describe('331.7 matrix of vectors', function() {
+
+    const vecTableName = "nodb_executemany_vector_cols";
+    const vecInsertSql = `insert into ${vecTableName}
+        values (:id, :vec32, :vec64, :vec8)`;
+    const vecQuerySql = `select Id, Vec32, Vec64, Vec8
+                         from ${vecTableName} order by Id`;
+    const dims = 16;
+    const numVecRows = 37;
+
+    function createMatrix(ArrayType, scale) {
+      const matrix = new ArrayType(numVecRows * dims);
+      for (let i = 0; i < matrix.length; i++)
+        matrix[i] = ((i % 101) - 50) * scale;
+      return matrix;
+    }
+
+    before(async function() {
+      const isRunnable = await testsUtil.checkPrerequisites(2304000000,
+        2304000000);
+      if (!isRunnable) this.skip();
+      const createSql = `create table ${vecTableName} (
+          Id number(9) not null,
+          Vec32 vector(${dims}, float32),
+          Vec64 vector(${dims}, float64),
+          Vec8 vector(${dims}, int8)
+        )`;
+      await testsUtil.createTable(conn, vecTableName, createSql);
+    });
+
+    after(async function() {
+      await testsUtil.dropTable(conn, vecTableName);
+    });
+
+    afterEach(async function() {
+      await conn.execute(`truncate table ${vecTableName}`);
+    });
+
+    async function checkRows(columns) {
+      const result = await conn.execute(vecQuerySql);
+      assert.strictEqual(result.rows.length, numVecRows);
+      for (let i = 0; i < numVecRows; i++) {
+        const [id, vec32, vec64, vec8] = result.rows[i];
+        assert.strictEqual(id, i + 1);
+        const start = i * dims;
+        assert.deepStrictEqual(vec32,
+          columns.vec32.values.slice(start, start + dims));
+        assert.deepStrictEqual(vec64,
+          columns.vec64.values.slice(start, start + dims));
+        if (i % 5 === 0) {
+          assert.strictEqual(vec8, null);
+        } else {
+          assert.deepStrictEqual(vec8,
+            columns.vec8.values.slice(start, start + dims));
+        }
+      }
+    }
+
+    function createColumns() {
+      const nulls = new Uint8Array((numVecRows + 7) >> 3);
+      for (let i = 0; i < numVecRows; i += 5)
+        setNull(nulls, i);
+      return {
+        id: Int32Array.from({length: numVecRows}, (v, i) => i + 1),
+        vec32: {values: createMatrix(Float32Array, 0.25), dims: dims},
+        vec64: {values: createMatrix(Float64Array, 0.125), dims: dims},
+        vec8: {values: createMatrix(Int8Array, 1), dims: dims, nulls: nulls}
+      };
+    }
+
+    it('331.7.1 inserts vectors from Float32Array, Float64Array and Int8Array matrices', async function() {
+      const columns = createColumns();
+      const result = await conn.executeMany(vecInsertSql, columns);
+      assert.strictEqual(result.rowsAffected, numVecRows);
+      await checkRows(columns);
+    });
+
+    it('331.7.2 inserts vectors from matrices with pipeline.addExecuteMany()', async function() {
+      const columns = createColumns();
+      const pipeline = new oracledb.Pipeline();
+      pipeline.addExecuteMany(vecInsertSql, columns);
+      const results = await conn.runPipeline(pipeline);
+      assert.strictEqual(results[0].rowsAffected, numVecRows);
+      await checkRows(columns);
+    });
+
+    it('331.7.3 Negative - matrix length is not a multiple of dims', async function() {
+      const columns = createColumns();
+      columns.vec32.values = columns.vec32.values.subarray(1);
+      await assert.rejects(
+        async () => await conn.executeMany(vecInsertSql, columns),
+        /NJS-005:/
+      );
+    });
+
+    it('331.7.4 Negative - matrix with the wrong number of rows', async function() {
+      const columns = createColumns();
+      columns.vec64.values = columns.vec64.values.subarray(dims);
+      await assert.rejects(
+        async () => await conn.executeMany(vecInsertSql, columns),
+        /NJS-197:/
+      );
+    });
+
+  });
+
+  it('331.8 Negative - Infinity in a Float64Array column', async function() {
+    for (const value of [Infinity, -Infinity]) {
+      const columns = {
+        intCol: new Int32Array([1, 2]),
+        bigIntCol: [1, 2],
+        numCol: new Float64Array([value, 1]),
+        strCol: ['a', 'b']
+      };
+      await assert.rejects(
+        async () => await conn.executeMany(insertSql, columns),
+        /NJS-115:/
+      );
+    }
+    const result = await conn.execute(`select count(*) from ${tableName}`);
+    assert.strictEqual(result.rows[0][0], 0);
+  });
+
+  it('331.9 Negative - non-integer in a Float64Array bound as BINARY_INTEGER', async function() {
+    const options = {
+      bindDefs: {
+        intCol: {type: oracledb.DB_TYPE_BINARY_INTEGER},
+        bigIntCol: {type: oracledb.NUMBER},
+        numCol: {type: oracledb.NUMBER},
+        strCol: {type: oracledb.STRING, maxSize: 20}
+      }
+    };
+    for (const value of [1.5, 2 ** 63, -(2 ** 64), Infinity, NaN]) {
+      const columns = {
+        intCol: new Float64Array([1, value]),
+        bigIntCol: [1, 2],
+        numCol: [1, 2],
+        strCol: ['a', 'b']
+      };
+      await assert.rejects(
+        async () => await conn.executeMany(insertSql, columns, options),
+        /NJS-198:/
+      );
+    }
+    const result = await conn.execute(`select count(*) from ${tableName}`);
+    assert.strictEqual(result.rows[0][0], 0);
+  });
+
+});
@@ -0,0 +1,178 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   332. executeManyStream.js
+ *
+ * DESCRIPTION
+ *   Testing connection.executeManyStream().
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const { Readable } = require('stream');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('332. executeManyStream.js', function() {
+
+  let conn;
+  const tableName = "nodb_executemany_stream";
+  const insertSql = `insert into ${tableName} values (:1, :2)`;
+  const bindDefs = [
+    { type: oracledb.NUMBER },
+    { type: oracledb.STRING, maxSize: 20 }
+  ];
+
+  async function* generateRows(numRows) {
+    for (let i = 1; i <= numRows; i++) {
+      yield [i, `String ${i}`];
+    }
+  }
+
+  async function getCount() {
+    const result = await conn.execute(`select count(*) from ${tableName}`);
+    return result.rows[0][0];
+  }
+
+  before(async function() {
+    conn = await oracledb.getConnection(dbConfig);
+    const sql = `create table ${tableName} (
+        IntCol number(9) not null,
+        StrCol varchar2(20),
+        constraint ${tableName}_pk primary key (IntCol)
+      )`;
+    await testsUtil.createTable(conn, tableName, sql);
+  });
+
+  after(async function() {
+    await testsUtil.dropTable(conn, tableName);
+    await conn.close();
+  });
+
+  afterEach(async function() {
+    await conn.execute(`truncate table ${tableName}`);
+  });
+
+  it('332.1 inserts rows from an async generator in batches', async function() {
+    const numRows = 2345;
+    const result = await conn.executeManyStream(insertSql,
+      generateRows(numRows), { batchSize: 500, bindDefs });
+    assert.strictEqual(result.rowsAffected, numRows);
+    assert.strictEqual(await getCount(), numRows);
+    const rows = (await conn.execute(`select IntCol, StrCol from ${tableName}
+      where IntCol in (1, 500, 501, 2345) order by IntCol`)).rows;
+    assert.deepStrictEqual(rows, [
+      [1, 'String 1'],
+      [500, 'String 500'],
+      [501, 'String 501'],
+      [2345, 'String 2345']
+    ]);
+  });
+
+  it('332.2 inserts rows from a Readable stream without bindDefs', async function() {
+    const rows = [];
+    for (let i = 1; i <= 25; i++)
+      rows.push({ id: i, str: (i % 3 === 0) ? null : `Row ${i}` });
+    const result = await conn.executeManyStream(
+      `insert into ${tableName} values (:id, :str)`, Readable.from(rows),
+      { batchSize: 10 });
+    assert.strictEqual(result.rowsAffected, rows.length);
+    assert.strictEqual(await getCount(), rows.length);
+  });
+
+  it('332.3 combines dmlRowCounts of all batches', async function() {
+    await conn.executeManyStream(insertSql, generateRows(30), { bindDefs });
+    const result = await conn.executeManyStream(
+      `delete from ${tableName} where IntCol <= :1`,
+      [[5], [10], [20], [40]], { batchSize: 3, dmlRowCounts: true });
+    assert.strictEqual(result.rowsAffected, 30);
+    assert.deepStrictEqual(result.dmlRowCounts, [5, 5, 10, 10]);
+  });
+
+  it('332.4 reports batch errors with offsets into the source', async function() {
+    const rows = [[1, 'A'], [2, 'B'], [3, 'C'], [2, 'D'], [5, 'E'], [1, 'F']];
+    const result = await conn.executeManyStream(insertSql, rows,
+      { batchSize: 2, batchErrors: true, bindDefs });
+    assert.strictEqual(result.rowsAffected, 4);
+    assert.deepStrictEqual(result.batchErrors.map(e => e.offset), [3, 5]);
+    for (const err of result.batchErrors)
+      assert.match(err.message, /ORA-00001:/);
+  });
+
+  it('332.5 commits once all batches are executed with autoCommit', async function() {
+    const conn2 = await oracledb.getConnection(dbConfig);
+    try {
+      await conn.executeManyStream(insertSql, generateRows(50),
+        { autoCommit: true, batchSize: 20, bindDefs });
+      const result = await conn2.execute(`select count(*) from ${tableName}`);
+      assert.strictEqual(result.rows[0][0], 50);
+    } finally {
+      await conn2.close();
+    }
+  });
+
+  it('332.6 returns zero rows affected for an empty source', async function() {
+    const result = await conn.executeManyStream(insertSql, generateRows(0),
+      { bindDefs });
+    assert.strictEqual(result.rowsAffected, 0);
+  });
+
+  it('332.7 stops reading the source when a batch fails', async function() {
+    const stream = Readable.from(generateRows(100));
+    await assert.rejects(
+      async () => await conn.executeManyStream(insertSql, stream,
+        { batchSize: 10, bindDefs: [bindDefs[0], { type: oracledb.STRING, maxSize: 5 }] }),
+      /NJS-|ORA-|DPI-/
+    );
+    assert.strictEqual(stream.destroyed, true);
+  });
+
+  it('332.8 Negative - invalid parameters', async function() {
+    await assert.rejects(
+      async () => await conn.executeManyStream(insertSql, 5),
+      /NJS-005:/
+    );
+    await assert.rejects(
+      async () => await conn.executeManyStream(insertSql, [], { batchSize: 0 }),
+      /NJS-007:/
+    );
+  });
+
+  it('332.9 inserts rows from a query stream on the same connection', async function() {
+    await conn.executeManyStream(insertSql, generateRows(250), { bindDefs });
+    const stream = conn.queryStream(`select IntCol + 1000, StrCol
+      from ${tableName} order by IntCol`, [], { fetchArraySize: 40 });
+    const result = await conn.executeManyStream(insertSql, stream,
+      { batchSize: 60, bindDefs });
+    assert.strictEqual(result.rowsAffected, 250);
+    assert.strictEqual(await getCount(), 500);
+    const rows = (await conn.execute(`select IntCol, StrCol from ${tableName}
+      where IntCol = 1250`)).rows;
+    assert.deepStrictEqual(rows, [[1250, 'String 250']]);
+  });
+
+});
@@ -87,6 +87,10 @@ describe("148. fetchArraySize1.js", function() {
       await checkGlobalOptionValue(1000000, 1000000);
     });
 
+    it("148.1.9 oracledb.fetchArraySize = 'auto'", async function() {
+      await checkGlobalOptionValue('auto', 'auto');
+    });
+
   });
 
   describe("148.2 execute() option fetchArraySize", function() {
@@ -123,6 +127,68 @@ describe("148. fetchArraySize1.js", function() {
       await checkExecOptionValue(1000000);
     });
 
+    it("148.2.9 fetchArraySize = 'auto'", async function() {
+      await checkExecOptionValue('auto');
+    });
+
+  });
+
+  describe("148.3 fetchArraySize = 'auto'", function() {
+
+    const numRows = 25000;
+    const sql = `select level, 'String ' || level from dual
+                 connect by level <= ${numRows}`;
+    const options = { fetchArraySize: 'auto' };
+
+    const checkRows = function(rows, count) {
+      assert.strictEqual(rows.length, count);
+      for (let i = 0; i < count; i++) {
+        assert.deepStrictEqual(rows[i], [i + 1, `String ${i + 1}`]);
+      }
+    };
+
+    it("148.3.1 fetches all rows with a direct fetch", async function() {
+      const result = await connection.execute(sql, [], options);
+      checkRows(result.rows, numRows);
+    });
+
+    it("148.3.2 respects maxRows", async function() {
+      const result = await connection.execute(sql, [],
+        { ...options, maxRows: 1234 });
+      checkRows(result.rows, 1234);
+    });
+
+    it("148.3.3 fetches all rows with resultSet.getRow()", async function() {
+      const result = await connection.execute(sql, [],
+        { ...options, resultSet: true });
+      const rs = result.resultSet;
+      const rows = [];
+      let row;
+      while ((row = await rs.getRow()))
+        rows.push(row);
+      await rs.close();
+      checkRows(rows, numRows);
+    });
+
+    it("148.3.4 fetches all rows with resultSet.getRows()", async function() {
+      const result = await connection.execute(sql, [],
+        { ...options, resultSet: true });
+      const rs = result.resultSet;
+      const rows = await rs.getRows();
+      await rs.close();
+      checkRows(rows, numRows);
+    });
+
+    it("148.3.5 can be set globally", async function() {
+      oracledb.fetchArraySize = 'auto';
+      try {
+        const result = await connection.execute(sql);
+        checkRows(result.rows, numRows);
+      } finally {
+        oracledb.fetchArraySize = defaultVal;
+      }
+    });
+
   });
 
   const checkGlobalOptionValue = async function(values, expectedFetchArraySize) {
@@ -0,0 +1,181 @@
+/* Copyright (c) 2025, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at https://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   337. jsonFetchMode.js
+ *
+ * DESCRIPTION
+ *   Fetching JSON columns with jsonFetchMode set to "lazy".
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('337. jsonFetchMode.js', function() {
+
+  let conn;
+  const tableName = "nodb_json_fetch_mode";
+  const docs = [
+    {
+      id: 1,
+      name: "first",
+      tags: ["a", "b", { deep: [1, 2, { leaf: null }] }],
+      nested: { value: 1.5, flag: true }
+    },
+    [1, "two", { three: 3 }],
+    "scalar",
+    { toJSON: 5, nested: { toJSON: "value" } }
+  ];
+
+  before(async function() {
+    if (!oracledb.thin ||
+        !await testsUtil.checkPrerequisites(2100000000, 2100000000))
+      this.skip();
+    conn = await oracledb.getConnection(dbConfig);
+    const sql = `create table ${tableName} (
+        IntCol number(9) not null,
+        JsonCol json
+      )`;
+    await testsUtil.createTable(conn, tableName, sql);
+    const binds = docs.map((doc, i) => [i + 1, doc]);
+    binds.push([docs.length + 1, null]);
+    await conn.executeMany(`insert into ${tableName} values (:1, :2)`, binds,
+      { bindDefs: [{ type: oracledb.NUMBER },
+        { type: oracledb.DB_TYPE_JSON }] });
+    await conn.commit();
+  });
+
+  after(async function() {
+    oracledb.jsonFetchMode = "eager";
+    if (conn) {
+      await testsUtil.dropTable(conn, tableName);
+      await conn.close();
+    }
+  });
+
+  it('337.1 fetches JSON values lazily with the execute option', async function() {
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} order by IntCol`, [],
+      { jsonFetchMode: "lazy" });
+    const doc = result.rows[0][0];
+    assert.strictEqual(doc.name, "first");
+    assert.strictEqual(doc.id, 1);
+    assert.strictEqual(doc.nested.value, 1.5);
+    assert.strictEqual(doc.tags.length, 3);
+    assert.strictEqual(doc.tags[2].deep[2].leaf, null);
+    assert.strictEqual(doc.missing, undefined);
+    assert.strictEqual(result.rows[1][0][2].three, 3);
+    assert.strictEqual(result.rows[2][0], "scalar");
+    assert.strictEqual(result.rows[docs.length][0], null);
+  });
+
+  it('337.2 lazy values behave like the fully decoded values', async function() {
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} order by IntCol`, [],
+      { jsonFetchMode: "lazy" });
+    const doc = result.rows[0][0];
+    assert.deepStrictEqual(Object.keys(doc),
+      ["id", "name", "tags", "nested"]);
+    assert("name" in doc);
+    assert(!("missing" in doc));
+    assert(Array.isArray(doc.tags));
+    assert.deepStrictEqual(doc.tags.slice(0, 2), ["a", "b"]);
+    assert.deepStrictEqual([...result.rows[1][0]].length, 3);
+    assert.strictEqual(doc.tags, doc.tags);
+    assert.deepStrictEqual(doc, docs[0]);
+    assert.deepStrictEqual(doc.toJSON(), docs[0]);
+    assert.deepStrictEqual(JSON.parse(JSON.stringify(doc)), docs[0]);
+  });
+
+  it('337.3 lazy values are read-only', async function() {
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} where IntCol = 1`, [],
+      { jsonFetchMode: "lazy" });
+    const doc = result.rows[0][0];
+    assert.throws(() => { doc.name = "changed"; }, TypeError);
+    assert.throws(() => { delete doc.name; }, TypeError);
+    assert.throws(() => doc.tags.push("c"), TypeError);
+    assert.strictEqual(doc.name, "first");
+  });
+
+  it('337.4 fetches JSON values lazily with oracledb.jsonFetchMode', async function() {
+    oracledb.jsonFetchMode = "lazy";
+    try {
+      const result = await conn.execute(
+        `select JsonCol from ${tableName} where IntCol = 1`);
+      assert.strictEqual(result.rows[0][0].nested.flag, true);
+      const eager = await conn.execute(
+        `select JsonCol from ${tableName} where IntCol = 1`, [],
+        { jsonFetchMode: "eager" });
+      assert.deepStrictEqual(eager.rows[0][0], docs[0]);
+    } finally {
+      oracledb.jsonFetchMode = "eager";
+    }
+  });
+
+  it('337.5 fetches JSON values lazily from a result set', async function() {
+    const result = await conn.execute(
+      `select IntCol, JsonCol from ${tableName} order by IntCol`, [],
+      { jsonFetchMode: "lazy", resultSet: true, fetchArraySize: 1,
+        outFormat: oracledb.OUT_FORMAT_OBJECT });
+    const rows = [];
+    let row;
+    while ((row = await result.resultSet.getRow()))
+      rows.push(row);
+    await result.resultSet.close();
+    assert.strictEqual(rows.length, docs.length + 1);
+    assert.strictEqual(rows[0].JSONCOL.tags[1], "b");
+    assert.deepStrictEqual(rows[1].JSONCOL.toJSON(), docs[1]);
+  });
+
+  it('337.6 Negative - invalid values of jsonFetchMode', async function() {
+    assert.throws(() => { oracledb.jsonFetchMode = "other"; }, /NJS-004:/);
+    assert.throws(() => { oracledb.jsonFetchMode = true; }, /NJS-004:/);
+    await assert.rejects(
+      async () => await conn.execute(`select JsonCol from ${tableName}`, [],
+        { jsonFetchMode: "other" }),
+      /NJS-007:/
+    );
+    assert.strictEqual(oracledb.jsonFetchMode, "eager");
+  });
+
+  it('337.7 fields named toJSON are returned like other fields', async function() {
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} where IntCol = 4`, [],
+      { jsonFetchMode: "lazy" });
+    const doc = result.rows[0][0];
+    assert.strictEqual(doc.toJSON, 5);
+    assert.strictEqual(doc.nested.toJSON, "value");
+    assert.deepStrictEqual(Object.keys(doc), ["toJSON", "nested"]);
+    assert.deepStrictEqual(JSON.parse(JSON.stringify(doc)), docs[3]);
+    const eager = await conn.execute(
+      `select JsonCol from ${tableName} where IntCol = 4`);
+    assert.deepStrictEqual(eager.rows[0][0], docs[3]);
+  });
+
+});
@@ -0,0 +1,156 @@
+/* Copyright (c) 2025, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at https://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   336. jsonOsonImage.js
+ *
+ * DESCRIPTION
+ *   Fetching JSON columns as OSON images and binding OSON images unchanged.
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('336. jsonOsonImage.js', function() {
+
+  let conn;
+  const tableName = "nodb_json_oson_image";
+  const docs = [
+    { id: 1, name: "first", tags: ["a", "b"], nested: { value: 1.5 } },
+    { id: 2, name: "second", flag: true, empty: null },
+    [1, 2, 3, "four"],
+    "just a string"
+  ];
+
+  before(async function() {
+    if (!await testsUtil.checkPrerequisites(2100000000, 2100000000))
+      this.skip();
+    conn = await oracledb.getConnection(dbConfig);
+    const sql = `create table ${tableName} (
+        IntCol number(9) not null,
+        JsonCol json
+      )`;
+    await testsUtil.createTable(conn, tableName, sql);
+  });
+
+  after(async function() {
+    if (conn) {
+      await testsUtil.dropTable(conn, tableName);
+      await conn.close();
+    }
+  });
+
+  beforeEach(async function() {
+    await conn.execute(`delete from ${tableName}`);
+    const binds = docs.map((doc, i) => [i + 1, doc]);
+    binds.push([docs.length + 1, null]);
+    await conn.executeMany(`insert into ${tableName} values (:1, :2)`, binds,
+      { bindDefs: [{ type: oracledb.NUMBER },
+        { type: oracledb.DB_TYPE_JSON }] });
+    await conn.commit();
+  });
+
+  it('336.1 fetches JSON columns as OSON images with fetchInfo', async function() {
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} order by IntCol`, [],
+      { fetchInfo: { JSONCOL: { type: oracledb.DB_TYPE_RAW } } });
+    assert.strictEqual(result.rows.length, docs.length + 1);
+    for (let i = 0; i < docs.length; i++) {
+      const image = result.rows[i][0];
+      assert(image instanceof oracledb.OsonImage);
+      assert(image instanceof Uint8Array);
+      assert.deepStrictEqual(conn.decodeOSON(image), docs[i]);
+    }
+    assert.strictEqual(result.rows[docs.length][0], null);
+  });
+
+  it('336.2 fetches JSON columns as OSON images with a fetch type handler', async function() {
+    const result = await conn.execute(
+      `select IntCol, JsonCol from ${tableName} order by IntCol`, [],
+      {
+        fetchTypeHandler: function(metadata) {
+          if (metadata.dbType === oracledb.DB_TYPE_JSON)
+            return { type: oracledb.BUFFER };
+        }
+      });
+    const image = result.rows[0][1];
+    assert(image instanceof oracledb.OsonImage);
+    assert.deepStrictEqual(conn.decodeOSON(image), docs[0]);
+  });
+
+  it('336.3 binds OSON images unchanged', async function() {
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} order by IntCol`, [],
+      { fetchInfo: { JSONCOL: { type: oracledb.DB_TYPE_RAW } } });
+    await conn.execute(`delete from ${tableName}`);
+    for (let i = 0; i < docs.length; i++) {
+      await conn.execute(`insert into ${tableName} values (:1, :2)`,
+        [i + 1, result.rows[i][0]]);
+    }
+    await conn.execute(`insert into ${tableName} values (:1, :2)`,
+      [docs.length + 1, { type: oracledb.DB_TYPE_JSON,
+        val: result.rows[0][0] }]);
+    const copy = await conn.execute(
+      `select JsonCol from ${tableName} order by IntCol`);
+    const expected = docs.map(doc => [doc]);
+    expected.push([docs[0]]);
+    assert.deepStrictEqual(copy.rows, expected);
+  });
+
+  it('336.4 binds OSON images created from encodeOSON()', async function() {
+    const doc = { key: "value", numbers: [1, 2, 3] };
+    const buf = conn.encodeOSON(doc);
+    const image = new oracledb.OsonImage(buf.buffer, buf.byteOffset,
+      buf.length);
+    await conn.execute(`insert into ${tableName} values (:1, :2)`,
+      [100, image]);
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} where IntCol = 100`);
+    assert.deepStrictEqual(result.rows[0][0], doc);
+  });
+
+  it('336.5 fetches JSON columns as text', async function() {
+    const result = await conn.execute(
+      `select JsonCol from ${tableName} order by IntCol`, [],
+      { fetchInfo: { JSONCOL: { type: oracledb.STRING } } });
+    for (let i = 0; i < docs.length; i++) {
+      assert.strictEqual(typeof result.rows[i][0], 'string');
+      assert.deepStrictEqual(JSON.parse(result.rows[i][0]), docs[i]);
+    }
+  });
+
+  it('336.6 Negative - OSON images bound to other types', async function() {
+    const image = new oracledb.OsonImage(conn.encodeOSON({ a: 1 }));
+    await assert.rejects(
+      async () => await conn.execute(`select :1 from dual`,
+        [{ type: oracledb.STRING, val: image }]),
+      /NJS-011:/
+    );
+  });
+
+});
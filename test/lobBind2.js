@@ -626,5 +626,141 @@ describe("72. lobBind2.js", function() {
       assert.strictEqual(result.rows[0][0], 0);
     }); // 72.5.1
 
+    it('72.5.2 executeMany with Strings and Buffers larger than the chunk size', async () => {
+      const text = "A".repeat(100000);
+      const buf = Buffer.alloc(150000, 0x5a);
+      const binds = [];
+      for (let i = 0; i < 5; i++) {
+        binds.push([200 + i, text + i, Buffer.concat([buf, Buffer.from([i])])]);
+      }
+      const sql = `INSERT INTO ${tableName}(ID, CLOB, BLOB) VALUES (:1, :2, :3)`;
+      const options = {
+        bindDefs: [
+          {type: oracledb.NUMBER},
+          {type: oracledb.CLOB},
+          {type: oracledb.BLOB}
+        ]
+      };
+      const result = await connection.executeMany(sql, binds, options);
+      assert.strictEqual(result.rowsAffected, binds.length);
+      const query = `SELECT id, clob, blob FROM ${tableName}
+                     WHERE id >= 200 ORDER BY id`;
+      const queryResult = await connection.execute(query, [],
+        {fetchInfo: {CLOB: {type: oracledb.STRING},
+          BLOB: {type: oracledb.BUFFER}}});
+      assert.deepStrictEqual(queryResult.rows, binds);
+    }); // 72.5.2
+
+  });
+
+  describe('72.6 connection.createLobs()', () => {
+
+    let connection;
+
+    const tableName = "nodb_test_createlobs";
+
+    before(async () => {
+      connection = await oracledb.getConnection(dbConfig);
+      const sql = `CREATE TABLE ${tableName} (id NUMBER, clob CLOB, blob BLOB)`;
+      await testsUtil.createTable(connection, tableName, sql);
+    }); // before()
+
+    after(async () => {
+      await testsUtil.dropTable(connection, tableName);
+      await connection.close();
+    }); // after()
+
+    it('72.6.1 creates an array of empty temporary LOBs', async () => {
+      const lobs = await connection.createLobs(oracledb.CLOB, 5);
+      assert.strictEqual(lobs.length, 5);
+      for (const lob of lobs) {
+        assert(lob instanceof oracledb.Lob);
+        assert.strictEqual(lob.type, oracledb.CLOB);
+        assert.strictEqual(lob.length, 0);
+        assert.strictEqual(lob.chunkSize, lobs[0].chunkSize);
+        assert(lob.chunkSize > 0);
+        await lob.destroy();
+      }
+    }); // 72.6.1
+
+    it('72.6.2 returns an empty array when count is zero', async () => {
+      const lobs = await connection.createLobs(oracledb.BLOB, 0);
+      assert.deepStrictEqual(lobs, []);
+    }); // 72.6.2
+
+    it('72.6.3 LOBs can be populated and bound to executeMany()', async () => {
+      const numRows = 10;
+      const clobs = await connection.createLobs(oracledb.CLOB, numRows);
+      const blobs = await connection.createLobs(oracledb.BLOB, numRows);
+      const binds = [];
+      const expected = [];
+      for (let i = 0; i < numRows; i++) {
+        const text = `Row ${i} `.repeat(1000);
+        const buf = Buffer.alloc(5000 + i, i);
+        await clobs[i].write(text);
+        await blobs[i].write(buf);
+        binds.push([i, clobs[i], blobs[i]]);
+        expected.push([i, text, buf]);
+      }
+      const sql = `INSERT INTO ${tableName} VALUES (:1, :2, :3)`;
+      const result = await connection.executeMany(sql, binds);
+      assert.strictEqual(result.rowsAffected, numRows);
+      for (let i = 0; i < numRows; i++) {
+        await clobs[i].destroy();
+        await blobs[i].destroy();
+      }
+      const queryResult = await connection.execute(
+        `SELECT id, clob, blob FROM ${tableName} ORDER BY id`, [],
+        {fetchInfo: {CLOB: {type: oracledb.STRING},
+          BLOB: {type: oracledb.BUFFER}}});
+      assert.deepStrictEqual(queryResult.rows, expected);
+    }); // 72.6.3
+
+    it('72.6.4 Negative - invalid parameters', async () => {
+      await assert.rejects(
+        async () => await connection.createLobs(oracledb.CLOB),
+        /NJS-009:/
+      );
+      await assert.rejects(
+        async () => await connection.createLobs(oracledb.STRING, 2),
+        /NJS-005:/
+      );
+      await assert.rejects(
+        async () => await connection.createLobs(oracledb.CLOB, -1),
+        /NJS-005:/
+      );
+      await assert.rejects(
+        async () => await connection.createLobs(oracledb.CLOB, 1.5),
+        /NJS-005:/
+      );
+    }); // 72.6.4
+
+    it('72.6.5 Negative - LOBs already created are closed on failure', async function() {
+      if (!oracledb.thin)
+        this.skip();
+      const ThinLobImpl = require('../lib/thin/lob.js');
+      const origCreate = ThinLobImpl.prototype.create;
+      let numCreated = 0;
+      ThinLobImpl.prototype.create = async function() {
+        if (++numCreated > 3)
+          throw new Error('create failed');
+        return await origCreate.apply(this, arguments);
+      };
+      try {
+        await assert.rejects(
+          async () => await connection.createLobs(oracledb.CLOB, 5),
+          /create failed/
+        );
+      } finally {
+        ThinLobImpl.prototype.create = origCreate;
+      }
+      assert.strictEqual(numCreated, 4);
+      const sid = await testsUtil.getSid(connection);
+      const query = `select cache_lobs+nocache_lobs from v$temporary_lobs
+                     where sid = :SID`;
+      const result = await connection.execute(query, {SID: sid});
+      assert.strictEqual(result.rows[0][0], 0);
+    }); // 72.6.5
+
   });
 });
@@ -34,6 +34,8 @@
 
 const oracledb = require('oracledb');
 const fs       = require('fs');
+const { Readable } = require('stream');
+const { pipeline } = require('stream/promises');
 const assert   = require('assert');
 const dbConfig = require('./dbconfig.js');
 
@@ -259,4 +261,97 @@ describe('62. lobProperties1.js', function() {
     await blob.close();
   }); // 62.10
 
+  it('62.11 readAhead - default value and invalid values', async function() {
+    const result = await connection.execute(sqlSelect, { i: 1 });
+    const clob = result.rows[0][1];
+    const blob = result.rows[0][2];
+    assert.strictEqual(clob.readAhead, 0);
+    assert.strictEqual(blob.readAhead, 0);
+    for (const value of [-1, null, NaN, 1.5, "2"]) {
+      assert.throws(
+        () => blob.readAhead = value,
+        /NJS-004:/
+      );
+    }
+    blob.readAhead = 3;
+    assert.strictEqual(blob.readAhead, 3);
+    await clob.close();
+    await blob.close();
+  }); // 62.11
+
+  it('62.12 readAhead - streamed data is unchanged', async function() {
+    const result = await connection.execute(sqlSelect, { i: 1 });
+    const clob = result.rows[0][1];
+    const blob = result.rows[0][2];
+    clob.setEncoding('utf8');
+    clob.pieceSize = 50;
+    clob.readAhead = 2;
+    blob.pieceSize = 1000;
+    blob.readAhead = 4;
+    const clobPieces = [];
+    for await (const piece of clob) {
+      clobPieces.push(piece);
+    }
+    const blobPieces = [];
+    for await (const piece of blob) {
+      blobPieces.push(piece);
+    }
+    assert.strictEqual(clobPieces.join(''),
+      fs.readFileSync('./test/clobexample.txt', 'utf8'));
+    assert.deepStrictEqual(Buffer.concat(blobPieces),
+      fs.readFileSync('./test/fuzzydinosaur.jpg'));
+  }); // 62.12
+
+  it('62.13 writeBufferSize - default value and invalid values', async function() {
+    const result = await connection.execute(sqlSelect, { i: 1 });
+    const clob = result.rows[0][1];
+    const blob = result.rows[0][2];
+    assert.strictEqual(clob.writeBufferSize, 0);
+    assert.strictEqual(blob.writeBufferSize, 0);
+    for (const value of [-1, null, NaN, 1.5, "2"]) {
+      assert.throws(
+        () => clob.writeBufferSize = value,
+        /NJS-004:/
+      );
+    }
+    clob.writeBufferSize = 65536;
+    assert.strictEqual(clob.writeBufferSize, 65536);
+    await clob.close();
+    await blob.close();
+  }); // 62.13
+
+  it('62.14 writeBufferSize - written data is unchanged', async function() {
+    const sqlInsert = `INSERT INTO ${tableName}
+                       VALUES (:i, EMPTY_CLOB(), EMPTY_BLOB())
+                       RETURNING c, b INTO :clob, :blob`;
+    const bindVar = {
+      i: 2,
+      clob: { type: oracledb.CLOB, dir: oracledb.BIND_OUT },
+      blob: { type: oracledb.BLOB, dir: oracledb.BIND_OUT }
+    };
+    const clobData = 'abcdefghij'.repeat(5000);
+    const blobData = Buffer.alloc(70000);
+    for (let i = 0; i < blobData.length; i++)
+      blobData[i] = i % 256;
+    let result = await connection.execute(sqlInsert, bindVar);
+    const clob = result.outBinds.clob[0];
+    const blob = result.outBinds.blob[0];
+    clob.writeBufferSize = clob.chunkSize * 2;
+    blob.writeBufferSize = blob.chunkSize * 2;
+    const clobPieces = [];
+    for (let i = 0; i < clobData.length; i += 1000)
+      clobPieces.push(clobData.slice(i, i + 1000));
+    const blobPieces = [];
+    for (let i = 0; i < blobData.length; i += 1000)
+      blobPieces.push(blobData.subarray(i, i + 1000));
+    await pipeline(Readable.from(clobPieces), clob);
+    await pipeline(Readable.from(blobPieces), blob);
+    result = await connection.execute(sqlSelect, { i: 2 },
+      { fetchInfo: { C: { type: oracledb.STRING },
+        B: { type: oracledb.BUFFER } } });
+    assert.strictEqual(result.rows[0][1], clobData);
+    assert.deepStrictEqual(result.rows[0][2], blobData);
+    await connection.rollback();
+  }); // 62.14
+
 });
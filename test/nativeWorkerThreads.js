@@ -0,0 +1,136 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at https://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   339. nativeWorkerThreads.js
+ *
+ * DESCRIPTION
+ *   Using the native worker pool in Thick mode. Since the number of threads
+ *   is read when Thick mode is enabled, each test runs in a child process.
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const path      = require('path');
+const { execFile } = require('child_process');
+
+// enables Thick mode in this process when Thick mode tests are being run
+require('./dbconfig.js');
+
+describe('339. nativeWorkerThreads.js', function() {
+
+  this.timeout(120000);
+
+  before(function() {
+    if (oracledb.thin)
+      this.skip();
+  });
+
+  // runs the script in a child process which enables Thick mode with the
+  // given number of native worker threads and returns its JSON output
+  const runChild = function(numThreads, script) {
+    const code = `
+      const oracledb = require('oracledb');
+      oracledb.nativeWorkerThreads = ${numThreads};
+      const dbConfig = require(${JSON.stringify(path.join(__dirname, 'dbconfig.js'))});
+      const connAttrs = {
+        user: dbConfig.user,
+        password: dbConfig.password,
+        connectString: dbConfig.connectString
+      };
+      (async function() {
+        ${script}
+      })().then(
+        (result) => process.stdout.write('\\n' + JSON.stringify(result)),
+        (err) => { console.error(err); process.exitCode = 1; }
+      );`;
+    return new Promise((resolve, reject) => {
+      execFile(process.execPath, ['-e', code], { env: process.env },
+        (err, stdout) => {
+          if (err)
+            return reject(err);
+          const lines = stdout.trim().split('\n');
+          resolve(JSON.parse(lines[lines.length - 1]));
+        });
+    });
+  };
+
+  it('339.1 queries complete while pools acquire connections concurrently', async function() {
+    const result = await runChild(1, `
+      const pools = [];
+      for (let i = 0; i < 2; i++) {
+        pools.push(await oracledb.createPool({
+          ...connAttrs, poolMin: 0, poolMax: 4, poolIncrement: 1,
+          enableStatistics: true
+        }));
+      }
+      const acquires = [];
+      for (const pool of pools) {
+        for (let i = 0; i < 4; i++)
+          acquires.push(pool.getConnection());
+      }
+      const conn = await oracledb.getConnection(connAttrs);
+      const rows = [];
+      for (let i = 0; i < 5; i++) {
+        const result = await conn.execute('select :1 from dual', [i]);
+        rows.push(result.rows[0][0]);
+      }
+      const conns = await Promise.all(acquires);
+      const stats = pools[0].getStatistics();
+      for (const c of conns)
+        await c.close();
+      await conn.close();
+      for (const pool of pools)
+        await pool.close(0);
+      return {
+        rows: rows,
+        numConns: conns.length,
+        threads: stats.nativeWorkerThreads,
+        poolQueueLength: stats.nativeWorkerPoolQueueLength
+      };
+    `);
+    assert.deepStrictEqual(result.rows, [0, 1, 2, 3, 4]);
+    assert.strictEqual(result.numConns, 8);
+    assert.strictEqual(result.threads, 2);
+    assert.strictEqual(result.poolQueueLength, 0);
+  });
+
+  it('339.2 process exits after work completes', async function() {
+    const result = await runChild(4, `
+      const conn = await oracledb.getConnection(connAttrs);
+      const results = await Promise.all([1, 2, 3].map(async (i) => {
+        const c = await oracledb.getConnection(connAttrs);
+        const result = await c.execute('select :1 from dual', [i]);
+        await c.close();
+        return result.rows[0][0];
+      }));
+      await conn.close();
+      return results;
+    `);
+    assert.deepStrictEqual(result, [1, 2, 3]);
+  });
+
+});
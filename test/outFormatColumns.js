@@ -0,0 +1,222 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   329. outFormatColumns.js
+ *
+ * DESCRIPTION
+ *   Testing fetching rows in column format with OUT_FORMAT_COLUMNS.
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('329. outFormatColumns.js', function() {
+
+  let conn;
+  const tableName = "nodb_outformat_columns";
+  const numRows = 253;
+  const options = { outFormat: oracledb.OUT_FORMAT_COLUMNS };
+  const sql = `select IntCol, BigIntCol, NumCol, DateCol, StrCol
+               from ${tableName} order by IntCol`;
+
+  function isNull(column, i) {
+    return (column.nulls[i >> 3] & (1 << (i & 7))) !== 0;
+  }
+
+  before(async function() {
+    conn = await oracledb.getConnection(dbConfig);
+    const createSql = `create table ${tableName} (
+        IntCol number(9) not null,
+        BigIntCol number(18),
+        NumCol number,
+        DateCol date,
+        StrCol varchar2(20)
+      )`;
+    await testsUtil.createTable(conn, tableName, createSql);
+    const binds = [];
+    for (let i = 1; i <= numRows; i++) {
+      binds.push([
+        i,
+        (i % 7 === 0) ? null : 1234567890123 + i,
+        (i % 5 === 0) ? null : i + 0.25,
+        (i % 3 === 0) ? null : new Date(2024, 0, 1, 0, 0, i),
+        (i % 2 === 0) ? null : `String ${i}`
+      ]);
+    }
+    await conn.executeMany(`insert into ${tableName}
+        values (:1, :2, :3, :4, :5)`, binds);
+    await conn.commit();
+  });
+
+  after(async function() {
+    await testsUtil.dropTable(conn, tableName);
+    await conn.close();
+  });
+
+  function checkColumns(result, startRow, count) {
+    assert.strictEqual(result.numRows, count);
+    const [intCol, bigIntCol, numCol, dateCol, strCol] = result.columns;
+    assert(intCol.values instanceof Int32Array);
+    assert(bigIntCol.values instanceof BigInt64Array);
+    assert(numCol.values instanceof Float64Array);
+    assert(dateCol.values instanceof Float64Array);
+    assert(Array.isArray(strCol.values));
+    for (let i = 0; i < count; i++) {
+      const val = startRow + i;
+      assert.strictEqual(intCol.values[i], val);
+      assert.strictEqual(isNull(intCol, i), false);
+      if (val % 7 === 0) {
+        assert.strictEqual(isNull(bigIntCol, i), true);
+        assert.strictEqual(bigIntCol.values[i], 0n);
+      } else {
+        assert.strictEqual(bigIntCol.values[i], BigInt(1234567890123 + val));
+      }
+      assert.strictEqual(isNull(numCol, i), val % 5 === 0);
+      if (val % 5 !== 0)
+        assert.strictEqual(numCol.values[i], val + 0.25);
+      assert.strictEqual(isNull(dateCol, i), val % 3 === 0);
+      if (val % 3 !== 0)
+        assert.strictEqual(dateCol.values[i],
+          new Date(2024, 0, 1, 0, 0, val).getTime());
+      if (val % 2 === 0) {
+        assert.strictEqual(isNull(strCol, i), true);
+        assert.strictEqual(strCol.values[i], null);
+      } else {
+        assert.strictEqual(strCol.values[i], `String ${val}`);
+      }
+    }
+  }
+
+  it('329.1 fetches all rows in column format', async function() {
+    const result = await conn.execute(sql, [], options);
+    checkColumns(result.rows, 1, numRows);
+  });
+
+  it('329.2 fetches all rows with a small fetchArraySize', async function() {
+    const result = await conn.execute(sql, [],
+      { ...options, fetchArraySize: 17 });
+    checkColumns(result.rows, 1, numRows);
+  });
+
+  it('329.3 respects maxRows', async function() {
+    const result = await conn.execute(sql, [], { ...options, maxRows: 40 });
+    checkColumns(result.rows, 1, 40);
+  });
+
+  it('329.4 fetches batches with resultSet.getRows()', async function() {
+    const result = await conn.execute(sql, [],
+      { ...options, resultSet: true });
+    const rs = result.resultSet;
+    let startRow = 1;
+    while (true) {
+      const batch = await rs.getRows(50);
+      checkColumns(batch, startRow, Math.min(50, numRows - startRow + 1));
+      startRow += batch.numRows;
+      if (batch.numRows < 50)
+        break;
+    }
+    assert.strictEqual(startRow, numRows + 1);
+    await rs.close();
+  });
+
+  it('329.5 fetches remaining rows with resultSet.getRows()', async function() {
+    const result = await conn.execute(sql, [],
+      { ...options, resultSet: true, fetchArraySize: 30 });
+    const rs = result.resultSet;
+    checkColumns(await rs.getRows(10), 1, 10);
+    checkColumns(await rs.getRows(), 11, numRows - 10);
+    await rs.close();
+  });
+
+  it('329.6 returns empty columns when no rows are fetched', async function() {
+    const result = await conn.execute(`${sql.replace('order by',
+      'where 1 = 0 order by')}`, [], options);
+    assert.strictEqual(result.rows.numRows, 0);
+    assert.strictEqual(result.rows.columns.length, 5);
+    assert.strictEqual(result.rows.columns[0].values.length, 0);
+  });
+
+  it('329.7 uses a regular array when a converter is specified', async function() {
+    const result = await conn.execute(sql, [], {
+      ...options,
+      fetchTypeHandler: function(metadata) {
+        if (metadata.name === 'INTCOL')
+          return {converter: (v) => (v === null) ? v : v * 2};
+      }
+    });
+    const values = result.rows.columns[0].values;
+    assert(Array.isArray(values));
+    assert.strictEqual(values[0], 2);
+    assert.strictEqual(values[numRows - 1], numRows * 2);
+  });
+
+  it('329.8 returns strings in a regular array with fetchInfo', async function() {
+    const result = await conn.execute(sql, [], {
+      ...options,
+      fetchInfo: { "NUMCOL": { type: oracledb.STRING } }
+    });
+    const values = result.rows.columns[2].values;
+    assert(Array.isArray(values));
+    assert.strictEqual(values[0], '1.25');
+  });
+
+  it('329.9 getRow() is not supported', async function() {
+    const result = await conn.execute(sql, [],
+      { ...options, resultSet: true });
+    const rs = result.resultSet;
+    await assert.rejects(
+      async () => await rs.getRow(),
+      /NJS-194:/
+    );
+    await rs.close();
+  });
+
+  it('329.10 toQueryStream() is not supported', async function() {
+    const result = await conn.execute(sql, [],
+      { ...options, resultSet: true });
+    const rs = result.resultSet;
+    assert.throws(
+      () => rs.toQueryStream(),
+      /NJS-194:/
+    );
+    await rs.close();
+  });
+
+  it('329.11 can be set globally', async function() {
+    const origOutFormat = oracledb.outFormat;
+    oracledb.outFormat = oracledb.OUT_FORMAT_COLUMNS;
+    try {
+      const result = await conn.execute(sql);
+      checkColumns(result.rows, 1, numRows);
+    } finally {
+      oracledb.outFormat = origOutFormat;
+    }
+  });
+
+});
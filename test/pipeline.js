@@ -1885,6 +1885,37 @@ describe('324. pipeline.js', function() {
 
       assert.strictEqual(data, clobData);
     }); // 324.3.40
+
+    it('324.3.41 operations after an error are not executed', async function() {
+      const pipeline = new oracledb.Pipeline();
+
+      await conn.execute(`truncate table ${TEST_TAB}`);
+      await conn.commit();
+
+      pipeline.addExecute(
+        `insert into ${TEST_TAB} (id, address) values (1, 'first')`
+      );
+
+      // intentional error
+      pipeline.addExecute(
+        `insert into ${TEST_TAB} (id, address, extra) values (2, 'bad', 'x')`
+      );
+
+      pipeline.addExecute(
+        `insert into ${TEST_TAB} (id, address) values (3, 'third')`
+      );
+
+      await assert.rejects(
+        async () => await conn.runPipeline(pipeline),
+        /ORA-00904:/
+      );
+
+      const result = await conn.execute(
+        `select id from ${TEST_TAB} order by id`
+      );
+      assert.deepStrictEqual(result.rows, [[1]]);
+      await conn.rollback();
+    }); // 324.3.41
   }); // 324.3
 
   describe('324.4 Negative scenarios', () => {
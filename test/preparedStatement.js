@@ -0,0 +1,202 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   330. preparedStatement.js
+ *
+ * DESCRIPTION
+ *   Testing reusable prepared statements created with connection.prepare().
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('330. preparedStatement.js', function() {
+
+  let conn;
+  const tableName = "nodb_prepared_stmt";
+
+  before(async function() {
+    conn = await oracledb.getConnection(dbConfig);
+    const sql = `create table ${tableName} (
+        IntCol number(9) not null,
+        StrCol varchar2(50),
+        DateCol date
+      )`;
+    await testsUtil.createTable(conn, tableName, sql);
+  });
+
+  after(async function() {
+    await testsUtil.dropTable(conn, tableName);
+    await conn.close();
+  });
+
+  beforeEach(async function() {
+    await conn.execute(`truncate table ${tableName}`);
+  });
+
+  it('330.1 executes an insert statement repeatedly', async function() {
+    const stmt = await conn.prepare(`insert into ${tableName}
+        (IntCol, StrCol) values (:1, :2)`);
+    assert(stmt instanceof oracledb.PreparedStatement);
+    for (let i = 1; i <= 25; i++) {
+      const result = await stmt.execute([i, `String ${i}`]);
+      assert.strictEqual(result.rowsAffected, 1);
+    }
+    await stmt.close();
+    const result = await conn.execute(`select count(*), sum(IntCol)
+        from ${tableName}`);
+    assert.deepStrictEqual(result.rows, [[25, 325]]);
+  });
+
+  it('330.2 reuses bind buffers with values of varying size', async function() {
+    const stmt = await conn.prepare(`insert into ${tableName}
+        (IntCol, StrCol) values (:id, :str)`);
+    const values = ['a', 'a longer string', null, 'b', 'x'.repeat(50)];
+    for (let i = 0; i < values.length; i++) {
+      await stmt.execute({id: i, str: values[i]});
+    }
+    await stmt.close();
+    const result = await conn.execute(`select StrCol from ${tableName}
+        order by IntCol`);
+    assert.deepStrictEqual(result.rows.map(r => r[0]), values);
+  });
+
+  it('330.3 uses bind definitions supplied when preparing', async function() {
+    const stmt = await conn.prepare(`insert into ${tableName}
+        (IntCol, StrCol, DateCol) values (:1, :2, :3)`, [
+      { type: oracledb.NUMBER },
+      { type: oracledb.STRING, maxSize: 50 },
+      { type: oracledb.DATE }
+    ]);
+    const date = new Date(2024, 1, 29, 10, 30, 0);
+    await stmt.execute([1, 'one', date]);
+    await stmt.execute([2, null, null]);
+    await stmt.execute([3, { val: 'three' }, date]);
+    await stmt.close();
+    const result = await conn.execute(`select IntCol, StrCol, DateCol
+        from ${tableName} order by IntCol`);
+    assert.deepStrictEqual(result.rows, [
+      [1, 'one', date],
+      [2, null, null],
+      [3, 'three', date]
+    ]);
+  });
+
+  it('330.4 executes a query repeatedly', async function() {
+    await conn.executeMany(`insert into ${tableName} (IntCol, StrCol)
+        values (:1, :2)`, [[1, 'one'], [2, 'two'], [3, 'three']]);
+    const stmt = await conn.prepare(`select StrCol from ${tableName}
+        where IntCol = :id`);
+    assert.strictEqual(stmt.sql.includes('select StrCol'), true);
+    for (let i = 0; i < 3; i++) {
+      const result = await stmt.execute({id: 2},
+        {outFormat: oracledb.OUT_FORMAT_OBJECT});
+      assert.deepStrictEqual(result.rows, [{STRCOL: 'two'}]);
+    }
+    const result = await stmt.execute([3]);
+    assert.deepStrictEqual(result.rows, [['three']]);
+    await stmt.close();
+  });
+
+  it('330.5 requires result sets to be closed before re-executing', async function() {
+    await conn.executeMany(`insert into ${tableName} (IntCol)
+        values (:1)`, [[1], [2], [3]]);
+    const stmt = await conn.prepare(`select IntCol from ${tableName}
+        order by IntCol`);
+    let result = await stmt.execute([], {resultSet: true});
+    assert.deepStrictEqual(await result.resultSet.getRow(), [1]);
+    await assert.rejects(
+      async () => await stmt.execute(),
+      /NJS-196:/
+    );
+    await assert.rejects(
+      async () => await stmt.close(),
+      /NJS-196:/
+    );
+    await result.resultSet.close();
+    result = await stmt.execute([], {resultSet: true});
+    assert.deepStrictEqual(await result.resultSet.getRows(), [[1], [2], [3]]);
+    await result.resultSet.close();
+    await stmt.close();
+  });
+
+  it('330.6 executes PL/SQL with OUT binds', async function() {
+    const stmt = await conn.prepare(`begin :out := :in * 2; end;`);
+    for (let i = 1; i <= 3; i++) {
+      const result = await stmt.execute({
+        in: i,
+        out: { dir: oracledb.BIND_OUT, type: oracledb.NUMBER }
+      });
+      assert.strictEqual(result.outBinds.out, i * 2);
+    }
+    await stmt.close();
+  });
+
+  it('330.7 cannot be executed after it is closed', async function() {
+    const stmt = await conn.prepare(`select 1 from dual`);
+    await stmt.close();
+    assert.strictEqual(stmt.sql, undefined);
+    await assert.rejects(
+      async () => await stmt.execute(),
+      /NJS-195:/
+    );
+    await assert.rejects(
+      async () => await stmt.close(),
+      /NJS-195:/
+    );
+  });
+
+  it('330.8 reports errors and remains usable', async function() {
+    const stmt = await conn.prepare(`insert into ${tableName}
+        (IntCol) values (:1)`);
+    await assert.rejects(
+      async () => await stmt.execute([null]),
+      /ORA-01400:/
+    );
+    const result = await stmt.execute([5]);
+    assert.strictEqual(result.rowsAffected, 1);
+    await stmt.close();
+  });
+
+  it('330.9 rejects invalid parameters', async function() {
+    await assert.rejects(
+      async () => await conn.prepare(),
+      /NJS-009:/
+    );
+    await assert.rejects(
+      async () => await conn.prepare(5),
+      /NJS-005:/
+    );
+    await assert.rejects(
+      async () => await conn.prepare('select 1 from dual', 'abc'),
+      /NJS-005:/
+    );
+  });
+
+});
@@ -487,6 +487,26 @@ describe('58. properties.js', function() {
         /NJS-004:/
       );
     });
+
+    it('58.1.44 nativeWorkerThreads', function() {
+      const t = oracledb.nativeWorkerThreads;
+      assert.strictEqual(t, 0);
+      oracledb.nativeWorkerThreads = 8;
+      assert.strictEqual(oracledb.nativeWorkerThreads, 8);
+      oracledb.nativeWorkerThreads = t;
+      assert.throws(
+        function() {
+          oracledb.nativeWorkerThreads = -1;
+        },
+        /NJS-004:/
+      );
+      assert.throws(
+        function() {
+          oracledb.nativeWorkerThreads = 2.5;
+        },
+        /NJS-004:/
+      );
+    });
   }); // 58.1
 
   describe('58.2 Pool Class', function() {
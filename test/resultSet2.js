@@ -546,6 +546,116 @@ describe('55. resultSet2.js', function() {
     });
   }); // 55.13
 
+  describe('55.14 fetching rows in the background with prefetchAhead', function() {
+    const sql = "SELECT * FROM nodb_rs2_emp ORDER BY employees_id";
+
+    before(async function() {
+      await setUp(connection, tableName);
+    });
+
+    after(async function() {
+      await clearUp(connection, tableName);
+    });
+
+    it('55.14.1 getRows() returns all rows in order', async function() {
+      const result = await connection.execute(sql, [],
+        { resultSet: true, fetchArraySize: 40, prefetchAhead: true });
+      const rs = result.resultSet;
+      let rows, numRows = 0;
+      do {
+        rows = await rs.getRows(40);
+        for (const row of rows) {
+          assert.strictEqual(row[0], ++numRows);
+        }
+      } while (rows.length === 40);
+      assert.strictEqual(numRows, rowsAmount);
+      await rs.close();
+    });
+
+    it('55.14.2 mixed getRow() and getRows() calls', async function() {
+      const result = await connection.execute(sql, [],
+        { resultSet: true, fetchArraySize: 25, prefetchAhead: true });
+      const rs = result.resultSet;
+      let row = await rs.getRow();
+      assert.strictEqual(row[0], 1);
+      let rows = await rs.getRows(60);
+      assert.strictEqual(rows.length, 60);
+      assert.strictEqual(rows[59][0], 61);
+      rows = await rs.getRows(7);
+      assert.deepStrictEqual(rows.map(r => r[0]), [62, 63, 64, 65, 66, 67, 68]);
+      row = await rs.getRow();
+      assert.strictEqual(row[0], 69);
+      rows = await rs.getRows();
+      assert.strictEqual(rows.length, rowsAmount - 69);
+      assert.strictEqual(rows[rows.length - 1][0], rowsAmount);
+      await rs.close();
+    });
+
+    it('55.14.3 other calls can be made on the connection', async function() {
+      const result = await connection.execute(sql, [],
+        { resultSet: true, fetchArraySize: 50, prefetchAhead: true });
+      const rs = result.resultSet;
+      const rows = await rs.getRows(50);
+      assert.strictEqual(rows[49][0], 50);
+      const countResult = await connection.execute(
+        "SELECT COUNT(*) FROM nodb_rs2_emp");
+      assert.strictEqual(countResult.rows[0][0], rowsAmount);
+      const row = await rs.getRow();
+      assert.strictEqual(row[0], 51);
+      await rs.close();
+    });
+
+    it('55.14.4 close the result set with a batch fetched ahead', async function() {
+      const result = await connection.execute(sql, [],
+        { resultSet: true, fetchArraySize: 10, prefetchAhead: true });
+      const rs = result.resultSet;
+      await rs.getRows(10);
+      await rs.close();
+      await assert.rejects(
+        async () => await rs.getRows(10),
+        /NJS-018:/
+      );
+      const countResult = await connection.execute(
+        "SELECT COUNT(*) FROM nodb_rs2_emp");
+      assert.strictEqual(countResult.rows[0][0], rowsAmount);
+    });
+
+    it('55.14.5 query streams fetch rows in the background', async function() {
+      for (const prefetchAhead of [undefined, false]) {
+        const options = { fetchArraySize: 30 };
+        if (prefetchAhead !== undefined)
+          options.prefetchAhead = prefetchAhead;
+        const stream = connection.queryStream(sql, [], options);
+        let numRows = 0;
+        for await (const row of stream) {
+          assert.strictEqual(row[0], ++numRows);
+        }
+        assert.strictEqual(numRows, rowsAmount);
+      }
+    });
+
+    it('55.14.6 destroy a query stream early', async function() {
+      const stream = connection.queryStream(sql, [], { fetchArraySize: 20 });
+      let numRows = 0;
+      for await (const row of stream) {
+        assert.strictEqual(row[0], ++numRows);
+        if (numRows === 45)
+          break;
+      }
+      const countResult = await connection.execute(
+        "SELECT COUNT(*) FROM nodb_rs2_emp");
+      assert.strictEqual(countResult.rows[0][0], rowsAmount);
+    });
+
+    it('55.14.7 Negative - invalid value for prefetchAhead', async function() {
+      await assert.rejects(
+        async () => await connection.execute(sql, [],
+          { resultSet: true, prefetchAhead: 1 }),
+        /NJS-007:/
+      );
+    });
+  }); // 55.14
+
 });
 
 
@@ -0,0 +1,186 @@
+/* Copyright (c) 2025, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at https://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   334. soda17.js
+ *
+ * DESCRIPTION
+ *   Fetching SODA documents in batches with getNextBatch() and the async
+ *   iterators of SodaDocumentCursor and SodaOperation.
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const sodaUtil  = require('./sodaUtil.js');
+const testsUtil = require('./testsUtil.js');
+const { Readable } = require('stream');
+
+describe('334. soda17.js', function() {
+
+  let conn, collection;
+  const numDocs = 250;
+  const collName = "soda_test_334";
+
+  function getIds(docs) {
+    return docs.map(doc => doc.getContent().id).sort((a, b) => a - b);
+  }
+
+  before(async function() {
+    const runnable = await testsUtil.isSodaRunnable();
+    if (!runnable) {
+      this.skip();
+    }
+    await sodaUtil.cleanup();
+    conn = await oracledb.getConnection(dbConfig);
+    const soda = conn.getSodaDatabase();
+    collection = await soda.createCollection(collName);
+    const docs = [];
+    for (let i = 0; i < numDocs; i++) {
+      docs.push({ id: i, name: `name ${i}` });
+    }
+    await collection.insertMany(docs);
+    await conn.commit();
+  });
+
+  after(async function() {
+    if (collection) {
+      await collection.drop();
+    }
+    if (conn) {
+      await conn.close();
+    }
+  });
+
+  it('334.1 getNextBatch() returns the requested number of documents', async function() {
+    const cursor = await collection.find().getCursor();
+    const counts = [];
+    const docs = [];
+    let batch;
+    do {
+      batch = await cursor.getNextBatch(100);
+      counts.push(batch.length);
+      docs.push(...batch);
+    } while (batch.length > 0);
+    await cursor.close();
+    assert.deepStrictEqual(counts, [100, 100, 50, 0]);
+    const expectedIds = Array.from({ length: numDocs }, (v, i) => i);
+    assert.deepStrictEqual(getIds(docs), expectedIds);
+  });
+
+  it('334.2 getNextBatch() defaults to fetchArraySize', async function() {
+    const cursor = await collection.find().fetchArraySize(40).getCursor();
+    const batch = await cursor.getNextBatch();
+    assert.strictEqual(batch.length, 40);
+    assert.strictEqual(typeof batch[0].key, 'string');
+    await cursor.close();
+  });
+
+  it('334.3 getNext() and getNextBatch() can be interleaved', async function() {
+    const cursor = await collection.find().getCursor();
+    const docs = [await cursor.getNext()];
+    docs.push(...await cursor.getNextBatch(numDocs));
+    assert.strictEqual(await cursor.getNext(), undefined);
+    await cursor.close();
+    assert.strictEqual(docs.length, numDocs);
+  });
+
+  it('334.4 cursor async iterator returns all documents', async function() {
+    const cursor = await collection.find().fetchArraySize(30).getCursor();
+    const docs = [];
+    for await (const doc of cursor) {
+      docs.push(doc);
+    }
+    await cursor.close();
+    assert.strictEqual(docs.length, numDocs);
+  });
+
+  it('334.5 iterating a SodaOperation returns all documents', async function() {
+    const docs = [];
+    for await (const doc of collection.find().fetchArraySize(64)) {
+      docs.push(doc);
+    }
+    assert.strictEqual(docs.length, numDocs);
+    const filtered = [];
+    for await (const doc of collection.find().filter({ id: { $lt: 10 } })) {
+      filtered.push(doc);
+    }
+    assert.deepStrictEqual(getIds(filtered), [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+  });
+
+  it('334.6 stopping iteration of a SodaOperation early', async function() {
+    let count = 0;
+    for await (const doc of collection.find().fetchArraySize(10)) {
+      assert(doc.key);
+      if (++count === 15)
+        break;
+    }
+    assert.strictEqual(count, 15);
+    const numDocsFound = (await collection.find().count()).count;
+    assert.strictEqual(numDocsFound, numDocs);
+  });
+
+  it('334.7 creating a Readable stream from a SodaOperation', async function() {
+    const stream = Readable.from(collection.find().fetchArraySize(100));
+    const docs = [];
+    for await (const doc of stream) {
+      docs.push(doc);
+    }
+    assert.strictEqual(docs.length, numDocs);
+  });
+
+  it('334.8 getDocuments() returns many documents', async function() {
+    const docs = await collection.find().fetchArraySize(7).getDocuments();
+    const expectedIds = Array.from({ length: numDocs }, (v, i) => i);
+    assert.deepStrictEqual(getIds(docs), expectedIds);
+  });
+
+  it('334.9 Negative - invalid parameters', async function() {
+    const cursor = await collection.find().getCursor();
+    await assert.rejects(
+      async () => await cursor.getNextBatch(0),
+      /NJS-005:/
+    );
+    await assert.rejects(
+      async () => await cursor.getNextBatch(-1),
+      /NJS-005:/
+    );
+    await assert.rejects(
+      async () => await cursor.getNextBatch('10'),
+      /NJS-005:/
+    );
+    await assert.rejects(
+      async () => await cursor.getNextBatch(1, 2),
+      /NJS-009:/
+    );
+    await cursor.close();
+    await assert.rejects(
+      async () => await cursor.getNextBatch(1),
+      /NJS-066:/
+    );
+  });
+
+});
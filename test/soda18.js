@@ -0,0 +1,241 @@
+/* Copyright (c) 2025, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at https://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   335. soda18.js
+ *
+ * DESCRIPTION
+ *   Inserting and saving SODA documents in batches with insertManyStream()
+ *   and insertManyAndGetStream().
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const sodaUtil  = require('./sodaUtil.js');
+const testsUtil = require('./testsUtil.js');
+const { Readable } = require('stream');
+
+describe('335. soda18.js', function() {
+
+  let conn, soda, collection;
+  const collName = "soda_test_335";
+  const numDocs = 230;
+
+  function makeDocs(num) {
+    const docs = [];
+    for (let i = 0; i < num; i++) {
+      docs.push({ id: i, name: `name ${i}` });
+    }
+    return docs;
+  }
+
+  async function getIds(coll) {
+    const docs = await coll.find().getDocuments();
+    return docs.map(doc => doc.getContent().id).sort((a, b) => a - b);
+  }
+
+  before(async function() {
+    const runnable = await testsUtil.isSodaRunnable();
+    if (!runnable) {
+      this.skip();
+    }
+    await sodaUtil.cleanup();
+    conn = await oracledb.getConnection(dbConfig);
+    soda = conn.getSodaDatabase();
+    collection = await soda.createCollection(collName);
+  });
+
+  after(async function() {
+    if (collection) {
+      await collection.drop();
+    }
+    if (conn) {
+      await conn.close();
+    }
+  });
+
+  afterEach(async function() {
+    if (collection) {
+      await collection.truncate();
+    }
+  });
+
+  it('335.1 inserts documents from an array in batches', async function() {
+    const count = await collection.insertManyStream(makeDocs(numDocs),
+      { batchSize: 50 });
+    assert.strictEqual(count, numDocs);
+    const expectedIds = Array.from({ length: numDocs }, (v, i) => i);
+    assert.deepStrictEqual(await getIds(collection), expectedIds);
+  });
+
+  it('335.2 inserts documents from an async generator', async function() {
+    async function* generateDocs() {
+      for (let i = 0; i < numDocs; i++) {
+        yield { id: i };
+      }
+    }
+    const count = await collection.insertManyStream(generateDocs(),
+      { batchSize: 64 });
+    assert.strictEqual(count, numDocs);
+    assert.strictEqual((await collection.find().count()).count, numDocs);
+  });
+
+  it('335.3 inserts SodaDocuments from a Readable stream', async function() {
+    const docs = makeDocs(20).map(content => soda.createDocument(content));
+    const count = await collection.insertManyStream(Readable.from(docs));
+    assert.strictEqual(count, 20);
+    assert.strictEqual((await collection.find().count()).count, 20);
+  });
+
+  it('335.4 returns result documents as each batch is inserted', async function() {
+    const keys = [];
+    const stream = collection.insertManyAndGetStream(makeDocs(numDocs),
+      { batchSize: 40 });
+    for await (const doc of stream) {
+      assert.strictEqual(typeof doc.key, 'string');
+      assert.strictEqual(typeof doc.version, 'string');
+      assert.strictEqual(doc.getContent(), undefined);
+      keys.push(doc.key);
+    }
+    assert.strictEqual(keys.length, numDocs);
+    assert.strictEqual(new Set(keys).size, numDocs);
+    const doc = await collection.find().key(keys[17]).getOne();
+    assert.strictEqual(doc.getContent().id, 17);
+  });
+
+  it('335.5 stops inserting when iteration is stopped early', async function() {
+    let count = 0;
+    const stream = collection.insertManyAndGetStream(makeDocs(numDocs),
+      { batchSize: 25 });
+    for await (const doc of stream) {
+      assert(doc.key);
+      if (++count === 30)
+        break;
+    }
+    assert.strictEqual((await collection.find().count()).count, 50);
+  });
+
+  it('335.6 returns zero for an empty source', async function() {
+    assert.strictEqual(await collection.insertManyStream([]), 0);
+    const results = [];
+    for await (const doc of collection.insertManyAndGetStream([])) {
+      results.push(doc);
+    }
+    assert.strictEqual(results.length, 0);
+  });
+
+  it('335.7 commits once all batches are inserted with autoCommit', async function() {
+    const autoCommit = oracledb.autoCommit;
+    oracledb.autoCommit = true;
+    try {
+      await collection.insertManyStream(makeDocs(numDocs), { batchSize: 100 });
+    } finally {
+      oracledb.autoCommit = autoCommit;
+    }
+    await conn.rollback();
+    assert.strictEqual((await collection.find().count()).count, numDocs);
+  });
+
+  it('335.8 saves documents with client assigned keys', async function() {
+    if (testsUtil.getClientVersion() < 1909000000) this.skip();
+    const metaData = {
+      keyColumn: { name: "ID", sqlType: "VARCHAR2", assignmentMethod: "CLIENT" }
+    };
+    const coll = await soda.createCollection(`${collName}_save`, { metaData });
+    try {
+      const makeKeyedDocs = (num, version) => {
+        const docs = [];
+        for (let i = 0; i < num; i++) {
+          docs.push(soda.createDocument({ id: i, version }, { key: `${i}` }));
+        }
+        return docs;
+      };
+      let count = await coll.insertManyStream(makeKeyedDocs(30, 1),
+        { save: true, batchSize: 8 });
+      assert.strictEqual(count, 30);
+      const results = [];
+      const stream = coll.insertManyAndGetStream(makeKeyedDocs(45, 2),
+        { save: true, batchSize: 8 });
+      for await (const doc of stream) {
+        results.push(doc.key);
+      }
+      assert.strictEqual(results.length, 45);
+      count = (await coll.find().count()).count;
+      assert.strictEqual(count, 45);
+      const doc = await coll.find().key("3").getOne();
+      assert.strictEqual(doc.getContent().version, 2);
+    } finally {
+      await coll.drop();
+    }
+  });
+
+  it('335.9 reports errors from a batch', async function() {
+    async function* generateDocs() {
+      yield { id: 1 };
+      yield 5;
+    }
+    await assert.rejects(
+      async () => await collection.insertManyStream(generateDocs()),
+      /NJS-005:/
+    );
+  });
+
+  it('335.10 Negative - invalid parameters', async function() {
+    await assert.rejects(
+      async () => await collection.insertManyStream(),
+      /NJS-009:/
+    );
+    await assert.rejects(
+      async () => await collection.insertManyStream(5),
+      /NJS-005:/
+    );
+    await assert.rejects(
+      async () => await collection.insertManyStream([], { batchSize: 0 }),
+      /NJS-007:/
+    );
+    await assert.rejects(
+      async () => await collection.insertManyStream([], { save: 'yes' }),
+      /NJS-007:/
+    );
+    assert.throws(
+      () => collection.insertManyAndGetStream([], { hint: 5 }),
+      /NJS-007:/
+    );
+  });
+
+  it('335.11 inserts documents from a query stream on the same connection', async function() {
+    const sql = `select level as "id" from dual connect by level <= ${numDocs}`;
+    const stream = conn.queryStream(sql, [],
+      { outFormat: oracledb.OUT_FORMAT_OBJECT, fetchArraySize: 25 });
+    const count = await collection.insertManyStream(stream,
+      { batchSize: 40 });
+    assert.strictEqual(count, numDocs);
+    const expectedIds = Array.from({ length: numDocs }, (v, i) => i + 1);
+    assert.deepStrictEqual(await getIds(collection), expectedIds);
+  });
+
+});
@@ -0,0 +1,182 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   333. thinNativeDecode.js
+ *
+ * DESCRIPTION
+ *   Testing oracledb.thinNativeDecode which decodes fetched rows in Thin mode
+ *   using the native decoder in the node-oracledb binary.
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('333. thinNativeDecode.js', function() {
+
+  let conn;
+  const tableName = "nodb_thin_native_decode";
+  const numRows = 1500;
+  const querySql = `select IntCol, NumCol, StrCol, NStrCol, RawCol, DateCol,
+                           TSCol, TSTZCol, DblCol, FltCol, NullCol
+                    from ${tableName} order by IntCol`;
+
+  async function fetchAll(nativeDecode, options = {}) {
+    oracledb.thinNativeDecode = nativeDecode;
+    try {
+      const result = await conn.execute(querySql, [], options);
+      return result.rows;
+    } finally {
+      oracledb.thinNativeDecode = false;
+    }
+  }
+
+  before(async function() {
+    if (!oracledb.thin) this.skip();
+    oracledb.thinNativeDecode = true;
+    const available = oracledb.thinNativeDecode;
+    oracledb.thinNativeDecode = false;
+    if (!available) this.skip();
+    conn = await oracledb.getConnection(dbConfig);
+    const createSql = `create table ${tableName} (
+        IntCol number(9) not null,
+        NumCol number,
+        StrCol varchar2(4000),
+        NStrCol nvarchar2(200),
+        RawCol raw(200),
+        DateCol date,
+        TSCol timestamp,
+        TSTZCol timestamp with time zone,
+        DblCol binary_double,
+        FltCol binary_float,
+        NullCol varchar2(10)
+      )`;
+    await testsUtil.createTable(conn, tableName, createSql);
+    await conn.execute(`
+      insert into ${tableName}
+      select level,
+             case when mod(level, 7) = 0 then null
+                  else (level - 750) * 1234.5678 / 7 end,
+             case when mod(level, 11) = 0 then null
+                  else rpad('S', mod(level * 37, 4000), 'x') end,
+             case when mod(level, 13) = 0 then null
+                  else unistr('\\00e9\\20ac') || to_char(level) end,
+             case when mod(level, 5) = 0 then null
+                  else hextoraw(rpad('AB', mod(level, 100) * 2, 'CD')) end,
+             date '2000-02-29' + level,
+             timestamp '1969-12-31 23:59:59.123456' + numtodsinterval(level, 'MINUTE'),
+             from_tz(timestamp '2024-03-10 01:30:00', '-08:00') +
+                 numtodsinterval(level, 'HOUR'),
+             level / 3,
+             level / 7,
+             null
+      from dual connect by level <= :1`, [numRows], { autoCommit: true });
+  });
+
+  after(async function() {
+    if (!conn) return;
+    await testsUtil.dropTable(conn, tableName);
+    await conn.close();
+  });
+
+  it('333.1 returns the same rows as decoding in JavaScript', async function() {
+    const expected = await fetchAll(false);
+    const actual = await fetchAll(true);
+    assert.strictEqual(expected.length, numRows);
+    assert.deepStrictEqual(actual, expected);
+  });
+
+  it('333.2 returns the same rows with small fetch array sizes', async function() {
+    const options = { fetchArraySize: 3, prefetchRows: 0 };
+    const expected = await fetchAll(false, options);
+    const actual = await fetchAll(true, options);
+    assert.deepStrictEqual(actual, expected);
+  });
+
+  it('333.3 returns the same rows with fetchInfo type conversions', async function() {
+    const options = {
+      outFormat: oracledb.OUT_FORMAT_OBJECT,
+      fetchInfo: {
+        NUMCOL: { type: oracledb.STRING },
+        DATECOL: { type: oracledb.STRING }
+      }
+    };
+    const expected = await fetchAll(false, options);
+    const actual = await fetchAll(true, options);
+    assert.deepStrictEqual(actual, expected);
+  });
+
+  it('333.4 returns the same rows from a ResultSet', async function() {
+    const getRows = async function(nativeDecode) {
+      oracledb.thinNativeDecode = nativeDecode;
+      try {
+        const result = await conn.execute(querySql, [], { resultSet: true });
+        const rows = [];
+        let batch;
+        do {
+          batch = await result.resultSet.getRows(97);
+          rows.push(...batch);
+        } while (batch.length === 97);
+        await result.resultSet.close();
+        return rows;
+      } finally {
+        oracledb.thinNativeDecode = false;
+      }
+    };
+    const expected = await getRows(false);
+    const actual = await getRows(true);
+    assert.deepStrictEqual(actual, expected);
+  });
+
+  it('333.5 returns the same rows for duplicate values', async function() {
+    const sql = `select 1, 'same', sysdate - sysdate from dual
+                 connect by level <= 500`;
+    oracledb.thinNativeDecode = true;
+    let actual;
+    try {
+      actual = (await conn.execute(sql)).rows;
+    } finally {
+      oracledb.thinNativeDecode = false;
+    }
+    const expected = (await conn.execute(sql)).rows;
+    assert.deepStrictEqual(actual, expected);
+  });
+
+  it('333.6 Negative - invalid values', function() {
+    assert.throws(
+      () => oracledb.thinNativeDecode = 1,
+      /NJS-004:/
+    );
+    assert.throws(
+      () => oracledb.thinNativeDecode = 'true',
+      /NJS-004:/
+    );
+    assert.strictEqual(oracledb.thinNativeDecode, false);
+  });
+
+});
@@ -0,0 +1,181 @@
+/* Copyright (c) 2025, Oracle and/or its affiliates. */
+
+/******************************************************************************
+ *
+ * This software is dual-licensed to you under the Universal Permissive License
+ * (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+ * 2.0 as shown at https://www.apache.org/licenses/LICENSE-2.0. You may choose
+ * either license.
+ *
+ * If you elect to accept the software under the Apache License, Version 2.0,
+ * the following applies:
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * NAME
+ *   338. vectorFetchMode.js
+ *
+ * DESCRIPTION
+ *   Fetching VECTOR columns with vectorFetchMode set to "matrix".
+ *
+ *****************************************************************************/
+'use strict';
+
+const oracledb  = require('oracledb');
+const assert    = require('assert');
+const dbConfig  = require('./dbconfig.js');
+const testsUtil = require('./testsUtil.js');
+
+describe('338. vectorFetchMode.js', function() {
+
+  let conn, isRunnable = false;
+  const tableName = "nodb_vector_fetch_mode";
+  const numRows = 5;
+  const sql = `select Vec32, Vec64, Vec8, VecFlex from ${tableName}
+      order by IntCol`;
+  const options = {
+    vectorFetchMode: "matrix",
+    prefetchRows: numRows + 1,
+    fetchArraySize: numRows + 1
+  };
+
+  const getVectors = function(i) {
+    return [
+      new Float32Array([i, i + 0.5, i + 1]),
+      new Float64Array([i * 1.25, i * 2.5, i * 3.75, i * 5]),
+      new Int8Array([i, -i]),
+      new Float64Array(Array.from({ length: i + 1 }, (v, j) => i + j))
+    ];
+  };
+
+  before(async function() {
+    isRunnable = await testsUtil.checkPrerequisites(2304000000, 2304000000);
+    if (!isRunnable)
+      this.skip();
+    conn = await oracledb.getConnection(dbConfig);
+    const sql = `create table ${tableName} (
+        IntCol number(9) not null,
+        Vec32 vector(3, float32),
+        Vec64 vector(4, float64),
+        Vec8 vector(2, int8),
+        VecFlex vector
+      )`;
+    await testsUtil.createTable(conn, tableName, sql);
+    const binds = [];
+    for (let i = 1; i <= numRows; i++)
+      binds.push([i, ...getVectors(i)]);
+    binds.push([numRows + 1, null, null, null, null]);
+    await conn.executeMany(
+      `insert into ${tableName} values (:1, :2, :3, :4, :5)`, binds,
+      { bindDefs: [{ type: oracledb.NUMBER },
+        { type: oracledb.DB_TYPE_VECTOR }, { type: oracledb.DB_TYPE_VECTOR },
+        { type: oracledb.DB_TYPE_VECTOR }, { type: oracledb.DB_TYPE_VECTOR }] });
+    await conn.commit();
+  });
+
+  after(async function() {
+    if (!isRunnable)
+      return;
+    oracledb.vectorFetchMode = "separate";
+    await testsUtil.dropTable(conn, tableName);
+    await conn.close();
+  });
+
+  it('338.1 vectors of a column share one buffer', async function() {
+    const result = await conn.execute(sql, [], options);
+    for (let col = 0; col < 3; col++) {
+      const vecs = result.rows.slice(0, numRows).map(row => row[col]);
+      const buffer = vecs[0].buffer;
+      for (let i = 0; i < numRows; i++) {
+        assert.strictEqual(vecs[i].buffer, buffer);
+        assert.strictEqual(vecs[i].byteOffset, i * vecs[i].byteLength);
+      }
+    }
+    const flex = result.rows.slice(0, numRows).map(row => row[3]);
+    assert(flex.every(v => v.buffer === flex[0].buffer));
+    assert.notStrictEqual(result.rows[0][0].buffer, result.rows[0][1].buffer);
+  });
+
+  it('338.2 vectors contain the same values as when fetched separately', async function() {
+    const matrix = await conn.execute(sql, [], options);
+    const separate = await conn.execute(sql, [],
+      { vectorFetchMode: "separate" });
+    assert.deepStrictEqual(matrix.rows, separate.rows);
+    for (let i = 0; i < numRows; i++)
+      assert.deepStrictEqual(matrix.rows[i], getVectors(i + 1));
+    assert.deepStrictEqual(matrix.rows[numRows], [null, null, null, null]);
+    assert.notStrictEqual(separate.rows[0][0].buffer,
+      separate.rows[1][0].buffer);
+  });
+
+  it('338.3 sparse vectors share buffers of values and indices', async function() {
+    const compatible = testsUtil.versionStringCompare(
+      await testsUtil.getDBCompatibleVersion(), '23.6.0.0.0');
+    if (!(await testsUtil.checkPrerequisites(2306000000, 2306000000)) ||
+        !(compatible >= 0))
+      this.skip();
+    const result = await conn.execute(
+      `select to_vector('[10, [1, 3], [' || IntCol || ', 2.5]]', 10, float64,
+          sparse) from ${tableName} where IntCol <= 3 order by IntCol`, [],
+      options);
+    const vecs = result.rows.map(row => row[0]);
+    assert.strictEqual(vecs.length, 3);
+    for (let i = 0; i < vecs.length; i++) {
+      assert(vecs[i] instanceof oracledb.SparseVector);
+      assert.strictEqual(vecs[i].values.buffer, vecs[0].values.buffer);
+      assert.strictEqual(vecs[i].indices.buffer, vecs[0].indices.buffer);
+      assert.deepStrictEqual(vecs[i].values, new Float64Array([i + 1, 2.5]));
+      assert.deepStrictEqual(vecs[i].indices, new Uint32Array([1, 3]));
+      assert.strictEqual(vecs[i].numDimensions, 10);
+    }
+  });
+
+  it('338.4 fetches vectors as a matrix with oracledb.vectorFetchMode', async function() {
+    oracledb.vectorFetchMode = "matrix";
+    try {
+      const result = await conn.execute(sql, [],
+        { prefetchRows: options.prefetchRows,
+          fetchArraySize: options.fetchArraySize });
+      assert.strictEqual(result.rows[0][1].buffer, result.rows[1][1].buffer);
+      const separate = await conn.execute(sql, [],
+        { vectorFetchMode: "separate" });
+      assert.notStrictEqual(separate.rows[0][1].buffer,
+        separate.rows[1][1].buffer);
+    } finally {
+      oracledb.vectorFetchMode = "separate";
+    }
+  });
+
+  it('338.5 fetches vectors as a matrix from a result set', async function() {
+    const result = await conn.execute(sql, [],
+      { ...options, resultSet: true, outFormat: oracledb.OUT_FORMAT_OBJECT });
+    const rows = await result.resultSet.getRows(2);
+    const moreRows = await result.resultSet.getRows();
+    await result.resultSet.close();
+    assert.strictEqual(rows.length + moreRows.length, numRows + 1);
+    assert.strictEqual(rows[0].VEC64.buffer, rows[1].VEC64.buffer);
+    assert.deepStrictEqual(rows[1].VEC8, getVectors(2)[2]);
+    assert.deepStrictEqual(moreRows[0].VEC32, getVectors(3)[0]);
+  });
+
+  it('338.6 Negative - invalid values of vectorFetchMode', async function() {
+    assert.throws(() => { oracledb.vectorFetchMode = "other"; }, /NJS-004:/);
+    assert.throws(() => { oracledb.vectorFetchMode = 1; }, /NJS-004:/);
+    await assert.rejects(
+      async () => await conn.execute(sql, [], { vectorFetchMode: "other" }),
+      /NJS-007:/
+    );
+    assert.strictEqual(oracledb.vectorFetchMode, "separate");
+  });
+
+});